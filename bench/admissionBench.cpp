@@ -0,0 +1,122 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+#include "cores/client.h"
+#include "managers/patientManager.h"
+#include "bench.h"
+
+// Every heap allocation of the process, counted by the replaced operator new.
+static std::atomic<long> heapAllocations(0);
+
+void *operator new(std::size_t size)
+{
+    heapAllocations++;
+    void *memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+// Number of patients admitted through each path.
+static const int ADMISSIONS = 100000;
+
+// Ways a patient built at intake reaches the patient list.
+enum class Path
+{
+    Copy,  /**< addPatient(patient), copying the patient's lists */
+    Move,  /**< addPatient(std::move(patient)) */
+    Queue, /**< submitAdmission then drainAdmissions, moving the patient through the admission queue */
+};
+
+// Builds a patient the way the intake screen does: a name, an admission date and two treatments.
+static HMS::Patient intake(Manager::PatientManager &patientManager, int i)
+{
+    HMS::Patient patient(patientManager.generatePatientId());
+    patient.setName("Patient " + std::to_string(i % 5000));
+    patient.setStatus(HMS::PatientStatus::Admitted);
+    patient.addAdmissionDate(Handler::Date(1 + i % 28, 1 + i % 12, 2024));
+    for (int j = 0; j < 2; j++)
+    {
+        HMS::Treatment treatment;
+        if (j == 0)
+        {
+            treatment.setTreatmentType(HMS::TreatmentType::Symptomatic);
+        }
+        else
+        {
+            treatment.setTreatmentType(HMS::TreatmentType::Other);
+            treatment.setOtherTreatmentType("Routine checkup");
+        }
+        treatment.setAppointment(Handler::Date(1 + i % 28, 1 + (i + j) % 12, 2024));
+        treatment.setPriority(1 + (i + j) % 3);
+        patient.addTreatment(std::move(treatment));
+    }
+    return patient;
+}
+
+// Admits patients through one path, printing heap allocations and date pool use per admission.
+static void benchPath(const char *name, Path path)
+{
+    HMS::Client client;
+    Manager::PatientManager &patientManager = *client.patientManager;
+    NodePool<Handler::Date> &datePool = HMS::Patient::getDatePool();
+    int dates = datePool.getAllocations();
+    int slabs = datePool.getSlabAllocations();
+    int avoided = datePool.getAllocationsAvoided();
+    long allocations = heapAllocations;
+
+    double time = Bench::measure([&]()
+                                 {
+                                     for (int i = 0; i < ADMISSIONS; i++)
+                                     {
+                                         HMS::Patient patient = intake(patientManager, i);
+                                         if (path == Path::Copy)
+                                         {
+                                             patientManager.addPatient(patient);
+                                         }
+                                         else if (path == Path::Move)
+                                         {
+                                             patientManager.addPatient(std::move(patient));
+                                         }
+                                         else
+                                         {
+                                             while (!patientManager.submitAdmission(std::move(patient)))
+                                             {
+                                                 patientManager.drainAdmissions();
+                                             }
+                                         }
+                                     }
+                                     patientManager.drainAdmissions(); },
+                                 1);
+
+    std::printf("%-8s %12.2f %12.2f %12.3f %12.2f %12.0f\n", name,
+                (double)(heapAllocations - allocations) / ADMISSIONS,
+                (double)(datePool.getAllocations() - dates) / ADMISSIONS,
+                (double)(datePool.getSlabAllocations() - slabs) / ADMISSIONS,
+                (double)(datePool.getAllocationsAvoided() - avoided) / ADMISSIONS,
+                time / ADMISSIONS);
+}
+
+int main()
+{
+    Bench::title("Allocations per admission, 100000 patients with two treatments");
+    std::printf("%-8s %12s %12s %12s %12s %12s\n", "path", "heap allocs", "date nodes", "date slabs", "avoided", "ns");
+    benchPath("copy", Path::Copy);
+    benchPath("move", Path::Move);
+    benchPath("queue", Path::Queue);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <vector>
+#include "structs/arrayList.h"
+#include "structs/linkedList.h"
+#include "bench.h"
+
+using namespace List;
+
+// Linking nodes directly builds a LinkedList in linear time, so lists too long to build by appending can still
+// be read. addNode walks to the tail on every append.
+class LinkedListBuilder : public LinkedList<long>
+{
+public:
+    void build(int count)
+    {
+        Node<long> *last = nullptr;
+        for (long i = 0; i < count; i++)
+        {
+            Node<long> *node = this->createNode(i);
+            if (last == nullptr)
+            {
+                this->first = node;
+            }
+            else
+            {
+                last->next = node;
+            }
+            last = node;
+        }
+        this->size = count;
+    }
+};
+
+// Lists longer than this are not built by appending: appending is quadratic, and 1e5 elements take seconds.
+static const int FULL_APPEND_LIMIT = 10000;
+
+// Number of nodes a LinkedList may walk per measurement. Longer lists are timed on fewer appends and reads.
+static const int WALK_BUDGET = 100000000;
+
+// Gets the number of appends or reads to time on a LinkedList, each walking up to the whole list.
+static int linkedSamples(int size)
+{
+    return std::max(10, std::min(size, WALK_BUDGET / size));
+}
+
+// Appends, reads by index and scans both containers, printing nanoseconds per element.
+static void benchSize(int size)
+{
+    double arrayAppend = Bench::measure([size]()
+                                        {
+                                            ArrayList<long> list;
+                                            for (long i = 0; i < size; i++)
+                                            {
+                                                list.addNode(i);
+                                            }
+                                            Bench::keep(list.getSize()); }) /
+                         size;
+
+    double linkedAppend;
+    if (size <= FULL_APPEND_LIMIT)
+    {
+        linkedAppend = Bench::measure([size]()
+                                      {
+                                          LinkedList<long> list;
+                                          for (long i = 0; i < size; i++)
+                                          {
+                                              list.addNode(i);
+                                          }
+                                          Bench::keep(list.getSize()); }) /
+                       size;
+    }
+    else
+    {
+        // The cost of the last appends, each walking the whole list.
+        int appends = linkedSamples(size);
+        LinkedListBuilder list;
+        list.build(size - appends);
+        linkedAppend = Bench::measure([&list, appends]()
+                                      {
+                                          for (long i = 0; i < appends; i++)
+                                          {
+                                              list.addNode(i);
+                                          } },
+                                      1) /
+                       appends;
+    }
+
+    ArrayList<long> array;
+    for (long i = 0; i < size; i++)
+    {
+        array.addNode(i);
+    }
+    LinkedListBuilder linked;
+    linked.build(size);
+
+    // Reading by index walks a LinkedList from the head, so it reads fewer indexes the longer the list is.
+    std::vector<int> indexes(size);
+    for (int &index : indexes)
+    {
+        index = Bench::randomInt(0, size - 1);
+    }
+    int linkedReads = linkedSamples(size);
+
+    double arrayIndex = Bench::measure([&]()
+                                       {
+                                           long sum = 0;
+                                           for (int index : indexes)
+                                           {
+                                               sum += *array.getData(index);
+                                           }
+                                           Bench::keep(sum); }) /
+                        size;
+    double linkedIndex = Bench::measure([&]()
+                                        {
+                                            long sum = 0;
+                                            for (int i = 0; i < linkedReads; i++)
+                                            {
+                                                sum += *linked.getData(indexes[i]);
+                                            }
+                                            Bench::keep(sum); },
+                                        1) /
+                         linkedReads;
+
+    double arrayScan = Bench::measure([&array]()
+                                      {
+                                          long sum = 0;
+                                          for (long value : array)
+                                          {
+                                              sum += value;
+                                          }
+                                          Bench::keep(sum); }) /
+                       size;
+    double linkedScan = Bench::measure([&linked]()
+                                       {
+                                           long sum = 0;
+                                           for (long value : linked)
+                                           {
+                                               sum += value;
+                                           }
+                                           Bench::keep(sum); }) /
+                        size;
+
+    std::printf("%9d %12.1f %12.1f %12.1f %12.1f %12.2f %12.2f\n", size,
+                arrayAppend, linkedAppend, arrayIndex, linkedIndex, arrayScan, linkedScan);
+}
+
+int main()
+{
+    Bench::title("ArrayList vs LinkedList, ns per element");
+    std::printf("%9s %12s %12s %12s %12s %12s %12s\n", "size",
+                "array add", "linked add", "array get", "linked get", "array scan", "linked scan");
+    for (int size = 1000; size <= 10000000; size *= 10)
+    {
+        benchSize(size);
+    }
+    return 0;
+}
\ No newline at end of file
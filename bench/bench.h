@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+namespace Bench
+{
+    /**
+     * @brief Gets the random generator of a benchmark, seeded the same on every run so runs compare.
+     * @return Reference to the generator.
+     */
+    inline std::mt19937 &random()
+    {
+        static std::mt19937 generator(20240101);
+        return generator;
+    }
+
+    /**
+     * @brief Draws a random number in a range.
+     * @param min The lowest number, included.
+     * @param max The highest number, included.
+     * @return The number.
+     */
+    inline int randomInt(int min, int max)
+    {
+        return std::uniform_int_distribution<int>(min, max)(random());
+    }
+
+    /**
+     * @brief Times a callable, running it a few times and keeping the fastest run to leave out warm-up and noise.
+     * @tparam F The type of the callable.
+     * @param run The callable to time.
+     * @param repeat The number of runs.
+     * @return The time of the fastest run, in nanoseconds.
+     */
+    template <class F>
+    double measure(F run, int repeat = 3)
+    {
+        double best = 0;
+        for (int i = 0; i < repeat; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            run();
+            auto end = std::chrono::steady_clock::now();
+            double time = std::chrono::duration<double, std::nano>(end - start).count();
+            if (i == 0 || time < best)
+            {
+                best = time;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Keeps a result alive, so the compiler cannot drop the work computing it.
+     * @tparam T The type of the result.
+     * @param value The result.
+     */
+    template <class T>
+    void keep(const T &value)
+    {
+        static volatile T sink;
+        sink = value;
+    }
+
+    /**
+     * @brief Prints the title of a benchmark.
+     * @param name The name of the benchmark.
+     */
+    inline void title(const char *name)
+    {
+        std::printf("\n%s\n", name);
+    }
+}
\ No newline at end of file
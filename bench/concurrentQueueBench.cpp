@@ -0,0 +1,77 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "structs/concurrentQueue.h"
+#include "bench.h"
+
+using namespace List;
+
+// Number of values handed over per run, split between the producers.
+static const int VALUES = 2000000;
+
+// Producers enqueue their share of the values while this thread drains in batches, as the menu thread drains
+// admissions. Prints millions of values per second and how often a producer found the queue full.
+static void benchProducers(int producers)
+{
+    ConcurrentQueue<int> queue(1024);
+    int perProducer = VALUES / producers;
+    std::atomic<bool> start(false);
+    std::atomic<long> full(0);
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; producer++)
+    {
+        threads.emplace_back([&queue, &start, &full, perProducer]()
+                             {
+                                 while (!start)
+                                 {
+                                     std::this_thread::yield();
+                                 }
+                                 for (int i = 0; i < perProducer; i++)
+                                 {
+                                     while (!queue.tryEnqueue(i))
+                                     {
+                                         full++;
+                                         std::this_thread::yield();
+                                     }
+                                 } });
+    }
+
+    long total = (long)perProducer * producers;
+    double time = Bench::measure([&]()
+                                 {
+                                     start = true;
+                                     long drained = 0;
+                                     long sum = 0;
+                                     while (drained < total)
+                                     {
+                                         int count = queue.drain([&sum](int &&value)
+                                                                 { sum += value; },
+                                                                 256);
+                                         drained += count;
+                                         if (count == 0)
+                                         {
+                                             std::this_thread::yield();
+                                         }
+                                     }
+                                     Bench::keep(sum); },
+                                 1);
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::printf("%9d %12.1f %12.3f\n", producers, total / time * 1e3, (double)full / total);
+}
+
+int main()
+{
+    Bench::title("ConcurrentQueue, producers against one draining consumer");
+    std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    std::printf("%9s %12s %12s\n", "producers", "M values/s", "full/value");
+    for (int producers = 1; producers <= 16; producers *= 2)
+    {
+        benchProducers(producers);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include <thread>
+#include <utility>
+#include <vector>
+#include "structs/parallelSort.h"
+#include "bench.h"
+
+using namespace List;
+
+typedef std::pair<long long, int> Entry;
+
+// Sorts fresh copies of the entries with a thread cap, keeping the fastest run.
+static double measureSort(std::vector<Entry> &unsorted, int threads)
+{
+    ParallelSort::setMaxThreads(threads);
+    double best = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        std::vector<Entry> entries = unsorted;
+        double time = Bench::measure([&entries]()
+                                     { ParallelSort::stableSort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b)
+                                                                { return a.first < b.first; }); },
+                                     1);
+        if (i == 0 || time < best)
+        {
+            best = time;
+        }
+    }
+    return best;
+}
+
+// Sorts keyed entries, as the key sorts of the lists do, on 1 to 8 threads, printing milliseconds per sort
+// and the number of threads the sort actually used.
+static void benchSize(int size)
+{
+    std::vector<Entry> unsorted(size);
+    for (int i = 0; i < size; i++)
+    {
+        unsorted[i] = Entry(Bench::randomInt(0, 1000000), i);
+    }
+
+    std::printf("%9d", size);
+    for (int threads = 1; threads <= 8; threads *= 2)
+    {
+        double time = measureSort(unsorted, threads);
+        std::printf(" %9.3f (%d)", time / 1e6, ParallelSort::threadsFor(size));
+    }
+    std::printf("\n");
+}
+
+int main()
+{
+    Bench::title("ParallelSort::stableSort, ms per sort with a cap of 1, 2, 4 and 8 threads (threads used)");
+    std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    std::printf("%9s %13s %13s %13s %13s\n", "size", "1", "2", "4", "8");
+
+    // Around MIN_SEGMENT, where a second thread starts to be used, then up to a large census.
+    int sizes[] = {ParallelSort::MIN_SEGMENT - 1, ParallelSort::MIN_SEGMENT * 2 - 1, ParallelSort::MIN_SEGMENT * 2,
+                   ParallelSort::MIN_SEGMENT * 4, ParallelSort::MIN_SEGMENT * 8, 1000000};
+    for (int size : sizes)
+    {
+        benchSize(size);
+    }
+    ParallelSort::setMaxThreads(0);
+    return 0;
+}
\ No newline at end of file
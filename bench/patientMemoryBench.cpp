@@ -0,0 +1,184 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+#include "cores/client.h"
+#include "managers/patientManager.h"
+#include "structs/stringPool.h"
+#include "structs/view.h"
+#include "bench.h"
+
+// Number of patients admitted per run.
+static const int PATIENTS = 100000;
+
+// Number of name searches timed per run.
+static const int SEARCHES = 1000;
+
+// Bytes handed out by operator new and not yet deleted, the allocator's own overhead left out.
+static std::atomic<long> allocated(0);
+
+// Allocates a block with its size stored just before it, counting it as in use.
+static void *allocate(std::size_t size, std::size_t alignment)
+{
+    if (alignment < __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    }
+    std::size_t total = (size + 2 * alignment - 1) / alignment * alignment;
+    char *block = (char *)std::aligned_alloc(alignment, total);
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    char *data = block + alignment;
+    *(std::size_t *)(data - sizeof(std::size_t)) = size;
+    allocated.fetch_add((long)size, std::memory_order_relaxed);
+    return data;
+}
+
+// Frees a block of allocate().
+static void deallocate(void *data, std::size_t alignment)
+{
+    if (data == nullptr)
+    {
+        return;
+    }
+    if (alignment < __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    }
+    allocated.fetch_sub((long)*(std::size_t *)((char *)data - sizeof(std::size_t)), std::memory_order_relaxed);
+    std::free((char *)data - alignment);
+}
+
+// The global allocation functions, replaced so every container and pool is counted on any standard library.
+void *operator new(std::size_t size) { return allocate(size, 0); }
+void *operator new[](std::size_t size) { return allocate(size, 0); }
+void *operator new(std::size_t size, std::align_val_t alignment) { return allocate(size, (std::size_t)alignment); }
+void *operator new[](std::size_t size, std::align_val_t alignment) { return allocate(size, (std::size_t)alignment); }
+void operator delete(void *data) noexcept { deallocate(data, 0); }
+void operator delete[](void *data) noexcept { deallocate(data, 0); }
+void operator delete(void *data, std::size_t) noexcept { deallocate(data, 0); }
+void operator delete[](void *data, std::size_t) noexcept { deallocate(data, 0); }
+void operator delete(void *data, std::align_val_t alignment) noexcept { deallocate(data, (std::size_t)alignment); }
+void operator delete[](void *data, std::align_val_t alignment) noexcept { deallocate(data, (std::size_t)alignment); }
+void operator delete(void *data, std::size_t, std::align_val_t alignment) noexcept { deallocate(data, (std::size_t)alignment); }
+void operator delete[](void *data, std::size_t, std::align_val_t alignment) noexcept { deallocate(data, (std::size_t)alignment); }
+
+// Gets the bytes of heap in use, as counted by the replaced operator new.
+static long heapInUse()
+{
+    return allocated.load(std::memory_order_relaxed);
+}
+
+// Gets the name of a patient: one of `names` distinct names, long enough not to fit in a std::string inline.
+static std::string patientName(int i, int names)
+{
+    return "Patient with a long name " + std::to_string(i % names);
+}
+
+// Gets the bytes per patient a name and an "Other" treatment description take when interned, as two Symbols into a
+// pool of their own, and when held as two std::strings, the layout before interning. Both count the fields and the
+// heap they point to.
+static void layoutBytes(int names, double &symbolBytes, double &stringBytes)
+{
+    std::vector<List::Symbol> symbols;
+    symbols.reserve(2 * PATIENTS);
+    long heap = heapInUse();
+    {
+        List::StringPool pool;
+        for (int i = 0; i < PATIENTS; i++)
+        {
+            symbols.push_back(pool.intern(patientName(i, names)));
+            symbols.push_back(pool.intern("Routine checkup"));
+        }
+        symbolBytes = 2 * sizeof(List::Symbol) + (double)(heapInUse() - heap) / PATIENTS;
+    }
+
+    std::vector<std::string> strings;
+    strings.reserve(2 * PATIENTS);
+    heap = heapInUse();
+    for (int i = 0; i < PATIENTS; i++)
+    {
+        strings.push_back(patientName(i, names));
+        strings.push_back("Routine checkup");
+    }
+    stringBytes = 2 * sizeof(std::string) + (double)(heapInUse() - heap) / PATIENTS;
+}
+
+// Admits patients with a given number of distinct names, each with an "Other" treatment of the same description,
+// then prints the heap per patient, the number of strings newly interned, the bytes the two strings take per patient
+// as Symbols and as std::strings, and the cost of a name search through the name index and by scanning every patient.
+static void benchNames(int names)
+{
+    double symbolBytes;
+    double stringBytes;
+    layoutBytes(names, symbolBytes, stringBytes);
+
+    HMS::Client client;
+    Manager::PatientManager &patientManager = *client.patientManager;
+    int strings = List::StringPool::global().getSize();
+    long heap = heapInUse();
+
+    for (int i = 0; i < PATIENTS; i++)
+    {
+        HMS::Patient patient(patientManager.generatePatientId());
+        patient.setName(patientName(i, names));
+        patient.setStatus(HMS::PatientStatus::Admitted);
+        patient.addAdmissionDate(Handler::Date(1 + i % 28, 1 + i % 12, 2024));
+        HMS::Treatment treatment;
+        treatment.setTreatmentType(HMS::TreatmentType::Other);
+        treatment.setOtherTreatmentType("Routine checkup");
+        treatment.setAppointment(Handler::Date(1 + i % 28, 1 + i % 12, 2024));
+        treatment.setPriority(1 + i % 3);
+        patient.addTreatment(std::move(treatment));
+        patientManager.addPatient(std::move(patient));
+    }
+
+    double bytes = (double)(heapInUse() - heap) / PATIENTS;
+    int interned = List::StringPool::global().getSize() - strings;
+
+    View<HMS::Patient> all;
+    all.reserve(PATIENTS);
+    for (HMS::Patient &patient : patientManager.getPatientListIterator())
+    {
+        all.addNode(patient);
+    }
+    double indexed = Bench::measure([&]()
+                                    {
+                                        int found = 0;
+                                        for (int i = 0; i < SEARCHES; i++)
+                                        {
+                                            View<HMS::Patient> matches;
+                                            found += patientManager.searchPatientsByName(matches, patientName(i * 7919, names), false, false);
+                                        }
+                                        Bench::keep(found); }) /
+                     SEARCHES;
+    double scanned = Bench::measure([&]()
+                                    {
+                                        int found = 0;
+                                        for (int i = 0; i < SEARCHES / 100; i++)
+                                        {
+                                            View<HMS::Patient> matches;
+                                            all.searchNodes(matches, HMS::Patient::searchName, patientName(i * 7919, names));
+                                            found += matches.getSize();
+                                        }
+                                        Bench::keep(found); }) /
+                     (SEARCHES / 100);
+
+    std::printf("%9d %12.0f %12d %12.0f %12.0f %12.1f %12.1f\n", names, bytes, interned, symbolBytes, stringBytes, indexed / 1e3, scanned / 1e3);
+}
+
+int main()
+{
+    Bench::title("Memory per patient and name search, 100000 patients");
+    std::printf("sizeof Patient %zu, Treatment %zu, Symbol %zu, std::string %zu bytes\n",
+                sizeof(HMS::Patient), sizeof(HMS::Treatment), sizeof(List::Symbol), sizeof(std::string));
+    std::printf("%9s %12s %12s %12s %12s %12s %12s\n", "names", "heap bytes", "new strings", "symbol bytes", "string bytes", "index us", "scan us");
+    benchNames(10);
+    benchNames(5000);
+    benchNames(PATIENTS);
+    return 0;
+}
\ No newline at end of file
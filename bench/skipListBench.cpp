@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <vector>
+#include "structs/skipList.h"
+#include "structs/orderedLinkedList.h"
+#include "bench.h"
+
+using namespace List;
+
+// Linking nodes directly builds a sorted list in linear time, so lists too long to build by inserting can still
+// be read. addNode walks to the insertion point on every insert.
+class OrderedListBuilder : public OrderedLinkedList<long>
+{
+public:
+    void build(std::vector<long> &sorted)
+    {
+        Node<long> *last = nullptr;
+        for (long id : sorted)
+        {
+            Node<long> *node = this->createNode(id);
+            if (last == nullptr)
+            {
+                this->first = node;
+            }
+            else
+            {
+                last->next = node;
+            }
+            last = node;
+        }
+        this->size = (int)sorted.size();
+    }
+};
+
+// Number of nodes the sorted linked list may walk per measurement. Longer lists are timed on fewer operations.
+static const int WALK_BUDGET = 20000000;
+
+// Gets the number of inserts or lookups to time on the sorted linked list, each walking up to the whole list.
+static int linkedSamples(int size)
+{
+    return std::max(10, std::min(size, WALK_BUDGET / size));
+}
+
+// Inserts patient IDs in random order and looks them up in both lists, printing nanoseconds per operation.
+static void benchSize(int size)
+{
+    std::vector<long> ids(size);
+    for (int i = 0; i < size; i++)
+    {
+        ids[i] = i + 1;
+    }
+    std::shuffle(ids.begin(), ids.end(), Bench::random());
+
+    double skipInsert = Bench::measure([&ids]()
+                                       {
+                                           SkipList<long> list;
+                                           for (long &id : ids)
+                                           {
+                                               list.addNode(id);
+                                           }
+                                           Bench::keep(list.getSize()); },
+                                       1) /
+                        size;
+
+    // The sorted linked list holds every ID but the last ones, then is timed inserting those.
+    int inserts = linkedSamples(size);
+    std::vector<long> sorted(ids.begin(), ids.end() - inserts);
+    std::sort(sorted.begin(), sorted.end());
+    OrderedListBuilder linked;
+    linked.build(sorted);
+    double linkedInsert = Bench::measure([&]()
+                                         {
+                                             for (int i = size - inserts; i < size; i++)
+                                             {
+                                                 linked.addNode(ids[i]);
+                                             } },
+                                         1) /
+                          inserts;
+
+    SkipList<long> skip;
+    for (long &id : ids)
+    {
+        skip.addNode(id);
+    }
+    double skipFind = Bench::measure([&]()
+                                     {
+                                         long sum = 0;
+                                         for (long &id : ids)
+                                         {
+                                             sum += *skip.getData(id);
+                                         }
+                                         Bench::keep(sum); },
+                                     1) /
+                      size;
+    int finds = linkedSamples(size);
+    double linkedFind = Bench::measure([&]()
+                                       {
+                                           long sum = 0;
+                                           for (int i = 0; i < finds; i++)
+                                           {
+                                               sum += *linked.getData(ids[i]);
+                                           }
+                                           Bench::keep(sum); },
+                                       1) /
+                        finds;
+
+    std::printf("%9d %12.1f %12.1f %12.1f %12.1f\n", size, skipInsert, linkedInsert, skipFind, linkedFind);
+}
+
+int main()
+{
+    Bench::title("SkipList vs sorted LinkedList on patient IDs, ns per operation");
+    std::printf("%9s %12s %12s %12s %12s\n", "size", "skip add", "linked add", "skip find", "linked find");
+    for (int size = 1000; size <= 100000; size *= 10)
+    {
+        benchSize(size);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include <utility>
+#include "cores/patient.h"
+#include "structs/arrayList.h"
+#include "structs/parallelSort.h"
+#include "structs/view.h"
+#include "bench.h"
+
+using namespace List;
+
+// Sorts fresh copies of a view, keeping the fastest run, so no run starts from an already sorted view.
+// A million patients take seconds per sort by comparison, so they are sorted once.
+template <class F>
+static double measureSort(View<HMS::Patient> &unsorted, F sort)
+{
+    double best = 0;
+    int repeat = unsorted.getSize() < 1000000 ? 3 : 1;
+    for (int i = 0; i < repeat; i++)
+    {
+        View<HMS::Patient> view = unsorted;
+        double time = Bench::measure([&]()
+                                     { sort(view); },
+                                     1);
+        if (i == 0 || time < best)
+        {
+            best = time;
+        }
+    }
+    return best;
+}
+
+// Sorts a view of patients with the comparison called on every comparison, then with the key of each patient
+// computed once, printing milliseconds per sort.
+template <auto Compare>
+static void benchOrder(const char *name, View<HMS::Patient> &unsorted)
+{
+    double compared = measureSort(unsorted, [](View<HMS::Patient> &view)
+                                  { view.sortNodes(Compare); });
+    double keyed = measureSort(unsorted, [](View<HMS::Patient> &view)
+                               { view.sortNodes<Compare>(); });
+    std::printf("%9d %-12s %12.2f %12.2f %10.1fx\n", unsorted.getSize(), name, compared / 1e6, keyed / 1e6, compared / keyed);
+}
+
+// Builds patients with one ongoing treatment of random appointment, days of stay and priority.
+static void benchSize(int size)
+{
+    ArrayList<HMS::Patient> patients;
+    patients.reserve(size);
+    for (int i = 0; i < size; i++)
+    {
+        HMS::Patient patient(i + 1);
+        HMS::Treatment treatment;
+        treatment.setAppointment(Handler::Date(Bench::randomInt(1, 28), Bench::randomInt(1, 12), Bench::randomInt(2020, 2024)));
+        treatment.setDayOfStay(Bench::randomInt(0, 60));
+        treatment.setPriority(Bench::randomInt(1, 100));
+        patient.addTreatment(std::move(treatment));
+        patients.addNode(std::move(patient));
+    }
+    View<HMS::Patient> unsorted;
+    unsorted.assign(patients);
+
+    benchOrder<HMS::Patient::compareTreatmentAppointment>("appointment", unsorted);
+    benchOrder<HMS::Patient::compareTreatmentDayOfStay>("day of stay", unsorted);
+    benchOrder<HMS::Patient::compareTreatmentPriority>("priority", unsorted);
+}
+
+int main()
+{
+    // One thread, so the gain is the key's alone.
+    ParallelSort::setMaxThreads(1);
+    Bench::title("Sorting a view of patients, comparison vs sort key, ms per sort on one thread");
+    std::printf("%9s %-12s %12s %12s %11s\n", "size", "order", "comparison", "key", "speedup");
+    for (int size = 10000; size <= 1000000; size *= 10)
+    {
+        benchSize(size);
+    }
+    return 0;
+}
\ No newline at end of file
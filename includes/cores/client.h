@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include "handlers/errorHandler.h"
 #include "handlers/inputHandler.h"
 #include "managers/patientManager.h"
@@ -28,6 +29,8 @@ namespace HMS
         ManagePatients = 1,   /**< Option to manage patients */
         ManageTransactions,   /**< Option to manage transactions */
         GenerateReport,       /**< Option to generate reports */
+        SaveSnapshot,         /**< Option to save the patients to a snapshot file */
+        LoadSnapshot,         /**< Option to load the patients from a snapshot file */
         ExitProgram           /**< Option to exit the program */
     };
 
@@ -41,8 +44,10 @@ namespace HMS
         /**
          * @brief Constructor for the Client class.
          * Initializes the Client object and sets up necessary managers and handlers.
+         * @param snapshotPath A snapshot file to load the patients from, or empty to start without patients.
+         * A snapshot that cannot be loaded is reported as an error.
          */
-        Client();
+        Client(const std::string &snapshotPath = "");
         
         /**
          * @brief Destructor for the Client class.
@@ -3,6 +3,10 @@
 #include <iostream>
 #include "handlers/inputHandler.h"
 #include "structs/orderedLinkedList.h"
+#include "structs/orderedUnrolledList.h"
+#include "structs/intrusiveHook.h"
+#include "structs/sortKey.h"
+#include "structs/stringPool.h"
 #include "cores/treatment.h"
 
 namespace HMS
@@ -26,6 +30,12 @@ namespace HMS
      */
     extern const int PatientStatusSize;
 
+    /**
+     * @brief Number of treatments in each chunk of a patient's treatment list. Most patients have a few treatments,
+     * so small chunks keep the memory of each patient, and the time to load many of them, low.
+     */
+    const int TreatmentChunkSize = 4;
+
     /**
      * @brief Class representing a patient in the Hospital Management System.
      */
@@ -77,15 +87,27 @@ namespace HMS
 
         /**
          * @brief Sets the name of the patient.
-         * @param name The name to set.
+         * @param name The name to set, moved into the patient.
          */
         void setName(std::string name);
 
         /**
          * @brief Gets the name of the patient.
-         * @return The name of the patient.
+         * @return Reference to the name of the patient, held by the global string pool.
+         */
+        const std::string &getName();
+
+        /**
+         * @brief Gets the interned name of the patient, which compares equal exactly when the names do.
+         * @return The symbol of the name.
          */
-        std::string getName();
+        Symbol getNameSymbol();
+
+        /**
+         * @brief Sets the name of the patient from a string already interned in the global string pool.
+         * @param name The symbol of the name.
+         */
+        void setNameSymbol(Symbol name);
 
         /**
          * @brief Searches for a patient by name.
@@ -123,7 +145,7 @@ namespace HMS
 
         /**
          * @brief Adds a treatment to the patient's treatment list.
-         * @param treatment The treatment to add.
+         * @param treatment The treatment to add, moved into the list.
          */
         void addTreatment(Treatment treatment);
 
@@ -200,7 +222,7 @@ namespace HMS
          * @brief Gets an iterator for the patient's treatments.
          * @return An iterator for the treatments.
          */
-        Iterator<Treatment> getTreatmentIterator();
+        UnrolledIterator<Treatment, TreatmentChunkSize> getTreatmentIterator();
 
         /**
          * @brief Gets an iterator for the patient's admissions.
@@ -214,12 +236,77 @@ namespace HMS
          */
         Iterator<Handler::Date> getDischargesIterator();
 
+        /**
+         * @brief Gets the node pool shared by the admission and discharge lists of all patients.
+         * @return Reference to the date node pool.
+         */
+        static NodePool<Handler::Date> &getDatePool();
+
+        /**
+         * @brief Hook linking the patient into the transaction queue without copying it.
+         * The patient leaves the queue when it is destroyed.
+         */
+        IntrusiveHook<Patient> transactionHook;
+
     private:
         unsigned int id;                             /**< The ID of the patient */
-        std::string name;                            /**< The name of the patient */
+        Symbol name;                                 /**< The name of the patient, interned in the global string pool */
         PatientStatus status;                        /**< The status of the patient */
-        OrderedLinkedList<Treatment> treatments;     /**< The list of treatments for the patient */
+        OrderedUnrolledList<Treatment, TreatmentChunkSize> treatments; /**< The list of treatments for the patient */
         OrderedLinkedList<Handler::Date> admissions; /**< The list of admission dates for the patient */
         OrderedLinkedList<Handler::Date> discharges; /**< The list of discharge dates for the patient */
+
+        static NodePool<Handler::Date> datePool;   /**< Node pool shared by every patient's admissions and discharges, on any thread */
+    };
+}
+
+namespace List
+{
+    /**
+     * @brief Sort key of Patient::compareTreatmentAppointment: the latest ongoing appointment, latest first,
+     * patients without an ongoing treatment last.
+     */
+    template <>
+    struct SortKey<&HMS::Patient::compareTreatmentAppointment>
+    {
+        static const bool enabled = true; /**< The comparison has a key */
+
+        /**
+         * @param patient The patient to compute the key of.
+         * @return The sort key of the patient.
+         */
+        static long long key(HMS::Patient &patient);
+    };
+
+    /**
+     * @brief Sort key of Patient::compareTreatmentDayOfStay: the days of stay of the ongoing treatment,
+     * patients without an ongoing treatment last.
+     */
+    template <>
+    struct SortKey<&HMS::Patient::compareTreatmentDayOfStay>
+    {
+        static const bool enabled = true; /**< The comparison has a key */
+
+        /**
+         * @param patient The patient to compute the key of.
+         * @return The sort key of the patient.
+         */
+        static long long key(HMS::Patient &patient);
+    };
+
+    /**
+     * @brief Sort key of Patient::compareTreatmentPriority: the priority of the ongoing treatment, highest first,
+     * patients without an ongoing treatment last.
+     */
+    template <>
+    struct SortKey<&HMS::Patient::compareTreatmentPriority>
+    {
+        static const bool enabled = true; /**< The comparison has a key */
+
+        /**
+         * @param patient The patient to compute the key of.
+         * @return The sort key of the patient.
+         */
+        static long long key(HMS::Patient &patient);
     };
 }
\ No newline at end of file
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "handlers/inputHandler.h"
+#include "structs/stringPool.h"
+#include "cores/patient.h"
+
+namespace HMS
+{
+    /**
+     * @brief Class representing a search over patients: criteria on their name, status and latest treatment,
+     * combined with AND, OR and NOT.
+     * A query is built as an expression tree, then compiled once into a branch program: every criterion is a test
+     * that jumps to the next test or straight to the verdict, so AND and OR short-circuit and a patient is matched
+     * by one loop over flat instructions, without recursion, a value stack or allocation.
+     * Treatment criteria look at the latest treatment, like the treatment type search; patients without treatment
+     * never match them.
+     */
+    class PatientQuery
+    {
+    public:
+        /**
+         * @brief Constructs a query matching every patient.
+         */
+        PatientQuery();
+
+        /**
+         * @brief Matches patients by name.
+         * @param name The name, or the prefix of the names, to match.
+         * @param prefix Whether to match every name starting with `name` rather than `name` only.
+         * @param ignoreCase Whether to ignore the case of ASCII letters.
+         * @return The query.
+         */
+        static PatientQuery name(std::string name, bool prefix = false, bool ignoreCase = false);
+
+        /**
+         * @brief Matches patients by status.
+         * @param status The status to match.
+         * @return The query.
+         */
+        static PatientQuery status(PatientStatus status);
+
+        /**
+         * @brief Matches patients by the type of their latest treatment.
+         * @param treatmentType The treatment type to match.
+         * @param otherType For TreatmentType::Other, the other treatment type to match, or empty to match any.
+         * @return The query.
+         */
+        static PatientQuery treatmentType(TreatmentType treatmentType, std::string otherType = "");
+
+        /**
+         * @brief Matches patients whose latest treatment has a priority in a range.
+         * @param min The lowest priority, included.
+         * @param max The highest priority, included.
+         * @return The query.
+         */
+        static PatientQuery priority(int min, int max);
+
+        /**
+         * @brief Matches patients whose latest treatment has an appointment in a range of dates.
+         * @param first The first date, included.
+         * @param last The last date, included.
+         * @return The query.
+         */
+        static PatientQuery appointment(Handler::Date first, Handler::Date last);
+
+        /**
+         * @brief Matches patients whose latest treatment has a length of stay in a range.
+         * @param min The shortest stay in days, included.
+         * @param max The longest stay in days, included.
+         * @return The query.
+         */
+        static PatientQuery dayOfStay(int min, int max);
+
+        /**
+         * @brief Parses a query from text, e.g. `status=admitted and (type=hemostasis or priority=2..3) and not name=Al*`.
+         * Criteria are `name=`, `name~` (ignore case), `status=`, `type=`, `priority=`, `appointment=` and `stay=`;
+         * a trailing `*` on a name matches a prefix, `a..b` gives a range, and values with spaces are quoted.
+         * Keywords, statuses and preset treatment types ignore case; any other type is an other treatment type.
+         * @param text The text of the query.
+         * @param query Receives the query.
+         * @return true if the text is a valid query, false otherwise.
+         */
+        static bool parse(const std::string &text, PatientQuery &query);
+
+        /**
+         * @brief Combines two queries, matching the patients both match.
+         * @param other The other query.
+         * @return The query.
+         */
+        PatientQuery operator&&(const PatientQuery &other) const;
+
+        /**
+         * @brief Combines two queries, matching the patients either matches.
+         * @param other The other query.
+         * @return The query.
+         */
+        PatientQuery operator||(const PatientQuery &other) const;
+
+        /**
+         * @brief Negates a query, matching the patients it does not match.
+         * @return The query.
+         */
+        PatientQuery operator!() const;
+
+        /**
+         * @brief Compiles the query into its branch program, unless the program is up to date. Names are resolved
+         * against the string pool; a name missing from the pool compiles to a failing test, so the program is only
+         * compiled again once the pool has grown. Called by matches() if the query was never compiled.
+         */
+        void compile();
+
+        /**
+         * @brief Checks if a patient matches the query.
+         * @param patient The patient to check.
+         * @return true if the patient matches, false otherwise.
+         */
+        bool matches(Patient &patient);
+
+    private:
+        /**
+         * @brief Kinds of expression nodes and of branch program tests.
+         */
+        enum Kind
+        {
+            All,           /**< Matches every patient */
+            And,           /**< Both children match */
+            Or,            /**< Either child matches */
+            Not,           /**< The child does not match */
+            Name,          /**< Name equals the text */
+            NamePrefix,    /**< Name starts with the text */
+            Status,        /**< Status equals the minimum */
+            Type,          /**< Latest treatment type equals the minimum, and the other type the text if any */
+            Priority,      /**< Latest treatment priority is in the range */
+            Appointment,   /**< Latest treatment appointment ordinal is in the range */
+            DayOfStay      /**< Latest treatment length of stay is in the range */
+        };
+
+        /**
+         * @brief A node of the expression tree.
+         */
+        struct Node
+        {
+            Kind kind;        /**< The kind of node */
+            int left;         /**< Index of the first child, for And, Or and Not */
+            int right;        /**< Index of the second child, for And and Or */
+            int min;          /**< Lower bound of the criterion, or the value it equals */
+            int max;          /**< Upper bound of the criterion */
+            bool ignoreCase;  /**< Whether name criteria ignore case */
+            std::string text; /**< Name or other treatment type of the criterion */
+        };
+
+        /**
+         * @brief A test of the branch program, with where to go on either outcome.
+         */
+        struct Test
+        {
+            Kind kind;           /**< The criterion to test */
+            int min;             /**< Lower bound of the criterion, or the value it equals */
+            int max;             /**< Upper bound of the criterion */
+            bool ignoreCase;     /**< Whether name criteria ignore case */
+            List::Symbol symbol; /**< The interned text, for exact names and other treatment types */
+            int node;            /**< Index of the criterion's node, for its text */
+            int onTrue;          /**< Next test if the patient passes, or ACCEPT / REJECT */
+            int onFalse;         /**< Next test if the patient fails, or ACCEPT / REJECT */
+        };
+
+        static const int ACCEPT = -1; /**< Branch target matching the patient */
+        static const int REJECT = -2; /**< Branch target rejecting the patient */
+
+        std::vector<Node> nodes; /**< The expression tree, children before parents; the root is last */
+        std::vector<Test> tests; /**< The compiled branch program */
+        int entry;               /**< The first test, or ACCEPT / REJECT */
+        bool compiled;           /**< Whether the branch program was compiled from the current tree */
+        bool resolved;           /**< Whether every text of the branch program was found in the string pool */
+        int poolSize;            /**< Size of the string pool when the branch program was compiled */
+
+        /**
+         * @brief Constructs a query of a single criterion.
+         * @param node The criterion.
+         */
+        PatientQuery(Node node);
+
+        /**
+         * @brief Combines two queries under a new root.
+         * @param kind And or Or.
+         * @param other The second query.
+         * @return The query.
+         */
+        PatientQuery combine(Kind kind, const PatientQuery &other) const;
+
+        /**
+         * @brief Compiles a subtree, given where its outcomes lead.
+         * @param index The root of the subtree.
+         * @param onTrue Where to go if the subtree matches.
+         * @param onFalse Where to go if it does not.
+         * @return The entry of the subtree's tests.
+         */
+        int compileNode(int index, int onTrue, int onFalse);
+
+        /**
+         * @brief Runs a single test.
+         * @param test The test.
+         * @param node The criterion's node.
+         * @param patient The patient.
+         * @param latestTreatment The latest treatment of the patient, or nullptr.
+         * @return The outcome of the test.
+         */
+        static bool evaluate(const Test &test, const Node &node, Patient &patient, Treatment *latestTreatment);
+    };
+}
\ No newline at end of file
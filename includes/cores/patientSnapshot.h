@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "structs/hashMap.h"
+#include "structs/stringPool.h"
+#include "cores/patient.h"
+
+namespace HMS
+{
+    /**
+     * @brief Version of the snapshot format, raised whenever a record changes.
+     */
+    const uint32_t SnapshotVersion = 1;
+
+    /**
+     * @brief Written as is by the saving machine, so a snapshot from a machine of the other byte order is rejected.
+     */
+    const uint32_t SnapshotByteOrder = 0x01020304;
+
+    /**
+     * @brief Header at the start of a snapshot file. Every section starts on an 8 byte boundary.
+     */
+    struct SnapshotHeader
+    {
+        char magic[8];             /**< "HMSSNAP" and a null character */
+        uint32_t version;          /**< SnapshotVersion */
+        uint32_t byteOrder;        /**< SnapshotByteOrder */
+        int32_t idIndex;           /**< The last patient ID generated */
+        uint32_t patientCount;     /**< Number of patient records */
+        uint32_t treatmentCount;   /**< Number of treatment records */
+        uint32_t dateCount;        /**< Number of admission and discharge dates */
+        uint32_t stringCount;      /**< Number of strings, the first being the empty string */
+        uint32_t reserved;         /**< Zero */
+        uint64_t stringBytes;      /**< Size of the string data */
+        uint64_t patientsOffset;   /**< Offset of the SnapshotPatient records, in ID order */
+        uint64_t treatmentsOffset; /**< Offset of the SnapshotTreatment records */
+        uint64_t datesOffset;      /**< Offset of the dates, as int32_t day ordinals */
+        uint64_t stringsOffset;    /**< Offset of the SnapshotString records */
+        uint64_t stringDataOffset; /**< Offset of the string data, not null terminated */
+        uint64_t fileSize;         /**< Size of the whole file */
+    };
+
+    /**
+     * @brief A patient in a snapshot. Its treatments and dates are ranges of the treatment and date sections,
+     * in the order of the patient's lists.
+     */
+    struct SnapshotPatient
+    {
+        int32_t id;              /**< The ID of the patient */
+        uint32_t name;           /**< Index of the name in the string section */
+        uint32_t firstTreatment; /**< Index of the first treatment */
+        uint32_t treatmentCount; /**< Number of treatments */
+        uint32_t firstDate;      /**< Index of the first admission date, the discharge dates follow */
+        uint32_t admissionCount; /**< Number of admission dates */
+        uint32_t dischargeCount; /**< Number of discharge dates */
+        uint8_t status;          /**< The PatientStatus */
+        uint8_t padding[3];      /**< Zero */
+    };
+
+    /**
+     * @brief A treatment in a snapshot.
+     */
+    struct SnapshotTreatment
+    {
+        int32_t appointment; /**< Day ordinal of the appointment */
+        int32_t dayOfStay;   /**< Number of days of stay */
+        int32_t priority;    /**< Priority */
+        uint32_t otherType;  /**< Index of the other treatment type in the string section */
+        uint8_t type;        /**< The TreatmentType */
+        uint8_t completed;   /**< 1 if the treatment is completed, 0 otherwise */
+        uint8_t padding[2];  /**< Zero */
+    };
+
+    /**
+     * @brief A string in a snapshot, stored once however many records use it.
+     */
+    struct SnapshotString
+    {
+        uint64_t offset;  /**< Offset of the string in the string data */
+        uint32_t length;  /**< Length of the string */
+        uint32_t padding; /**< Zero */
+    };
+
+    /**
+     * @brief Class giving read access to a snapshot file of the patients.
+     * The file is memory-mapped where the platform allows it and read in place: the records are fixed size
+     * structs, so a record is read by indexing its section, with no parsing. Opening checks the header and
+     * the bounds of every record once, so the records can then be used without further checks.
+     */
+    class PatientSnapshot
+    {
+    public:
+        /**
+         * @brief Constructs a snapshot with no file open.
+         */
+        PatientSnapshot();
+
+        /**
+         * @brief Destructor. Closes the file.
+         */
+        ~PatientSnapshot();
+
+        /**
+         * @brief Snapshots are not copied.
+         */
+        PatientSnapshot(const PatientSnapshot &other) = delete;
+
+        /**
+         * @brief Snapshots are not copied.
+         */
+        PatientSnapshot &operator=(const PatientSnapshot &other) = delete;
+
+        /**
+         * @brief Opens and checks a snapshot file, closing the file open before.
+         * @param path The path of the file.
+         * @return true if the file is a valid snapshot, false otherwise.
+         */
+        bool open(const std::string &path);
+
+        /**
+         * @brief Closes the file, invalidating the records handed out.
+         */
+        void close();
+
+        /**
+         * @brief Gets the header of the open snapshot.
+         * @return Reference to the header.
+         */
+        const SnapshotHeader &getHeader();
+
+        /**
+         * @brief Gets the patient records, in ID order.
+         * @return Pointer to the first of getHeader().patientCount records.
+         */
+        const SnapshotPatient *getPatients();
+
+        /**
+         * @brief Gets the treatment records.
+         * @return Pointer to the first of getHeader().treatmentCount records.
+         */
+        const SnapshotTreatment *getTreatments();
+
+        /**
+         * @brief Gets the admission and discharge dates.
+         * @return Pointer to the first of getHeader().dateCount day ordinals.
+         */
+        const int32_t *getDates();
+
+        /**
+         * @brief Gets a string of the snapshot.
+         * @param index The index of the string.
+         * @return View of the string inside the file.
+         */
+        std::string_view getString(uint32_t index);
+
+    private:
+        const char *data;             /**< The contents of the file, or nullptr */
+        size_t size;                  /**< The size of the file */
+        bool mapped;                  /**< Whether data is a memory mapping rather than the buffer */
+        std::vector<uint64_t> buffer; /**< The contents of the file where it cannot be mapped, 8 byte aligned */
+
+        /**
+         * @brief Checks the header and the records of the open file.
+         * @return true if the file is a valid snapshot, false otherwise.
+         */
+        bool validate();
+
+        /**
+         * @brief Checks that a section lies within the file and is aligned for its records.
+         * @param offset The offset of the section.
+         * @param count The number of records.
+         * @param recordSize The size of a record.
+         * @return true if the section is valid, false otherwise.
+         */
+        bool validSection(uint64_t offset, uint64_t count, uint64_t recordSize);
+    };
+
+    /**
+     * @brief Class writing the patients to a snapshot file, in the layout read by PatientSnapshot.
+     */
+    class PatientSnapshotWriter
+    {
+    public:
+        /**
+         * @brief Constructs a writer holding no patient.
+         */
+        PatientSnapshotWriter();
+
+        /**
+         * @brief Adds a patient. Patients must be added in ID order.
+         * @param patient The patient.
+         */
+        void addPatient(Patient &patient);
+
+        /**
+         * @brief Writes the patients added so far to a file. The file is written under a temporary name first,
+         * so an existing snapshot is only replaced by a complete one.
+         * @param path The path of the file.
+         * @param idIndex The last patient ID generated.
+         * @return true if the file was written, false otherwise.
+         */
+        bool save(const std::string &path, int idIndex);
+
+    private:
+        std::vector<SnapshotPatient> patients;               /**< The patient records */
+        std::vector<SnapshotTreatment> treatments;           /**< The treatment records */
+        std::vector<int32_t> dates;                          /**< The admission and discharge dates */
+        std::vector<SnapshotString> strings;                 /**< The string records */
+        std::string stringData;                              /**< The characters of the strings */
+        List::HashMap<List::Symbol, uint32_t> stringIndexes; /**< Index of each interned string in the string records */
+
+        /**
+         * @brief Gets the index of a string, adding the string if it is new.
+         * @param symbol The symbol of the string in the global string pool.
+         * @return The index of the string.
+         */
+        uint32_t addString(List::Symbol symbol);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <vector>
+#include "structs/bPlusTree.h"
+#include "cores/patient.h"
+
+namespace HMS
+{
+    /**
+     * @brief Enumeration for the orders patients can be listed in.
+     */
+    enum PatientOrder
+    {
+        OrderByAppointment, /**< Latest ongoing appointment first, as Patient::compareTreatmentAppointment */
+        OrderByDayOfStay,   /**< Shortest stay first, as Patient::compareTreatmentDayOfStay */
+        OrderByPriority     /**< Highest priority first, as Patient::compareTreatmentPriority */
+    };
+
+    /**
+     * @brief Number of patient orders.
+     */
+    const int PatientOrderSize = OrderByPriority + 1;
+
+    /**
+     * @brief Key of a patient in a sort index: the patient's sort key, then its ID, so equal keys keep ID order.
+     */
+    struct PatientOrderKey
+    {
+        long long key; /**< The sort key of the patient under the order */
+        int id;        /**< The ID of the patient */
+
+        /**
+         * @brief Less than operator ordering by sort key, then by ID.
+         * @param other The other key to compare.
+         * @return True if this key comes first, false otherwise.
+         */
+        bool operator<(const PatientOrderKey &other) const
+        {
+            return key < other.key || (key == other.key && id < other.id);
+        };
+    };
+
+    /**
+     * @brief Class keeping the patients ordered by each PatientOrder, one B+ tree per order.
+     * A patient's entries move in O(log n) when its latest treatment changes, and an in-order walk of a tree
+     * lists the patients in the same order as a stable sort of the ID ordered list, without sorting.
+     */
+    class PatientSortIndex
+    {
+    public:
+        /**
+         * @brief Constructs an empty index.
+         */
+        PatientSortIndex();
+
+        /**
+         * @brief Resets the index to an empty state.
+         */
+        void reset();
+
+        /**
+         * @brief Adds a patient, or moves it after its treatments changed. Orders whose key did not change are not touched.
+         * @param patient The patient, which must stay at the same address while indexed.
+         */
+        void update(Patient &patient);
+
+        /**
+         * @brief Removes a patient.
+         * @param id The ID of the patient.
+         * @return true if the patient was indexed, false otherwise.
+         */
+        bool remove(int id);
+
+        /**
+         * @brief Replaces the index with a set of patients, building each tree bottom up from its keys, radix sorted,
+         * instead of inserting the patients one by one.
+         * @param patients The patients in ID order, which must stay at the same addresses while indexed.
+         * @param count The number of patients.
+         */
+        void bulkLoad(Patient *patients[], int count);
+
+        /**
+         * @brief Gets the number of indexed patients.
+         * @return The size of the index.
+         */
+        int getSize();
+
+        /**
+         * @brief Returns an iterator over every patient in an order.
+         * @param order The order.
+         * @return An iterator over pointers to the patients.
+         */
+        BPlusTreeIterator<PatientOrderKey, Patient *> iterate(PatientOrder order);
+
+        /**
+         * @brief Computes the sort key of a patient under an order.
+         * @param patient The patient.
+         * @param order The order.
+         * @return The sort key.
+         */
+        static long long key(Patient &patient, PatientOrder order);
+
+    private:
+        /**
+         * @brief The sort keys a patient is indexed under.
+         */
+        struct Entry
+        {
+            long long keys[PatientOrderSize]; /**< The sort key under each order */
+        };
+
+        BPlusTree<PatientOrderKey, Patient *> orders[PatientOrderSize]; /**< The patients in each order */
+        BPlusTree<int, Entry> entries;                                  /**< The sort keys of each indexed patient ID, bulk loaded with the orders */
+    };
+}
\ No newline at end of file
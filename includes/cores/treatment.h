@@ -1,5 +1,6 @@
 #include <iostream>
 #include "handlers/inputHandler.h"
+#include "structs/stringPool.h"
 
 namespace HMS
 {
@@ -50,21 +51,33 @@ namespace HMS
 
         /**
          * @brief Sets the type of the treatment when it is of type Other.
-         * @param treatment The string describing the other treatment type.
+         * @param treatment The string describing the other treatment type, interned in the global string pool.
          */
         void setOtherTreatmentType(std::string treatment);
 
         /**
          * @brief Gets the type of the treatment when it is of type Other.
-         * @return The string describing the other treatment type.
+         * @return Reference to the string describing the other treatment type.
          */
-        std::string getOtherTreatmentType();
+        const std::string &getOtherTreatmentType();
+
+        /**
+         * @brief Gets the interned type of the treatment when it is of type Other.
+         * @return The symbol of the other treatment type.
+         */
+        List::Symbol getOtherTreatmentTypeSymbol();
+
+        /**
+         * @brief Sets the description for 'Other' treatment type from a string already interned in the global string pool.
+         * @param treatment The symbol of the description.
+         */
+        void setOtherTreatmentTypeSymbol(List::Symbol treatment);
 
         /**
          * @brief Gets the formatted treatment type as a string.
-         * @return The formatted treatment type.
+         * @return Reference to the formatted treatment type.
          */
-        std::string getFormattedTreatmentType();
+        const std::string &getFormattedTreatmentType();
 
         /**
          * @brief Sets the appointment date for the treatment.
@@ -157,7 +170,7 @@ namespace HMS
 
     private:
         TreatmentType type;        /**< The type of the treatment */
-        std::string otherType;     /**< The description for 'Other' treatment type */
+        List::Symbol otherType;    /**< The description for 'Other' treatment type, interned in the global string pool */
         Handler::Date appointment; /**< The appointment date for the treatment */
         int dayOfStay;             /**< The number of days of stay for the treatment */
         int priority;              /**< The priority of the treatment */
@@ -1,7 +1,8 @@
 #pragma once
 
 #include <iostream>
-#include "structs/orderedLinkedList.h"
+#include "structs/unrolledList.h"
+#include "structs/skipList.h"
 
 using ErrorCode = int;
 
@@ -115,7 +116,7 @@ namespace Handler
         void registerErrorMessage(int prefix, const std::string errorMessages[], int errorMessagesSize);
 
     private:
-        OrderedLinkedList<ErrorStruct> registers; /**< List of registered error messages */
-        LinkedList<ErrorStruct> errors;           /**< List of current errors */
+        SkipList<ErrorStruct> registers;          /**< List of registered error messages, ordered by code */
+        UnrolledList<ErrorStruct> errors;         /**< List of current errors, read back by index */
     };
 }
@@ -2,17 +2,111 @@
 
 #include "handlers/errorHandler.h"
 #include <iostream>
+#include <string>
 
 namespace Handler
 {
+    /**
+     * @brief Number of days in each month, for common and leap years.
+     */
+    constexpr int DaysInMonth[2][13] = {
+        {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+        {0, 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}};
+
+    /**
+     * @brief Number of days in a year before the first day of each month, for common and leap years.
+     */
+    constexpr int DaysBeforeMonth[2][14] = {
+        {0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},
+        {0, 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366}};
+
+    /**
+     * @brief Checks if a year is a leap year in the Gregorian calendar.
+     * @param year The year to check.
+     * @return True if the year is a leap year, false otherwise.
+     */
+    constexpr bool isLeapYear(int year)
+    {
+        return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+    }
+
+    /**
+     * @brief Counts the days from 01/01/0001 up to, but not including, 01/01 of a year.
+     * @param year The year, from 1.
+     * @return The number of days.
+     */
+    constexpr int daysBeforeYear(int year)
+    {
+        int previous = year - 1;
+        return previous * 365 + previous / 4 - previous / 100 + previous / 400;
+    }
+
+    /**
+     * @brief Converts a calendar date to its day ordinal, 01/01/0001 being day 1.
+     * @param day The day of the month.
+     * @param month The month of the year.
+     * @param year The year, from 1.
+     * @return The day ordinal, or 0 for the empty date 00/00/0000.
+     */
+    constexpr int toOrdinal(int day, int month, int year)
+    {
+        if (month < 1 || month > 12 || year < 1)
+        {
+            return 0;
+        }
+        return daysBeforeYear(year) + DaysBeforeMonth[isLeapYear(year)][month] + day;
+    }
+
     /**
      * @brief Structure to represent a date.
+     * The date is stored as a single day ordinal, so comparing two dates or counting the days between them
+     * is one integer operation; day, month and year are derived from it when needed.
      */
     struct Date
     {
-        int day;   /**< Day of the month */
-        int month; /**< Month of the year */
-        int year;  /**< Year */
+        /**
+         * @brief Constructs the empty date 00/00/0000, earlier than any other date.
+         */
+        Date();
+
+        /**
+         * @brief Constructs a date from its calendar fields, allowing `Date date = {day, month, year};`.
+         * @param day The day of the month.
+         * @param month The month of the year.
+         * @param year The year.
+         */
+        Date(int day, int month, int year);
+
+        /**
+         * @brief Gets the day of the month.
+         * @return The day, or 0 for the empty date.
+         */
+        int getDay();
+
+        /**
+         * @brief Gets the month of the year.
+         * @return The month, or 0 for the empty date.
+         */
+        int getMonth();
+
+        /**
+         * @brief Gets the year.
+         * @return The year, or 0 for the empty date.
+         */
+        int getYear();
+
+        /**
+         * @brief Gets the day ordinal of the date.
+         * @return The number of days since 31/12/0000, or 0 for the empty date.
+         */
+        int getOrdinal();
+
+        /**
+         * @brief Constructs a date from its day ordinal.
+         * @param ordinal The number of days since 31/12/0000, or 0 for the empty date.
+         * @return The date.
+         */
+        static Date fromOrdinal(int ordinal);
 
         /**
          * @brief Equality operator to compare two dates.
@@ -29,38 +123,72 @@ namespace Handler
         bool operator!=(const Date &other);
 
         /**
-         * @brief Less than operator to compare two dates.
+         * @brief Less than operator to compare two dates. Dates are ordered latest first.
          * @param other The other date to compare.
-         * @return True if this date is earlier than the other, false otherwise.
+         * @return True if this date is later than the other, false otherwise.
          */
         bool operator<(const Date &other);
 
         /**
-         * @brief Less than or equal operator to compare two dates.
+         * @brief Less than or equal operator to compare two dates. Dates are ordered latest first.
          * @param other The other date to compare.
-         * @return True if this date is earlier than or the same as the other, false otherwise.
+         * @return True if this date is later than or the same as the other, false otherwise.
          */
         bool operator<=(const Date &other);
 
         /**
-         * @brief Greater than operator to compare two dates.
+         * @brief Greater than operator to compare two dates. Dates are ordered latest first.
          * @param other The other date to compare.
-         * @return True if this date is later than the other, false otherwise.
+         * @return True if this date is earlier than the other, false otherwise.
          */
         bool operator>(const Date &other);
 
         /**
-         * @brief Greater than or equal operator to compare two dates.
+         * @brief Greater than or equal operator to compare two dates. Dates are ordered latest first.
          * @param other The other date to compare.
-         * @return True if this date is later than or the same as the other, false otherwise.
+         * @return True if this date is earlier than or the same as the other, false otherwise.
          */
         bool operator>=(const Date &other);
 
+        /**
+         * @brief Counts the days from another date to this one.
+         * @param other The other date.
+         * @return The number of days, negative if this date is earlier.
+         */
+        int operator-(const Date &other);
+
+        /**
+         * @brief Writes the date as DD/MM/YYYY into a buffer, without allocating.
+         * @param buffer The buffer, at least 11 characters long; it receives a null terminated string.
+         */
+        void format(char *buffer);
+
         /**
          * @brief Gets the date as a formatted string.
          * @return The formatted date string.
          */
         std::string getFormattedDate();
+
+        /**
+         * @brief Counts the dates of an array that fall within a range, comparing four at a time with SSE2 where available.
+         * @param dates The dates.
+         * @param count The number of dates.
+         * @param first The earliest date of the range, included.
+         * @param last The latest date of the range, included.
+         * @return The number of dates within the range, 0 if the range ends before it starts.
+         */
+        static int countInRange(const Date *dates, int count, Date first, Date last);
+
+    private:
+        int ordinal; /**< Days since 31/12/0000, 0 for the empty date */
+
+        /**
+         * @brief Splits the ordinal into its calendar fields.
+         * @param day Receives the day of the month.
+         * @param month Receives the month of the year.
+         * @param year Receives the year.
+         */
+        void split(int &day, int &month, int &year);
     };
 
     extern const int InputErrorPrefix; /**< Prefix for input error codes */
@@ -2,7 +2,19 @@
 
 #include "handlers/errorHandler.h"
 #include "structs/linkedList.h"
+#include "structs/view.h"
+#include "structs/skipList.h"
+#include "structs/bPlusTree.h"
+#include "structs/hashMap.h"
+#include "structs/radixTrie.h"
+#include "structs/roaringBitmap.h"
+#include "structs/indexedHeap.h"
+#include "structs/concurrentQueue.h"
+#include <atomic>
+#include <string>
 #include "cores/patient.h"
+#include "cores/patientQuery.h"
+#include "cores/patientSortIndex.h"
 #include "cores/client.h"
 
 // Forward declaration
@@ -21,8 +33,10 @@ namespace Manager
         AddPatient = 1,    /**< Option to add a new patient */
         ViewPatient,       /**< Option to view a patient */
         SearchPatient,     /**< Option to search for a patient */
-        SortPatient,       /**< Option to sort patients */
-        ExitManagePatients /**< Option to exit patient management */
+        SortPatient,        /**< Option to sort patients */
+        ExitManagePatients, /**< Option to exit patient management */
+        NextPatientPage,    /**< Option to show the next page of patients */
+        PreviousPatientPage /**< Option to show the previous page of patients */
     };
 
     /**
@@ -30,9 +44,14 @@ namespace Manager
      */
     enum OptionsManageSearchPatient
     {
-        SearchByName = 1,     /**< Option to search patient by name */
-        SearchByStatus,       /**< Option to search patient by status */
-        SearchByTreatmentType /**< Option to search patient by treatment type */
+        SearchByName = 1,               /**< Option to search patient by name */
+        SearchByStatus,                 /**< Option to search patient by status */
+        SearchByTreatmentType,          /**< Option to search patient by treatment type */
+        SearchByNameIgnoreCase,         /**< Option to search patient by name, ignoring case */
+        SearchByStatusAndTreatmentType, /**< Option to search patient by both status and treatment type */
+        SearchByQuery,                  /**< Option to search patient by a query combining criteria */
+        NextSearchPage,                 /**< Option to show the next page of patients */
+        PreviousSearchPage              /**< Option to show the previous page of patients */
     };
 
     /**
@@ -42,7 +61,9 @@ namespace Manager
     {
         SortByAppointment = 1, /**< Option to sort by appointment */
         SortByLengthOfStay,    /**< Option to sort by length of stay */
-        SortByPriority         /**< Option to sort by priority */
+        SortByPriority,        /**< Option to sort by priority */
+        NextSortPage,          /**< Option to show the next page of patients */
+        PreviousSortPage       /**< Option to show the previous page of patients */
     };
 
     /**
@@ -91,9 +112,15 @@ namespace Manager
         PATIENT_ID_NOT_FOUND,   /**< Patient ID not found */
         PATIENT_NAME_NOT_FOUND, /**< Patient name not found */
         PATIENT_LIST_EMPTY,     /**< Patient list is empty */
-        TREATMENT_LIST_EMPTY    /**< Treatment list is empty */
+        TREATMENT_LIST_EMPTY,   /**< Treatment list is empty */
+        INVALID_QUERY,          /**< Search query is not valid */
+        SNAPSHOT_NOT_SAVED,     /**< Snapshot file cannot be written */
+        SNAPSHOT_NOT_LOADED     /**< Snapshot file cannot be read or is not valid */
     };
 
+    extern const int AdmissionQueueCapacity; /**< Number of admissions that can wait to be added to the patient list */
+    extern const int QueryCacheCapacity;     /**< Number of compiled queries kept before the cache is emptied */
+
     extern const std::string PatientManagerErrorMessage[]; /**< Array of patient manager error messages */
     extern const int PatientManagerErrorMessageSize;       /**< Size of the patient manager error message array */
 
@@ -115,34 +142,36 @@ namespace Manager
         void managePatients();
 
         /**
-         * @brief Prints the list of patients.
+         * @brief Prints a page of the list of patients. Only the rows up to the end of the page are visited.
+         * @param page The page to print, from 0.
          */
-        void printPatientList();
+        void printPatientList(int page);
 
         /**
-         * @brief Prints a given list of patients.
-         * @param patientList The list of patients to print.
+         * @brief Prints a page of a given view of patients. Only the rows of the page are visited.
+         * @param patientList The view of patients to print.
+         * @param page The page to print, from 0.
          */
-        void printPatientList(LinkedList<HMS::Patient> patientList);
+        void printPatientList(View<HMS::Patient> &patientList, int page);
 
         /**
          * @brief Prints details of a patient.
          * @param patient The patient whose details are to be printed.
          */
-        void printPatientDetails(HMS::Patient patient);
+        void printPatientDetails(HMS::Patient &patient);
 
         /**
          * @brief Prints details of a patient including their latest treatment.
          * @param patient The patient whose details are to be printed.
          * @param latestTreatment The latest treatment of the patient.
          */
-        void printPatientDetails(HMS::Patient patient, HMS::Treatment latestTreatment);
+        void printPatientDetails(HMS::Patient &patient, HMS::Treatment &latestTreatment);
 
         /**
          * @brief Prints the list of treatments for a patient.
          * @param patient The patient whose treatment list is to be printed.
          */
-        void printTreatmentList(HMS::Patient patient);
+        void printTreatmentList(HMS::Patient &patient);
 
         /**
          * @brief Prints details of a treatment.
@@ -150,6 +179,35 @@ namespace Manager
          */
         void printTreatmentDetails(HMS::Treatment treatment);
 
+        /**
+         * @brief Prompts for a file and saves every patient to it as a snapshot.
+         */
+        void promptSaveSnapshot();
+
+        /**
+         * @brief Prompts for a snapshot file and replaces every patient with the patients saved in it.
+         */
+        void promptLoadSnapshot();
+
+        /**
+         * @brief Saves every patient, with their treatments, admissions and discharges, to a snapshot file.
+         * See HMS::PatientSnapshot for the layout.
+         * @param path The path of the file.
+         * @return Error code indicating success or type of error.
+         */
+        ErrorCode saveSnapshot(const std::string &path);
+
+        /**
+         * @brief Replaces every patient with the patients of a snapshot file. The file is mapped and its records read
+         * in place; the list is appended to in ID order without searching, each patient is indexed as it is stored and
+         * the ordered indexes are built bottom up. Admissions still queued are added first and replaced like every
+         * other patient, and IDs generated afterwards are past those of both the snapshot and the replaced patients.
+         * Nothing changes if the file is not a valid snapshot.
+         * @param path The path of the file.
+         * @return Error code indicating success or type of error.
+         */
+        ErrorCode loadSnapshot(const std::string &path);
+
         /**
          * @brief Gets the current patient ID index.
          * @return The current patient ID index.
@@ -168,6 +226,28 @@ namespace Manager
          */
         void addPatient(HMS::Patient &patient);
 
+        /**
+         * @brief Adds a patient to the patient list, moving its record and history instead of copying them.
+         * @param patient The patient to move into the list.
+         */
+        void addPatient(HMS::Patient &&patient);
+
+        /**
+         * @brief Queues a patient for admission. Safe to call from any thread, e.g. intake terminals,
+         * while the menu thread keeps using the patient list; the patient is added on the next drainAdmissions().
+         * Generate its ID with generatePatientId(), which is also thread safe.
+         * @param patient The patient to move into the queue. It is left untouched if the queue is full.
+         * @return true if the patient was queued, false if the admission queue is full.
+         */
+        bool submitAdmission(HMS::Patient &&patient);
+
+        /**
+         * @brief Adds queued admissions to the patient list. Must be called from the thread owning the patient list.
+         * @param maxCount The maximum number of admissions to add.
+         * @return The number of patients added.
+         */
+        int drainAdmissions(int maxCount = AdmissionQueueCapacity);
+
         /**
          * @brief Gets the number of patients.
          * @return The number of patients.
@@ -202,6 +282,138 @@ namespace Manager
          */
         Iterator<HMS::Patient> getPatientListIterator();
 
+        /**
+         * @brief Gets an iterator over the patients with IDs in a range, in ID order.
+         * @param firstId The first ID of the range.
+         * @param lastId The last ID of the range.
+         * @return Iterator over pointers to the patients in the range.
+         */
+        BPlusTreeIterator<int, HMS::Patient *> getPatientRangeIterator(int firstId, int lastId);
+
+        /**
+         * @brief Finds the patients with a name, or with names starting with a prefix, in ID order.
+         * Uses the name index, so the cost depends on the length of the name and the number of matches,
+         * not on the number of patients.
+         * @param patients Reference to the view receiving the matching patients.
+         * @param name The name, or the prefix of the names, to look for.
+         * @param prefix Whether to match every name starting with `name` rather than `name` only.
+         * @param ignoreCase Whether to ignore the case of ASCII letters.
+         * @return The number of matching patients.
+         */
+        int searchPatientsByName(View<HMS::Patient> &patients, std::string name, bool prefix, bool ignoreCase);
+
+        /**
+         * @brief Gets the compiled query of a text. A text is parsed and compiled the first time it is searched,
+         * later searches reuse the cached query.
+         * @param text The text of the query.
+         * @param query Receives the cached query, valid until the next call.
+         * @return Error code indicating success or type of error.
+         */
+        ErrorCode getQuery(const std::string &text, HMS::PatientQuery *&query);
+
+        /**
+         * @brief Finds the patients matching a query in a single pass over the patient list, in ID order.
+         * Each match is handed to `visit` as it is found; nothing is collected in between.
+         * @tparam F The type of the visitor, called as visit(HMS::Patient &).
+         * @param query The query, compiled if its program is not up to date.
+         * @param visit Function called with each matching patient.
+         * @return The number of matching patients.
+         */
+        template <class F>
+        int queryPatients(HMS::PatientQuery &query, F visit);
+
+        /**
+         * @brief Gets an iterator over every patient in an order, read off the sort index without sorting.
+         * @param order The order.
+         * @return Iterator over pointers to the patients.
+         */
+        BPlusTreeIterator<HMS::PatientOrderKey, HMS::Patient *> getSortedPatientIterator(HMS::PatientOrder order);
+
+        /**
+         * @brief Orders a view of patients, stably. A view of every patient in ID order is rebuilt from the sort index
+         * in O(n); other views, e.g. search results or an already sorted list, are sorted by the same keys.
+         * @param patients Reference to the view to reorder.
+         * @param order The order.
+         */
+        void sortPatients(View<HMS::Patient> &patients, HMS::PatientOrder order);
+
+        /**
+         * @brief Brings everything derived from a patient's status and treatments up to date after they changed:
+         * its place in the triage queue and the sort indexes, and its bits in the filters.
+         * @param patient The patient to update.
+         */
+        void refreshPatient(HMS::Patient &patient);
+
+        /**
+         * @brief Brings a patient's bits in the status and treatment type filters up to date after its status or treatments changed.
+         * @param patient The patient to update.
+         */
+        void updateFilters(HMS::Patient &patient);
+
+        /**
+         * @brief Gets the IDs of the patients with a status.
+         * @param status The status.
+         * @return Reference to the bitmap of patient IDs.
+         */
+        RoaringBitmap &getStatusFilter(HMS::PatientStatus status);
+
+        /**
+         * @brief Gets the IDs of the patients whose latest treatment has a type.
+         * @param treatmentType The treatment type.
+         * @return Reference to the bitmap of patient IDs.
+         */
+        RoaringBitmap &getTreatmentTypeFilter(HMS::TreatmentType treatmentType);
+
+        /**
+         * @brief Gets the number of patients with a status in O(1).
+         * @param status The status.
+         * @return The number of patients.
+         */
+        int getPatientCount(HMS::PatientStatus status);
+
+        /**
+         * @brief Gets the number of patients whose latest treatment has a type in O(1).
+         * @param treatmentType The treatment type.
+         * @return The number of patients.
+         */
+        int getPatientCount(HMS::TreatmentType treatmentType);
+
+        /**
+         * @brief Gets the number of patients with a status whose latest treatment has a type, by intersecting their filters.
+         * @param status The status.
+         * @param treatmentType The treatment type.
+         * @return The number of patients.
+         */
+        int getPatientCount(HMS::PatientStatus status, HMS::TreatmentType treatmentType);
+
+        /**
+         * @brief Adds the patients of a filter to a view, in ID order.
+         * @param patients Reference to the view receiving the patients.
+         * @param filter The bitmap of patient IDs.
+         * @return The number of patients added.
+         */
+        int collectPatients(View<HMS::Patient> &patients, RoaringBitmap &filter);
+
+        /**
+         * @brief Brings a patient's place in the triage queue up to date after its status or treatments changed.
+         * Admitted patients with an ongoing treatment are queued by the priority of that treatment, others are removed.
+         * @param patient The patient to update.
+         */
+        void updateTriage(HMS::Patient &patient);
+
+        /**
+         * @brief Checks if a patient belongs in the triage queue: admitted, with an ongoing latest treatment.
+         * @param patient The patient to check.
+         * @return The ongoing treatment, or nullptr if the patient is not waiting to be treated.
+         */
+        HMS::Treatment *getTriageTreatment(HMS::Patient &patient);
+
+        /**
+         * @brief Gets the patient to treat next: the admitted patient whose ongoing treatment has the highest priority.
+         * @return Pointer to the patient, or nullptr if no patient is waiting.
+         */
+        HMS::Patient *getNextTriagePatient();
+
         /**
          * @brief Gets the error code for a specific patient manager error.
          * @param error The patient manager error.
@@ -217,20 +429,78 @@ namespace Manager
 
     private:
         HMS::Client &client;                  /**< Reference to the client */
-        OrderedLinkedList<HMS::Patient> patientList; /**< List of patients */
-        int idIndex;                          /**< Current patient ID index */
+        SkipList<HMS::Patient> patientList;                /**< List of patients, ordered by ID */
+        BPlusTree<int, HMS::Patient *> patientIndex;       /**< Ordered index from patient ID to the patient in patientList, for range scans */
+        HashMap<int, HMS::Patient *> patientLookup;        /**< Hashed index from patient ID to the patient in patientList, for point lookups */
+        RadixTrie<HMS::Patient *> nameIndex;               /**< Patients by lower-cased name */
+        std::vector<RoaringBitmap> statusFilters;          /**< IDs of the patients with each status */
+        std::vector<RoaringBitmap> treatmentTypeFilters;   /**< IDs of the patients by the type of their latest treatment */
+        HMS::PatientSortIndex sortIndex;                   /**< Patients in each sort order of their latest treatment */
+        IndexedHeap<int, int, 4, std::greater<int>> triageQueue; /**< Patient IDs by the priority of their ongoing treatment, highest first */
+        ConcurrentQueue<HMS::Patient> admissionQueue;     /**< Patients submitted by other threads, waiting to be added */
+        std::atomic<int> idIndex;             /**< Current patient ID index */
+        HashMap<std::string, HMS::PatientQuery> queryCache; /**< Compiled queries by their text */
 
         /**
          * @brief Manages the search operation for patients.
-         * @param patientList Reference to the patient list.
+         * @param patientList Reference to the view receiving the matching patients.
          */
-        void manageSearchPatient(LinkedList<HMS::Patient> &patientList);
+        void manageSearchPatient(View<HMS::Patient> &patientList);
+
+        /**
+         * @brief Lower-cases the ASCII letters of a name, giving its key in the name index.
+         * @param name The name.
+         * @return The key of the name.
+         */
+        static std::string nameKey(std::string name);
+
+        /**
+         * @brief Removes every patient from the list and from everything derived from it.
+         */
+        void clearPatients();
+
+        /**
+         * @brief Clears a patient's bits in the status and treatment type filters.
+         * @param id The ID of the patient.
+         */
+        void clearFilters(int id);
+
+        /**
+         * @brief Prompts the user to choose a status to search for.
+         * @param status Receives the status.
+         * @return Error code indicating success or type of error.
+         */
+        ErrorCode promptSearchStatus(HMS::PatientStatus &status);
+
+        /**
+         * @brief Prompts the user to choose a treatment type to search for, and the name of an other treatment type.
+         * @param treatmentType Receives the treatment type.
+         * @param formattedTreatmentType Receives the formatted treatment type to match.
+         * @return Error code indicating success or type of error.
+         */
+        ErrorCode promptSearchTreatmentType(HMS::TreatmentType &treatmentType, std::string &formattedTreatmentType);
 
         /**
          * @brief Manages the sort operation for patients.
-         * @param patientList Reference to the patient list.
+         * @param patientList Reference to the view to reorder.
          */
-        void manageSortPatient(LinkedList<HMS::Patient> &patientList);
+        void manageSortPatient(View<HMS::Patient> &patientList);
+
+        /**
+         * @brief Prints the patient to treat next, if any.
+         */
+        void printNextTriagePatient();
+
+        /**
+         * @brief Prints the column header of a patient list.
+         */
+        void printPatientListHeader();
+
+        /**
+         * @brief Prints a single row of a patient list.
+         * @param patient The patient to print.
+         */
+        void printPatientRow(HMS::Patient &patient);
 
         /**
          * @brief Edits a patient's details.
@@ -294,3 +564,5 @@ namespace Manager
         void promptTreatmentPriority(HMS::Treatment &treatment);
     };
 };
+
+#include "managers/patientManager.hpp"
\ No newline at end of file
@@ -0,0 +1,19 @@
+#include "managers/patientManager.h"
+
+using namespace Manager;
+
+template <class F>
+int PatientManager::queryPatients(HMS::PatientQuery &query, F visit)
+{
+    query.compile();
+    int count = 0;
+    for (HMS::Patient &patient : this->patientList)
+    {
+        if (query.matches(patient))
+        {
+            visit(patient);
+            count++;
+        }
+    }
+    return count;
+}
\ No newline at end of file
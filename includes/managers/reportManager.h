@@ -35,6 +35,16 @@ namespace Manager
         ExitManageReport           /**< Option to exit report management */
     };
 
+    /**
+     * @brief Enumeration for options to choose the patient of a report.
+     */
+    enum OptionsChooseReportPatient
+    {
+        ChooseReportPatient = 1, /**< Option to choose a patient by ID */
+        NextReportPage,          /**< Option to show the next page of patients */
+        PreviousReportPage       /**< Option to show the previous page of patients */
+    };
+
     extern const int ReportManagerErrorPrefix; /**< Prefix for report manager error codes */
 
     /**
@@ -81,5 +91,11 @@ namespace Manager
 
     private:
         HMS::Client &client; /**< Reference to the client */
+
+        /**
+         * @brief Prints how many patients of a summary list were left out, when it takes more than one page.
+         * @param patientCount The number of patients in the list.
+         */
+        void printMorePatients(int patientCount);
     };
 }
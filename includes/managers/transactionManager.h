@@ -1,7 +1,8 @@
 #pragma once
 
 #include <iostream>
-#include "structs/queue.h"
+#include "structs/intrusiveList.h"
+#include "structs/priorityQueue.h"
 #include "cores/client.h"
 #include "cores/patient.h"
 
@@ -18,9 +19,11 @@ namespace Manager
      */
     enum OptionsManageTransaction
     {
-        DischargePatient = 1, /**< Option to discharge a patient */
-        SortTransaction,      /**< Option to sort transactions */
-        ExitManageTransaction /**< Option to exit transaction management */
+        DischargePatient = 1,   /**< Option to discharge a patient */
+        SortTransaction,        /**< Option to sort transactions */
+        ExitManageTransaction,  /**< Option to exit transaction management */
+        NextTransactionPage,    /**< Option to show the next page of transactions */
+        PreviousTransactionPage /**< Option to show the previous page of transactions */
     };
 
     /**
@@ -47,6 +50,26 @@ namespace Manager
     extern const std::string TransactionManagerErrorMessage[]; /**< Array of transaction manager error messages */
     extern const int TransactionManagerErrorMessageSize;       /**< Size of the transaction manager error message array */
 
+    /**
+     * @brief Entry of the discharge queue: a patient with its sort key under the chosen ordering.
+     */
+    struct DischargeEntry
+    {
+        long long key;         /**< Sort key of the patient under the chosen ordering */
+        int arrival;           /**< Position of the patient in the transaction list */
+        HMS::Patient *patient; /**< The patient to discharge */
+
+        /**
+         * @brief Less than operator ordering entries by key, then first come first served.
+         * @param other The other entry to compare.
+         * @return True if this entry is discharged before the other, false otherwise.
+         */
+        bool operator<(const DischargeEntry &other) const
+        {
+            return key < other.key || (key == other.key && arrival < other.arrival);
+        };
+    };
+
     /**
      * @brief Class to manage transactions.
      */
@@ -70,7 +93,8 @@ namespace Manager
         void manageSortTransaction();
 
         /**
-         * @brief Prints the list of transactions.
+         * @brief Prints the current page of the list of transactions, in order of discharge.
+         * Only the rows up to the end of the page are selected from the discharge queue.
          */
         void printTransactionList();
 
@@ -89,11 +113,25 @@ namespace Manager
 
     private:
         HMS::Client &client;                 /**< Reference to the client */
-        Queue<HMS::Patient> transactionList; /**< Queue of patient transactions */
+        IntrusiveList<HMS::Patient, &HMS::Patient::transactionHook> transactionList; /**< The admitted patients in order of arrival, linked in place */
+        PriorityQueue<DischargeEntry> dischargeQueue;                                /**< The admitted patients in order of discharge */
+        int page;                                                                    /**< The page of the transaction list shown, from 0 */
 
         /**
          * @brief Resets the transaction list.
          */
         void resetTransactionList();
+
+        /**
+         * @brief Rebuilds the discharge queue from the transaction list in O(n), in order of arrival, and shows its first page.
+         */
+        void orderTransactionList();
+
+        /**
+         * @brief Rebuilds the discharge queue in O(n) from the patient manager's sort index, keeping the patients
+         * of the transaction list, and shows its first page.
+         * @param order The chosen ordering.
+         */
+        void orderTransactionList(HMS::PatientOrder order);
     };
 }
@@ -0,0 +1,42 @@
+#pragma once
+
+namespace List
+{
+    /**
+     * @brief Iterator class for a contiguous array list.
+     * Mirrors the interface of Iterator<T> so callers can walk either container the same way.
+     * @tparam T The type of data stored in the array list.
+     */
+    template <class T>
+    class ArrayIterator
+    {
+    public:
+        /**
+         * @brief Constructs an iterator over the range [first, last).
+         * @param first Pointer to the first element.
+         * @param last Pointer one past the last element.
+         */
+        ArrayIterator(T *first, T *last);
+
+        /**
+         * @return true if there is a next element, false otherwise.
+         */
+        bool hasNext();
+
+        /**
+         * @return Pointer to the current element, or nullptr once the range is exhausted.
+         */
+        T *getData();
+
+        /**
+         * @brief The `next` method advances the iterator to the next element in the array.
+         */
+        void next();
+
+    private:
+        T *current; /**< The element the iterator is positioned on */
+        T *last;    /**< One past the final element of the range */
+    };
+}
+
+#include "structs/arrayIterator.hpp"
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "structs/arrayIterator.h"
+
+using namespace List;
+
+template <class T>
+ArrayIterator<T>::ArrayIterator(T *first, T *last) : current(first), last(last){};
+
+template <class T>
+bool ArrayIterator<T>::hasNext()
+{
+    return this->current != this->last && this->current + 1 != this->last;
+}
+
+template <class T>
+T *ArrayIterator<T>::getData()
+{
+    if (this->current == this->last)
+    {
+        return nullptr;
+    }
+    return this->current;
+}
+
+template <class T>
+void ArrayIterator<T>::next()
+{
+    this->current++;
+}
\ No newline at end of file
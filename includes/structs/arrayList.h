@@ -0,0 +1,187 @@
+#pragma once
+
+#include <vector>
+#include "structs/arrayIterator.h"
+#include "structs/sortKey.h"
+#include "structs/parallelSort.h"
+
+namespace List
+{
+    /**
+     * @brief Template class representing a list stored in one contiguous block of memory.
+     * Offers the same interface as LinkedList<T>, but appending is amortized O(1),
+     * indexing is O(1) and scans walk memory sequentially instead of chasing node pointers.
+     * @tparam T The type of data stored in the array list.
+     */
+    template <class T>
+    class ArrayList
+    {
+    public:
+        using iterator = T *;             /**< Standard library iterator, the elements are contiguous */
+        using const_iterator = const T *; /**< Standard library const iterator */
+
+        /**
+         * @brief Constructs an empty array list.
+         */
+        ArrayList();
+
+        /**
+         * @brief Resets the array list to an empty state.
+         */
+        void reset();
+
+        /**
+         * @brief Reserves storage for at least the given number of elements.
+         * @param capacity The number of elements to reserve space for.
+         */
+        void reserve(int capacity);
+
+        /**
+         * @brief Replaces the content of the array list with the elements of another container.
+         * The container must provide getSize() and iterate().
+         * @tparam C The type of the container to copy from.
+         * @param container The container to copy from.
+         */
+        template <class C>
+        void assign(C &container);
+
+        /**
+         * @brief Adds a new element with the given data to the end of the array list.
+         * @param data The data to be added to the array list.
+         */
+        void addNode(T &data);
+
+        /**
+         * @brief Adds a new element to the end of the array list, moving the given data into it.
+         * @param data The data to be moved into the array list.
+         */
+        void addNode(T &&data);
+
+        /**
+         * @brief Adds a new element to the end of the array list, constructing it in place.
+         * @tparam Args The types of the arguments.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <class... Args>
+        void emplaceNode(Args &&...args);
+
+        /**
+         * @brief Searches elements in the array list using a custom comparison function.
+         * @tparam C The type of the comparison, a function pointer, lambda or function object.
+         * @tparam K The type of the value to compare against.
+         * @param list Another ArrayList object where matching elements will be added.
+         * @param compare A callable to compare T and K.
+         * @param compareValue The value to compare against K.
+         */
+        template <class C, class K>
+        void searchNodes(ArrayList<T> &list, C compare, K compareValue);
+
+        /**
+         * @brief Searches elements in the array list by comparing the data directly.
+         * @param list Another ArrayList object where matching elements will be added.
+         * @param compareValue The value to compare against the data.
+         */
+        void searchNodes(ArrayList<T> &list, T compareValue);
+
+        /**
+         * @brief Sorts the elements in the array list using a custom comparison function.
+         * @tparam C The type of the comparison, a function pointer, lambda or function object.
+         * @param compare A callable returning true if the first element goes before the second.
+         */
+        template <class C>
+        void sortNodes(C compare);
+
+        /**
+         * @brief Sorts the elements in the array list using a comparison function known at compile time.
+         * If SortKey<Compare> is specialized, each element's key is computed once and the keys are sorted instead.
+         * @tparam Compare The comparison function.
+         */
+        template <auto Compare>
+        void sortNodes();
+
+        /**
+         * @brief Sorts the elements in the array list using the default comparison.
+         */
+        void sortNodes();
+
+        /**
+         * @brief Deletes the element at the specified index in the array list.
+         * @param index The index of the element to delete.
+         */
+        void deleteNode(int index);
+
+        /**
+         * @brief Deletes the first element in the array list that matches the given data.
+         * @param data The data to match and delete.
+         */
+        void deleteNode(T &data);
+
+        /**
+         * @brief Checks if the array list is empty.
+         * @return true if the array list is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets a pointer to the data stored at the specified index in the array list.
+         * @param index The index of the data to retrieve.
+         * @return Pointer to the data at the specified index.
+         */
+        T *getData(int index);
+
+        /**
+         * @brief Gets a pointer to the data stored in an element that matches the given data.
+         * @param data The data to match.
+         * @return Pointer to the matching data.
+         */
+        T *getData(T &data);
+
+        /**
+         * @brief Gets the number of elements in the array list.
+         * @return The size of the array list.
+         */
+        int getSize();
+
+        /**
+         * @brief Returns an iterator for iterating through the array list.
+         * @return An iterator for the array list.
+         */
+        ArrayIterator<T> iterate();
+
+        /**
+         * @return A standard library iterator to the first element.
+         */
+        iterator begin();
+
+        /**
+         * @return A standard library iterator past the last element.
+         */
+        iterator end();
+
+        /**
+         * @return A const standard library iterator to the first element.
+         */
+        const_iterator begin() const;
+
+        /**
+         * @return A const standard library iterator past the last element.
+         */
+        const_iterator end() const;
+
+    protected:
+        /**
+         * @brief The contiguous storage holding the elements.
+         */
+        std::vector<T> elements;
+
+        /**
+         * @brief Stable sorts the elements with a comparison over element pointers.
+         * @tparam C The type of the comparison callable.
+         * @param compare A callable returning true if the first element goes before the second.
+         */
+        template <class C>
+        void sortElements(C compare);
+    };
+}
+
+#include "structs/arrayList.hpp"
\ No newline at end of file
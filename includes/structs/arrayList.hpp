@@ -0,0 +1,260 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "structs/arrayList.h"
+
+using namespace List;
+
+template <class T>
+ArrayList<T>::ArrayList() : elements(){};
+
+template <class T>
+void ArrayList<T>::reset()
+{
+    this->elements.clear();
+}
+
+template <class T>
+void ArrayList<T>::reserve(int capacity)
+{
+    this->elements.reserve(capacity);
+}
+
+template <class T>
+template <class C>
+void ArrayList<T>::assign(C &container)
+{
+    this->elements.clear();
+    this->elements.reserve(container.getSize());
+
+    auto iterator = container.iterate();
+    while (iterator.getData() != nullptr)
+    {
+        this->elements.push_back(*iterator.getData());
+        iterator.next();
+    }
+}
+
+template <class T>
+void ArrayList<T>::addNode(T &data)
+{
+    this->elements.push_back(data);
+}
+
+template <class T>
+void ArrayList<T>::addNode(T &&data)
+{
+    this->elements.push_back(std::move(data));
+}
+
+template <class T>
+template <class... Args>
+void ArrayList<T>::emplaceNode(Args &&...args)
+{
+    this->elements.emplace_back(std::forward<Args>(args)...);
+}
+
+template <class T>
+template <class C, class K>
+void ArrayList<T>::searchNodes(ArrayList<T> &list, C compare, K compareValue)
+{
+    for (T &element : this->elements)
+    {
+        if (compare(element, compareValue))
+        {
+            list.addNode(element);
+        }
+    }
+};
+
+template <class T>
+void ArrayList<T>::searchNodes(ArrayList<T> &list, T compareValue)
+{
+    for (T &element : this->elements)
+    {
+        if (element == compareValue)
+        {
+            list.addNode(element);
+        }
+    }
+};
+
+template <class T>
+template <class C>
+void ArrayList<T>::sortNodes(C compare)
+{
+    this->sortElements([compare](T *a, T *b)
+                       { return compare(*a, *b); });
+};
+
+template <class T>
+template <auto Compare>
+void ArrayList<T>::sortNodes()
+{
+    if constexpr (SortKey<Compare>::enabled)
+    {
+        // Compute every key once, then sort the elements by their precomputed key.
+        using Key = decltype(SortKey<Compare>::key(this->elements[0]));
+        std::vector<Key> keys;
+        keys.reserve(this->elements.size());
+        for (T &element : this->elements)
+        {
+            keys.push_back(SortKey<Compare>::key(element));
+        }
+
+        T *base = this->elements.data();
+        this->sortElements([&keys, base](T *a, T *b)
+                           { return keys[a - base] < keys[b - base]; });
+    }
+    else
+    {
+        this->sortElements([](T *a, T *b)
+                           { return Compare(*a, *b); });
+    }
+};
+
+template <class T>
+void ArrayList<T>::sortNodes()
+{
+    this->sortElements([](T *a, T *b)
+                       { return *a < *b; });
+};
+
+template <class T>
+template <class C>
+void ArrayList<T>::sortElements(C compare)
+{
+    // Sort pointers rather than the elements themselves, so heavy elements are only moved once
+    // and the comparison functions receive non-const references as they expect.
+    std::vector<T *> order;
+    order.reserve(this->elements.size());
+    for (T &element : this->elements)
+    {
+        order.push_back(&element);
+    }
+
+    // Stable, like the merge sort used by LinkedList<T>.
+    ParallelSort::stableSort(order.begin(), order.end(), compare);
+
+    std::vector<T> sorted;
+    sorted.reserve(this->elements.size());
+    for (T *element : order)
+    {
+        sorted.push_back(std::move(*element));
+    }
+    this->elements.swap(sorted);
+};
+
+template <class T>
+void ArrayList<T>::deleteNode(int index)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    if (index < 0 || index >= this->getSize())
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    this->elements.erase(this->elements.begin() + index);
+}
+
+template <class T>
+void ArrayList<T>::deleteNode(T &data)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    for (int i = 0; i < this->getSize(); i++)
+    {
+        if (this->elements[i] == data)
+        {
+            this->elements.erase(this->elements.begin() + i);
+            return;
+        }
+    }
+
+    throw std::out_of_range("Index out of range");
+}
+
+template <class T>
+T *ArrayList<T>::getData(int index)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    if (index < 0 || index >= this->getSize())
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    return &this->elements[index];
+};
+
+template <class T>
+T *ArrayList<T>::getData(T &data)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    for (T &element : this->elements)
+    {
+        if (element == data)
+        {
+            return &element;
+        }
+    }
+
+    throw std::out_of_range("Index out of range");
+};
+
+template <class T>
+bool ArrayList<T>::isEmpty()
+{
+    return this->elements.empty();
+}
+
+template <class T>
+int ArrayList<T>::getSize()
+{
+    return (int)this->elements.size();
+}
+
+template <class T>
+ArrayIterator<T> ArrayList<T>::iterate()
+{
+    T *first = this->elements.data();
+    return ArrayIterator<T>(first, first + this->elements.size());
+}
+
+template <class T>
+typename ArrayList<T>::iterator ArrayList<T>::begin()
+{
+    return this->elements.data();
+}
+
+template <class T>
+typename ArrayList<T>::iterator ArrayList<T>::end()
+{
+    return this->elements.data() + this->elements.size();
+}
+
+template <class T>
+typename ArrayList<T>::const_iterator ArrayList<T>::begin() const
+{
+    return this->elements.data();
+}
+
+template <class T>
+typename ArrayList<T>::const_iterator ArrayList<T>::end() const
+{
+    return this->elements.data() + this->elements.size();
+}
\ No newline at end of file
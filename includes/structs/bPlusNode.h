@@ -0,0 +1,109 @@
+#pragma once
+
+namespace List
+{
+    /**
+     * @brief Base node class for a B+ tree.
+     * Keys are kept in a sorted array sized to two cache lines, so a node is searched with a few sequential loads.
+     * Nodes are not over-aligned: an aligned allocation pads every node and takes the allocator's slow path,
+     * which costs more on a bulk load of millions of keys than the line a search may straddle.
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     */
+    template <class K, class V>
+    class BPlusNode
+    {
+    public:
+        /**
+         * @brief The maximum number of keys held by a node.
+         */
+        static const int CAPACITY = (128 / sizeof(K)) < 8 ? 8 : (128 / sizeof(K));
+
+        /**
+         * @brief The minimum number of keys held by a node other than the root.
+         */
+        static const int MIN_COUNT = CAPACITY / 2;
+
+        /**
+         * @brief Whether the node is a leaf.
+         */
+        bool isLeaf;
+
+        /**
+         * @brief The number of keys in the node.
+         */
+        int count;
+
+        /**
+         * @brief The sorted keys of the node.
+         */
+        K keys[CAPACITY];
+
+        /**
+         * @brief Constructs an empty node.
+         * @param isLeaf Whether the node is a leaf.
+         */
+        BPlusNode(bool isLeaf);
+
+        /**
+         * @brief Gets the index of the first key not less than the given key.
+         * @param key The key to locate.
+         * @return The index of the key, or count if every key is less.
+         */
+        int lowerBound(const K &key);
+
+        /**
+         * @brief Gets the index of the first key greater than the given key.
+         * @param key The key to locate.
+         * @return The index of the key, or count if no key is greater.
+         */
+        int upperBound(const K &key);
+    };
+
+    /**
+     * @brief Leaf node class for a B+ tree. Leaves hold the values and are chained for ordered scans.
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     */
+    template <class K, class V>
+    class BPlusLeaf : public BPlusNode<K, V>
+    {
+    public:
+        /**
+         * @brief The values stored next to the keys.
+         */
+        V values[BPlusNode<K, V>::CAPACITY];
+
+        /**
+         * @brief Pointer to the next leaf in key order.
+         */
+        BPlusLeaf *next;
+
+        /**
+         * @brief Constructs an empty leaf.
+         */
+        BPlusLeaf();
+    };
+
+    /**
+     * @brief Inner node class for a B+ tree. Child i holds the keys from keys[i - 1] up to, but excluding, keys[i].
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     */
+    template <class K, class V>
+    class BPlusInner : public BPlusNode<K, V>
+    {
+    public:
+        /**
+         * @brief The children of the node, one more than the keys.
+         */
+        BPlusNode<K, V> *children[BPlusNode<K, V>::CAPACITY + 1];
+
+        /**
+         * @brief Constructs an empty inner node.
+         */
+        BPlusInner();
+    };
+}
+
+#include "structs/bPlusNode.hpp"
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "structs/bPlusNode.h"
+
+using namespace List;
+
+template <class K, class V>
+BPlusNode<K, V>::BPlusNode(bool isLeaf) : isLeaf(isLeaf), count(0){};
+
+template <class K, class V>
+int BPlusNode<K, V>::lowerBound(const K &key)
+{
+    // Binary search over the key array.
+    int low = 0;
+    int high = this->count;
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+        if (this->keys[middle] < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+template <class K, class V>
+int BPlusNode<K, V>::upperBound(const K &key)
+{
+    int low = 0;
+    int high = this->count;
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+        if (key < this->keys[middle])
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+    return low;
+}
+
+template <class K, class V>
+BPlusLeaf<K, V>::BPlusLeaf() : BPlusNode<K, V>(true), next(nullptr){};
+
+template <class K, class V>
+BPlusInner<K, V>::BPlusInner() : BPlusNode<K, V>(false){};
\ No newline at end of file
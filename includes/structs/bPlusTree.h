@@ -0,0 +1,151 @@
+#pragma once
+
+#include "structs/bPlusNode.h"
+#include "structs/bPlusTreeIterator.h"
+
+namespace List
+{
+    /**
+     * @brief Template class representing an in-memory B+ tree mapping unique keys to values.
+     * Nodes are wide and cache line aligned, giving O(log n) point lookups with few cache misses,
+     * and the chained leaves give ordered range scans.
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     */
+    template <class K, class V>
+    class BPlusTree
+    {
+    public:
+        /**
+         * @brief Constructs an empty B+ tree.
+         */
+        BPlusTree();
+
+        /**
+         * @brief Destructor.
+         */
+        ~BPlusTree();
+
+        /**
+         * @brief B+ trees are not copied.
+         */
+        BPlusTree(const BPlusTree<K, V> &other) = delete;
+
+        /**
+         * @brief B+ trees are not copied.
+         */
+        BPlusTree<K, V> &operator=(const BPlusTree<K, V> &other) = delete;
+
+        /**
+         * @brief Resets the B+ tree to an empty state.
+         */
+        void reset();
+
+        /**
+         * @brief Inserts a key with its value, replacing the value if the key is already present.
+         * @param key The key to insert.
+         * @param value The value to store with the key.
+         */
+        void insert(K key, V value);
+
+        /**
+         * @brief Removes a key and its value.
+         * @param key The key to remove.
+         * @return true if the key was present, false otherwise.
+         */
+        bool remove(K key);
+
+        /**
+         * @brief Looks up the value of a key.
+         * @param key The key to look up.
+         * @return Pointer to the value, or nullptr if the key is not present.
+         */
+        V *find(K key);
+
+        /**
+         * @brief Replaces the content of the tree with sorted entries, building it bottom up in linear time.
+         * @param keys The keys, sorted in ascending order without duplicates.
+         * @param values The values matching the keys.
+         * @param count The number of entries.
+         */
+        void bulkLoad(K keys[], V values[], int count);
+
+        /**
+         * @brief Checks if the B+ tree is empty.
+         * @return true if the B+ tree is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets the number of keys in the B+ tree.
+         * @return The size of the B+ tree.
+         */
+        int getSize();
+
+        /**
+         * @brief Returns an iterator over every entry in key order.
+         * @return An iterator for the B+ tree.
+         */
+        BPlusTreeIterator<K, V> iterate();
+
+        /**
+         * @brief Returns an iterator over the entries with keys from `first` to `last`, both included.
+         * @param first The first key of the range.
+         * @param last The last key of the range.
+         * @return An iterator for the range.
+         */
+        BPlusTreeIterator<K, V> iterate(K first, K last);
+
+    private:
+        BPlusNode<K, V> *root; /**< The root node, or nullptr when the tree is empty */
+        int size;              /**< The number of keys in the tree */
+
+        /**
+         * @brief Inserts into a subtree, splitting the node if it overflows.
+         * @param node The root of the subtree.
+         * @param key The key to insert.
+         * @param value The value to insert.
+         * @param splitKey Receives the first key of the new sibling on a split.
+         * @param inserted Receives whether a new key was added rather than replaced.
+         * @return The new right sibling if the node was split, nullptr otherwise.
+         */
+        BPlusNode<K, V> *insertInto(BPlusNode<K, V> *node, K &key, V &value, K &splitKey, bool &inserted);
+
+        /**
+         * @brief Removes from a subtree, rebalancing children that fall under the minimum.
+         * @param node The root of the subtree.
+         * @param key The key to remove.
+         * @return true if the key was present, false otherwise.
+         */
+        bool removeFrom(BPlusNode<K, V> *node, K &key);
+
+        /**
+         * @brief Refills an underflowing child by borrowing from a sibling or merging with it.
+         * @param parent The parent of the child.
+         * @param index The index of the child in the parent.
+         */
+        void rebalance(BPlusInner<K, V> *parent, int index);
+
+        /**
+         * @brief Merges a child with its right sibling.
+         * @param parent The parent of both children.
+         * @param index The index of the left child in the parent.
+         */
+        void merge(BPlusInner<K, V> *parent, int index);
+
+        /**
+         * @brief Finds the leaf that holds or would hold a key.
+         * @param key The key to locate.
+         * @return The leaf, or nullptr if the tree is empty.
+         */
+        BPlusLeaf<K, V> *findLeaf(K &key);
+
+        /**
+         * @brief Frees a subtree.
+         * @param node The root of the subtree.
+         */
+        void destroy(BPlusNode<K, V> *node);
+    };
+}
+
+#include "structs/bPlusTree.hpp"
\ No newline at end of file
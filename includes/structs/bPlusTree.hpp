@@ -0,0 +1,549 @@
+#include <vector>
+#include "structs/bPlusTree.h"
+
+using namespace List;
+
+template <class K, class V>
+BPlusTree<K, V>::BPlusTree() : root(nullptr), size(0){};
+
+template <class K, class V>
+BPlusTree<K, V>::~BPlusTree()
+{
+    this->reset();
+}
+
+template <class K, class V>
+void BPlusTree<K, V>::reset()
+{
+    this->destroy(this->root);
+    this->root = nullptr;
+    this->size = 0;
+}
+
+template <class K, class V>
+void BPlusTree<K, V>::insert(K key, V value)
+{
+    if (this->root == nullptr)
+    {
+        this->root = new BPlusLeaf<K, V>();
+    }
+
+    K splitKey;
+    bool inserted = false;
+    BPlusNode<K, V> *sibling = this->insertInto(this->root, key, value, splitKey, inserted);
+
+    // The root was split, so the tree grows by one level.
+    if (sibling != nullptr)
+    {
+        BPlusInner<K, V> *newRoot = new BPlusInner<K, V>();
+        newRoot->keys[0] = splitKey;
+        newRoot->children[0] = this->root;
+        newRoot->children[1] = sibling;
+        newRoot->count = 1;
+        this->root = newRoot;
+    }
+
+    if (inserted)
+    {
+        this->size++;
+    }
+}
+
+template <class K, class V>
+bool BPlusTree<K, V>::remove(K key)
+{
+    if (this->root == nullptr)
+    {
+        return false;
+    }
+
+    bool removed = this->removeFrom(this->root, key);
+    if (!removed)
+    {
+        return false;
+    }
+    this->size--;
+
+    // The root shrinks instead of being rebalanced.
+    if (!this->root->isLeaf && this->root->count == 0)
+    {
+        BPlusInner<K, V> *oldRoot = static_cast<BPlusInner<K, V> *>(this->root);
+        this->root = oldRoot->children[0];
+        delete oldRoot;
+    }
+    else if (this->root->isLeaf && this->root->count == 0)
+    {
+        delete static_cast<BPlusLeaf<K, V> *>(this->root);
+        this->root = nullptr;
+    }
+
+    return true;
+}
+
+template <class K, class V>
+V *BPlusTree<K, V>::find(K key)
+{
+    BPlusLeaf<K, V> *leaf = this->findLeaf(key);
+    if (leaf == nullptr)
+    {
+        return nullptr;
+    }
+
+    int index = leaf->lowerBound(key);
+    if (index < leaf->count && !(key < leaf->keys[index]))
+    {
+        return &leaf->values[index];
+    }
+
+    return nullptr;
+}
+
+template <class K, class V>
+void BPlusTree<K, V>::bulkLoad(K keys[], V values[], int count)
+{
+    this->reset();
+    if (count <= 0)
+    {
+        return;
+    }
+
+    const int capacity = BPlusNode<K, V>::CAPACITY;
+
+    // Spread the entries evenly over the fewest leaves that can hold them,
+    // which keeps every leaf at least half full.
+    std::vector<BPlusNode<K, V> *> level;
+    std::vector<K> firstKeys;
+    int leafCount = (count + capacity - 1) / capacity;
+    int offset = 0;
+    BPlusLeaf<K, V> *previous = nullptr;
+    for (int i = 0; i < leafCount; i++)
+    {
+        int take = count / leafCount + (i < count % leafCount ? 1 : 0);
+
+        BPlusLeaf<K, V> *leaf = new BPlusLeaf<K, V>();
+        for (int j = 0; j < take; j++)
+        {
+            leaf->keys[j] = keys[offset + j];
+            leaf->values[j] = values[offset + j];
+        }
+        leaf->count = take;
+
+        if (previous != nullptr)
+        {
+            previous->next = leaf;
+        }
+        previous = leaf;
+
+        level.push_back(leaf);
+        firstKeys.push_back(keys[offset]);
+        offset += take;
+    }
+
+    // Build the inner levels the same way until a single root is left.
+    while (level.size() > 1)
+    {
+        int nodeCount = (int)level.size();
+        int parentCount = (nodeCount + capacity) / (capacity + 1);
+
+        std::vector<BPlusNode<K, V> *> parents;
+        std::vector<K> parentFirstKeys;
+        int index = 0;
+        for (int i = 0; i < parentCount; i++)
+        {
+            int take = nodeCount / parentCount + (i < nodeCount % parentCount ? 1 : 0);
+
+            BPlusInner<K, V> *parent = new BPlusInner<K, V>();
+            parent->children[0] = level[index];
+            for (int j = 1; j < take; j++)
+            {
+                parent->keys[j - 1] = firstKeys[index + j];
+                parent->children[j] = level[index + j];
+            }
+            parent->count = take - 1;
+
+            parents.push_back(parent);
+            parentFirstKeys.push_back(firstKeys[index]);
+            index += take;
+        }
+
+        level.swap(parents);
+        firstKeys.swap(parentFirstKeys);
+    }
+
+    this->root = level[0];
+    this->size = count;
+}
+
+template <class K, class V>
+bool BPlusTree<K, V>::isEmpty()
+{
+    return this->size == 0;
+}
+
+template <class K, class V>
+int BPlusTree<K, V>::getSize()
+{
+    return this->size;
+}
+
+template <class K, class V>
+BPlusTreeIterator<K, V> BPlusTree<K, V>::iterate()
+{
+    // Start from the leftmost leaf.
+    BPlusNode<K, V> *node = this->root;
+    while (node != nullptr && !node->isLeaf)
+    {
+        node = static_cast<BPlusInner<K, V> *>(node)->children[0];
+    }
+
+    return BPlusTreeIterator<K, V>(static_cast<BPlusLeaf<K, V> *>(node), 0, K(), false);
+}
+
+template <class K, class V>
+BPlusTreeIterator<K, V> BPlusTree<K, V>::iterate(K first, K last)
+{
+    BPlusLeaf<K, V> *leaf = this->findLeaf(first);
+    if (leaf == nullptr || last < first)
+    {
+        return BPlusTreeIterator<K, V>(nullptr, 0, last, true);
+    }
+
+    return BPlusTreeIterator<K, V>(leaf, leaf->lowerBound(first), last, true);
+}
+
+template <class K, class V>
+BPlusNode<K, V> *BPlusTree<K, V>::insertInto(BPlusNode<K, V> *node, K &key, V &value, K &splitKey, bool &inserted)
+{
+    const int capacity = BPlusNode<K, V>::CAPACITY;
+
+    if (node->isLeaf)
+    {
+        BPlusLeaf<K, V> *leaf = static_cast<BPlusLeaf<K, V> *>(node);
+        int position = leaf->lowerBound(key);
+
+        // Replace the value of an existing key.
+        if (position < leaf->count && !(key < leaf->keys[position]))
+        {
+            leaf->values[position] = value;
+            return nullptr;
+        }
+        inserted = true;
+
+        if (leaf->count < capacity)
+        {
+            for (int i = leaf->count; i > position; i--)
+            {
+                leaf->keys[i] = leaf->keys[i - 1];
+                leaf->values[i] = leaf->values[i - 1];
+            }
+            leaf->keys[position] = key;
+            leaf->values[position] = value;
+            leaf->count++;
+            return nullptr;
+        }
+
+        // The leaf is full: lay out the entries with the new one, then split them in half.
+        K allKeys[capacity + 1];
+        V allValues[capacity + 1];
+        for (int i = 0, j = 0; i <= capacity; i++)
+        {
+            if (i == position)
+            {
+                allKeys[i] = key;
+                allValues[i] = value;
+            }
+            else
+            {
+                allKeys[i] = leaf->keys[j];
+                allValues[i] = leaf->values[j];
+                j++;
+            }
+        }
+
+        BPlusLeaf<K, V> *sibling = new BPlusLeaf<K, V>();
+        int leftCount = (capacity + 1) / 2;
+        for (int i = 0; i < leftCount; i++)
+        {
+            leaf->keys[i] = allKeys[i];
+            leaf->values[i] = allValues[i];
+        }
+        for (int i = leftCount; i <= capacity; i++)
+        {
+            sibling->keys[i - leftCount] = allKeys[i];
+            sibling->values[i - leftCount] = allValues[i];
+        }
+        leaf->count = leftCount;
+        sibling->count = capacity + 1 - leftCount;
+
+        sibling->next = leaf->next;
+        leaf->next = sibling;
+
+        splitKey = sibling->keys[0];
+        return sibling;
+    }
+
+    BPlusInner<K, V> *inner = static_cast<BPlusInner<K, V> *>(node);
+    int position = inner->upperBound(key);
+
+    K childSplitKey;
+    BPlusNode<K, V> *newChild = this->insertInto(inner->children[position], key, value, childSplitKey, inserted);
+    if (newChild == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (inner->count < capacity)
+    {
+        for (int i = inner->count; i > position; i--)
+        {
+            inner->keys[i] = inner->keys[i - 1];
+            inner->children[i + 1] = inner->children[i];
+        }
+        inner->keys[position] = childSplitKey;
+        inner->children[position + 1] = newChild;
+        inner->count++;
+        return nullptr;
+    }
+
+    // The inner node is full: lay out the keys and children with the new child,
+    // keep the lower half, move the upper half to a sibling and push the middle key up.
+    K allKeys[capacity + 1];
+    BPlusNode<K, V> *allChildren[capacity + 2];
+    allChildren[0] = inner->children[0];
+    for (int i = 0, j = 0; i <= capacity; i++)
+    {
+        if (i == position)
+        {
+            allKeys[i] = childSplitKey;
+            allChildren[i + 1] = newChild;
+        }
+        else
+        {
+            allKeys[i] = inner->keys[j];
+            allChildren[i + 1] = inner->children[j + 1];
+            j++;
+        }
+    }
+
+    BPlusInner<K, V> *sibling = new BPlusInner<K, V>();
+    int middle = (capacity + 1) / 2;
+    for (int i = 0; i < middle; i++)
+    {
+        inner->keys[i] = allKeys[i];
+        inner->children[i] = allChildren[i];
+    }
+    inner->children[middle] = allChildren[middle];
+    inner->count = middle;
+
+    for (int i = middle + 1; i <= capacity; i++)
+    {
+        sibling->keys[i - middle - 1] = allKeys[i];
+        sibling->children[i - middle - 1] = allChildren[i];
+    }
+    sibling->children[capacity - middle] = allChildren[capacity + 1];
+    sibling->count = capacity - middle;
+
+    splitKey = allKeys[middle];
+    return sibling;
+}
+
+template <class K, class V>
+bool BPlusTree<K, V>::removeFrom(BPlusNode<K, V> *node, K &key)
+{
+    if (node->isLeaf)
+    {
+        BPlusLeaf<K, V> *leaf = static_cast<BPlusLeaf<K, V> *>(node);
+        int position = leaf->lowerBound(key);
+        if (position == leaf->count || key < leaf->keys[position])
+        {
+            return false;
+        }
+
+        for (int i = position; i < leaf->count - 1; i++)
+        {
+            leaf->keys[i] = leaf->keys[i + 1];
+            leaf->values[i] = leaf->values[i + 1];
+        }
+        leaf->count--;
+        return true;
+    }
+
+    BPlusInner<K, V> *inner = static_cast<BPlusInner<K, V> *>(node);
+    int position = inner->upperBound(key);
+    bool removed = this->removeFrom(inner->children[position], key);
+
+    // Separator keys may keep a removed key, they only need to route lookups.
+    if (removed && inner->children[position]->count < BPlusNode<K, V>::MIN_COUNT)
+    {
+        this->rebalance(inner, position);
+    }
+
+    return removed;
+}
+
+template <class K, class V>
+void BPlusTree<K, V>::rebalance(BPlusInner<K, V> *parent, int index)
+{
+    BPlusNode<K, V> *child = parent->children[index];
+    BPlusNode<K, V> *left = index > 0 ? parent->children[index - 1] : nullptr;
+    BPlusNode<K, V> *right = index < parent->count ? parent->children[index + 1] : nullptr;
+
+    // Borrow the last entry of the left sibling.
+    if (left != nullptr && left->count > BPlusNode<K, V>::MIN_COUNT)
+    {
+        if (child->isLeaf)
+        {
+            BPlusLeaf<K, V> *childLeaf = static_cast<BPlusLeaf<K, V> *>(child);
+            BPlusLeaf<K, V> *leftLeaf = static_cast<BPlusLeaf<K, V> *>(left);
+            for (int i = childLeaf->count; i > 0; i--)
+            {
+                childLeaf->keys[i] = childLeaf->keys[i - 1];
+                childLeaf->values[i] = childLeaf->values[i - 1];
+            }
+            childLeaf->keys[0] = leftLeaf->keys[leftLeaf->count - 1];
+            childLeaf->values[0] = leftLeaf->values[leftLeaf->count - 1];
+            parent->keys[index - 1] = childLeaf->keys[0];
+        }
+        else
+        {
+            BPlusInner<K, V> *childInner = static_cast<BPlusInner<K, V> *>(child);
+            BPlusInner<K, V> *leftInner = static_cast<BPlusInner<K, V> *>(left);
+            childInner->children[childInner->count + 1] = childInner->children[childInner->count];
+            for (int i = childInner->count; i > 0; i--)
+            {
+                childInner->keys[i] = childInner->keys[i - 1];
+                childInner->children[i] = childInner->children[i - 1];
+            }
+            childInner->keys[0] = parent->keys[index - 1];
+            childInner->children[0] = leftInner->children[leftInner->count];
+            parent->keys[index - 1] = leftInner->keys[leftInner->count - 1];
+        }
+        left->count--;
+        child->count++;
+        return;
+    }
+
+    // Borrow the first entry of the right sibling.
+    if (right != nullptr && right->count > BPlusNode<K, V>::MIN_COUNT)
+    {
+        if (child->isLeaf)
+        {
+            BPlusLeaf<K, V> *childLeaf = static_cast<BPlusLeaf<K, V> *>(child);
+            BPlusLeaf<K, V> *rightLeaf = static_cast<BPlusLeaf<K, V> *>(right);
+            childLeaf->keys[childLeaf->count] = rightLeaf->keys[0];
+            childLeaf->values[childLeaf->count] = rightLeaf->values[0];
+            for (int i = 0; i < rightLeaf->count - 1; i++)
+            {
+                rightLeaf->keys[i] = rightLeaf->keys[i + 1];
+                rightLeaf->values[i] = rightLeaf->values[i + 1];
+            }
+            parent->keys[index] = rightLeaf->keys[0];
+        }
+        else
+        {
+            BPlusInner<K, V> *childInner = static_cast<BPlusInner<K, V> *>(child);
+            BPlusInner<K, V> *rightInner = static_cast<BPlusInner<K, V> *>(right);
+            childInner->keys[childInner->count] = parent->keys[index];
+            childInner->children[childInner->count + 1] = rightInner->children[0];
+            parent->keys[index] = rightInner->keys[0];
+            for (int i = 0; i < rightInner->count - 1; i++)
+            {
+                rightInner->keys[i] = rightInner->keys[i + 1];
+                rightInner->children[i] = rightInner->children[i + 1];
+            }
+            rightInner->children[rightInner->count - 1] = rightInner->children[rightInner->count];
+        }
+        right->count--;
+        child->count++;
+        return;
+    }
+
+    // Neither sibling can spare an entry, so merge with one of them.
+    if (left != nullptr)
+    {
+        this->merge(parent, index - 1);
+    }
+    else
+    {
+        this->merge(parent, index);
+    }
+}
+
+template <class K, class V>
+void BPlusTree<K, V>::merge(BPlusInner<K, V> *parent, int index)
+{
+    BPlusNode<K, V> *left = parent->children[index];
+    BPlusNode<K, V> *right = parent->children[index + 1];
+
+    if (left->isLeaf)
+    {
+        BPlusLeaf<K, V> *leftLeaf = static_cast<BPlusLeaf<K, V> *>(left);
+        BPlusLeaf<K, V> *rightLeaf = static_cast<BPlusLeaf<K, V> *>(right);
+        for (int i = 0; i < rightLeaf->count; i++)
+        {
+            leftLeaf->keys[leftLeaf->count + i] = rightLeaf->keys[i];
+            leftLeaf->values[leftLeaf->count + i] = rightLeaf->values[i];
+        }
+        leftLeaf->count += rightLeaf->count;
+        leftLeaf->next = rightLeaf->next;
+        delete rightLeaf;
+    }
+    else
+    {
+        // The separator comes down between the two halves.
+        BPlusInner<K, V> *leftInner = static_cast<BPlusInner<K, V> *>(left);
+        BPlusInner<K, V> *rightInner = static_cast<BPlusInner<K, V> *>(right);
+        leftInner->keys[leftInner->count] = parent->keys[index];
+        for (int i = 0; i < rightInner->count; i++)
+        {
+            leftInner->keys[leftInner->count + 1 + i] = rightInner->keys[i];
+            leftInner->children[leftInner->count + 1 + i] = rightInner->children[i];
+        }
+        leftInner->children[leftInner->count + 1 + rightInner->count] = rightInner->children[rightInner->count];
+        leftInner->count += rightInner->count + 1;
+        delete rightInner;
+    }
+
+    // Drop the separator and the right child from the parent.
+    for (int i = index; i < parent->count - 1; i++)
+    {
+        parent->keys[i] = parent->keys[i + 1];
+        parent->children[i + 1] = parent->children[i + 2];
+    }
+    parent->count--;
+}
+
+template <class K, class V>
+BPlusLeaf<K, V> *BPlusTree<K, V>::findLeaf(K &key)
+{
+    BPlusNode<K, V> *node = this->root;
+    while (node != nullptr && !node->isLeaf)
+    {
+        BPlusInner<K, V> *inner = static_cast<BPlusInner<K, V> *>(node);
+        node = inner->children[inner->upperBound(key)];
+    }
+
+    return static_cast<BPlusLeaf<K, V> *>(node);
+}
+
+template <class K, class V>
+void BPlusTree<K, V>::destroy(BPlusNode<K, V> *node)
+{
+    if (node == nullptr)
+    {
+        return;
+    }
+
+    if (node->isLeaf)
+    {
+        delete static_cast<BPlusLeaf<K, V> *>(node);
+        return;
+    }
+
+    BPlusInner<K, V> *inner = static_cast<BPlusInner<K, V> *>(node);
+    for (int i = 0; i <= inner->count; i++)
+    {
+        this->destroy(inner->children[i]);
+    }
+    delete inner;
+}
\ No newline at end of file
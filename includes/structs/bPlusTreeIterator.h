@@ -0,0 +1,59 @@
+#pragma once
+
+#include "structs/bPlusNode.h"
+
+namespace List
+{
+    /**
+     * @brief Iterator class for an ordered scan over a range of B+ tree keys.
+     * Walks the chained leaves, so a scan reads keys and values sequentially.
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     */
+    template <class K, class V>
+    class BPlusTreeIterator
+    {
+    public:
+        /**
+         * @brief Constructs an iterator starting at a position of a leaf.
+         * @param leaf The leaf to start in, or nullptr for an empty scan.
+         * @param index The index of the first entry in the leaf.
+         * @param last The last key to include in the scan.
+         * @param bounded Whether the scan stops after `last`.
+         */
+        BPlusTreeIterator(BPlusLeaf<K, V> *leaf, int index, K last, bool bounded);
+
+        /**
+         * @return true if there is a next entry, false otherwise.
+         */
+        bool hasNext();
+
+        /**
+         * @return Pointer to the value of the current entry, or nullptr once the scan is over.
+         */
+        V *getData();
+
+        /**
+         * @return The key of the current entry. Only valid while getData() is not nullptr.
+         */
+        K getKey();
+
+        /**
+         * @brief The `next` method advances the iterator to the next entry in key order.
+         */
+        void next();
+
+    private:
+        BPlusLeaf<K, V> *leaf; /**< The leaf the iterator is positioned in */
+        int index;             /**< The entry the iterator is positioned on */
+        K last;                /**< The last key of the scan */
+        bool bounded;          /**< Whether the scan stops after `last` */
+
+        /**
+         * @brief Moves past empty leaves and ends the scan once the bound is passed.
+         */
+        void settle();
+    };
+}
+
+#include "structs/bPlusTreeIterator.hpp"
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "structs/bPlusTreeIterator.h"
+
+using namespace List;
+
+template <class K, class V>
+BPlusTreeIterator<K, V>::BPlusTreeIterator(BPlusLeaf<K, V> *leaf, int index, K last, bool bounded)
+    : leaf(leaf),
+      index(index),
+      last(last),
+      bounded(bounded)
+{
+    this->settle();
+};
+
+template <class K, class V>
+bool BPlusTreeIterator<K, V>::hasNext()
+{
+    BPlusTreeIterator<K, V> lookAhead = *this;
+    lookAhead.next();
+    return lookAhead.getData() != nullptr;
+}
+
+template <class K, class V>
+V *BPlusTreeIterator<K, V>::getData()
+{
+    if (this->leaf == nullptr)
+    {
+        return nullptr;
+    }
+    return &this->leaf->values[this->index];
+}
+
+template <class K, class V>
+K BPlusTreeIterator<K, V>::getKey()
+{
+    return this->leaf->keys[this->index];
+}
+
+template <class K, class V>
+void BPlusTreeIterator<K, V>::next()
+{
+    this->index++;
+    this->settle();
+}
+
+template <class K, class V>
+void BPlusTreeIterator<K, V>::settle()
+{
+    while (this->leaf != nullptr && this->index >= this->leaf->count)
+    {
+        this->leaf = this->leaf->next;
+        this->index = 0;
+    }
+
+    if (this->leaf != nullptr && this->bounded && this->last < this->leaf->keys[this->index])
+    {
+        this->leaf = nullptr;
+    }
+}
\ No newline at end of file
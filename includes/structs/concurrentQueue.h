@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace List
+{
+    /**
+     * @brief Template class representing a bounded lock-free multi-producer/multi-consumer queue.
+     * Elements live in a ring buffer whose cells carry a sequence number telling producers and consumers
+     * whose turn the cell is, so threads only contend on one atomic counter per side and never block.
+     * Enqueueing into a full queue or dequeueing from an empty one fails instead of waiting.
+     * @tparam T The type of data stored in the queue, which must be move constructible.
+     */
+    template <class T>
+    class ConcurrentQueue
+    {
+    public:
+        /**
+         * @brief Constructs an empty queue.
+         * @param capacity The number of elements the queue holds, rounded up to a power of two.
+         */
+        explicit ConcurrentQueue(int capacity);
+
+        /**
+         * @brief Destructor. Destroys the elements still in the queue; no thread may use the queue any more.
+         */
+        ~ConcurrentQueue();
+
+        /**
+         * @brief Queues are shared between threads by reference and cannot be copied.
+         */
+        ConcurrentQueue(const ConcurrentQueue<T> &other) = delete;
+
+        /**
+         * @brief Queues are shared between threads by reference and cannot be copied.
+         */
+        ConcurrentQueue<T> &operator=(const ConcurrentQueue<T> &other) = delete;
+
+        /**
+         * @brief Adds an element to the end of the queue. Safe to call from any thread.
+         * @param data The data to be added to the queue.
+         * @return true if the element was queued, false if the queue is full.
+         */
+        bool tryEnqueue(T &data);
+
+        /**
+         * @brief Adds an element to the end of the queue, moving the given data into it. Safe to call from any thread.
+         * @param data The data to be moved into the queue. It is left untouched if the queue is full.
+         * @return true if the element was queued, false if the queue is full.
+         */
+        bool tryEnqueue(T &&data);
+
+        /**
+         * @brief Removes the element at the front of the queue. Safe to call from any thread.
+         * @param data Receives the element.
+         * @return true if an element was dequeued, false if the queue is empty.
+         */
+        bool tryDequeue(T &data);
+
+        /**
+         * @brief Removes up to a number of elements from the front of the queue, handing each to a callable.
+         * Safe to call from any thread.
+         * @tparam F The type of the callable, taking a T &&.
+         * @param consume The callable receiving each element.
+         * @param maxCount The maximum number of elements to remove.
+         * @return The number of elements removed.
+         */
+        template <class F>
+        int drain(F consume, int maxCount);
+
+        /**
+         * @return The number of elements the queue holds.
+         */
+        int getCapacity();
+
+        /**
+         * @brief Gets the number of elements in the queue. Only a snapshot while other threads use the queue.
+         * @return The size of the queue.
+         */
+        int getSize();
+
+        /**
+         * @brief Checks if the queue is empty. Only a snapshot while other threads use the queue.
+         * @return true if the queue is empty, false otherwise.
+         */
+        bool isEmpty();
+
+    private:
+        static const int CACHE_LINE = 64; /**< Size of a cache line, keeping the two counters apart */
+
+        /**
+         * @brief Cell of the ring buffer.
+         */
+        struct Cell
+        {
+            std::atomic<size_t> sequence;                     /**< Position a producer (== pos) or consumer (== pos + 1) waits for */
+            alignas(T) unsigned char storage[sizeof(T)];      /**< Raw storage for the element */
+        };
+
+        Cell *cells;                                      /**< The ring buffer */
+        size_t mask;                                      /**< Capacity minus one, to wrap positions */
+        alignas(CACHE_LINE) std::atomic<size_t> enqueuePos; /**< Position of the next element to enqueue */
+        alignas(CACHE_LINE) std::atomic<size_t> dequeuePos; /**< Position of the next element to dequeue */
+
+        /**
+         * @brief Claims the cell for the next element to enqueue.
+         * @return The cell, or nullptr if the queue is full.
+         */
+        Cell *claimEnqueue(size_t &position);
+
+        /**
+         * @brief Claims the cell of the next element to dequeue.
+         * @return The cell, or nullptr if the queue is empty.
+         */
+        Cell *claimDequeue(size_t &position);
+    };
+}
+
+#include "structs/concurrentQueue.hpp"
\ No newline at end of file
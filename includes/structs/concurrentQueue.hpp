@@ -0,0 +1,184 @@
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "structs/concurrentQueue.h"
+
+using namespace List;
+
+template <class T>
+ConcurrentQueue<T>::ConcurrentQueue(int capacity) : enqueuePos(0), dequeuePos(0)
+{
+    size_t size = 2;
+    while (size < (size_t)capacity)
+    {
+        size *= 2;
+    }
+
+    this->cells = new Cell[size];
+    this->mask = size - 1;
+    for (size_t i = 0; i < size; i++)
+    {
+        this->cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+};
+
+template <class T>
+ConcurrentQueue<T>::~ConcurrentQueue()
+{
+    size_t position;
+    Cell *cell;
+    while ((cell = this->claimDequeue(position)) != nullptr)
+    {
+        std::launder(reinterpret_cast<T *>(cell->storage))->~T();
+    }
+    delete[] this->cells;
+}
+
+template <class T>
+bool ConcurrentQueue<T>::tryEnqueue(T &data)
+{
+    size_t position;
+    Cell *cell = this->claimEnqueue(position);
+    if (cell == nullptr)
+    {
+        return false;
+    }
+
+    new (cell->storage) T(data);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+bool ConcurrentQueue<T>::tryEnqueue(T &&data)
+{
+    size_t position;
+    Cell *cell = this->claimEnqueue(position);
+    if (cell == nullptr)
+    {
+        return false;
+    }
+
+    new (cell->storage) T(std::move(data));
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+bool ConcurrentQueue<T>::tryDequeue(T &data)
+{
+    size_t position;
+    Cell *cell = this->claimDequeue(position);
+    if (cell == nullptr)
+    {
+        return false;
+    }
+
+    T *element = std::launder(reinterpret_cast<T *>(cell->storage));
+    data = std::move(*element);
+    element->~T();
+
+    // Hand the cell to the producer one lap ahead.
+    cell->sequence.store(position + this->mask + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+template <class F>
+int ConcurrentQueue<T>::drain(F consume, int maxCount)
+{
+    int count = 0;
+    size_t position;
+    Cell *cell;
+    while (count < maxCount && (cell = this->claimDequeue(position)) != nullptr)
+    {
+        T *element = std::launder(reinterpret_cast<T *>(cell->storage));
+        T data(std::move(*element));
+        element->~T();
+        cell->sequence.store(position + this->mask + 1, std::memory_order_release);
+
+        consume(std::move(data));
+        count++;
+    }
+    return count;
+}
+
+template <class T>
+int ConcurrentQueue<T>::getCapacity()
+{
+    return (int)(this->mask + 1);
+}
+
+template <class T>
+int ConcurrentQueue<T>::getSize()
+{
+    size_t enqueued = this->enqueuePos.load(std::memory_order_relaxed);
+    size_t dequeued = this->dequeuePos.load(std::memory_order_relaxed);
+    return enqueued > dequeued ? (int)(enqueued - dequeued) : 0;
+}
+
+template <class T>
+bool ConcurrentQueue<T>::isEmpty()
+{
+    return this->getSize() == 0;
+}
+
+template <class T>
+typename ConcurrentQueue<T>::Cell *ConcurrentQueue<T>::claimEnqueue(size_t &position)
+{
+    position = this->enqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Cell *cell = &this->cells[position & this->mask];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+        if (difference == 0)
+        {
+            // The cell is free for this position; take the position unless another producer got it first.
+            if (this->enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                return cell;
+            }
+        }
+        else if (difference < 0)
+        {
+            // The cell still holds the element from one lap ago: the queue is full.
+            return nullptr;
+        }
+        else
+        {
+            position = this->enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <class T>
+typename ConcurrentQueue<T>::Cell *ConcurrentQueue<T>::claimDequeue(size_t &position)
+{
+    position = this->dequeuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Cell *cell = &this->cells[position & this->mask];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+
+        if (difference == 0)
+        {
+            // The cell holds the element for this position; take it unless another consumer got it first.
+            if (this->dequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                return cell;
+            }
+        }
+        else if (difference < 0)
+        {
+            // No producer has filled the cell yet: the queue is empty.
+            return nullptr;
+        }
+        else
+        {
+            position = this->dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace List
+{
+    /**
+     * @brief Template class representing an open-addressing hash map from unique keys to values.
+     * Slots are grouped by 16, and one control byte per slot holds 7 bits of the key's hash (or marks the slot
+     * empty or deleted). A lookup compares the control bytes of a whole group at once, with SSE2 where available,
+     * and only reads the slots whose bits match, so lookups are O(1) with about one cache miss.
+     * @tparam K The type of the keys.
+     * @tparam V The type of the values.
+     * @tparam H The type of the hash function.
+     */
+    template <class K, class V, class H = std::hash<K>>
+    class HashMap
+    {
+    public:
+        /**
+         * @brief Constructs an empty hash map.
+         */
+        HashMap();
+
+        /**
+         * @brief Destructor.
+         */
+        ~HashMap();
+
+        /**
+         * @brief Hash maps are not copied.
+         */
+        HashMap(const HashMap<K, V, H> &other) = delete;
+
+        /**
+         * @brief Hash maps are not copied.
+         */
+        HashMap<K, V, H> &operator=(const HashMap<K, V, H> &other) = delete;
+
+        /**
+         * @brief Resets the hash map to an empty state, keeping its capacity.
+         */
+        void reset();
+
+        /**
+         * @brief Makes room for a number of keys, so inserting up to that many does not rehash.
+         * @param count The number of keys.
+         */
+        void reserve(int count);
+
+        /**
+         * @brief Inserts a key with its value, replacing the value if the key is already present.
+         * @param key The key to insert.
+         * @param value The value to store with the key.
+         */
+        void insert(K key, V value);
+
+        /**
+         * @brief Inserts several keys with their values, as insert(key, value) one after the other. The table is
+         * grown once, and the probe of each key is fetched into cache a few keys ahead, so the cache misses of
+         * keys spread over a large table overlap instead of coming one at a time.
+         * @param keys The keys to insert.
+         * @param values The value of each key.
+         * @param count The number of keys.
+         */
+        void insert(K keys[], V values[], int count);
+
+        /**
+         * @brief Removes a key and its value.
+         * @param key The key to remove.
+         * @return true if the key was present, false otherwise.
+         */
+        bool remove(K key);
+
+        /**
+         * @brief Looks up the value of a key.
+         * @param key The key to look up.
+         * @return Pointer to the value, or nullptr if the key is not present. Only valid until the next insert.
+         */
+        V *find(K key);
+
+        /**
+         * @brief Checks if a key is present.
+         * @param key The key to look for.
+         * @return true if the key is present, false otherwise.
+         */
+        bool contains(K key);
+
+        /**
+         * @brief Checks if the hash map is empty.
+         * @return true if the hash map is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets the number of keys in the hash map.
+         * @return The size of the hash map.
+         */
+        int getSize();
+
+    private:
+        static const int GROUP_SIZE = 16;     /**< Number of slots whose control bytes are compared at once */
+        static const int8_t EMPTY = -128;     /**< Control byte of a slot that was never used */
+        static const int8_t DELETED = -2;     /**< Control byte of a slot whose key was removed */
+
+        /**
+         * @brief A key with its value.
+         */
+        struct Slot
+        {
+            K key;   /**< The key */
+            V value; /**< The value of the key */
+        };
+
+        int8_t *control;  /**< One control byte per slot: EMPTY, DELETED, or the low 7 bits of the key's hash */
+        Slot *slots;      /**< Raw storage for the slots, constructed only where the control byte is a hash */
+        int capacity;     /**< Number of slots, a power of two and a multiple of GROUP_SIZE, or 0 before the first insert */
+        int size;         /**< Number of keys */
+        int growthLeft;   /**< Number of empty slots that may still be filled before rehashing */
+        H hasher;         /**< The hash function */
+
+        /**
+         * @brief Hashes a key, mixing the bits so that keys like consecutive IDs spread over the table.
+         * @param key The key to hash.
+         * @return The mixed hash.
+         */
+        uint64_t hash(K &key);
+
+        /**
+         * @brief Finds the slot holding a key.
+         * @param key The key to look for.
+         * @param hash The mixed hash of the key.
+         * @return The index of the slot, or -1 if the key is not present.
+         */
+        int findSlot(K &key, uint64_t hash);
+
+        /**
+         * @brief Finds the first empty or deleted slot on the probe sequence of a hash.
+         * @param hash The mixed hash of a key.
+         * @return The index of the slot.
+         */
+        int findFreeSlot(uint64_t hash);
+
+        /**
+         * @brief Starts loading an address into cache, without waiting for it.
+         * @param address The address to load.
+         */
+        static void prefetch(const void *address);
+
+        /**
+         * @brief Moves every key into a new table.
+         * @param newCapacity The number of slots of the new table.
+         */
+        void rehash(int newCapacity);
+
+        /**
+         * @brief Allocates an empty table.
+         * @param newCapacity The number of slots of the table.
+         */
+        void allocate(int newCapacity);
+
+        /**
+         * @brief Destroys every key and frees the table.
+         */
+        void release();
+
+        /**
+         * @brief Compares the control bytes of a group against a byte.
+         * @param group The first control byte of the group.
+         * @param byte The byte to compare against.
+         * @return A mask with bit i set if control byte i of the group equals the byte.
+         */
+        static uint32_t match(const int8_t *group, int8_t byte);
+
+        /**
+         * @brief Finds the free slots of a group.
+         * @param group The first control byte of the group.
+         * @return A mask with bit i set if slot i of the group is empty or deleted.
+         */
+        static uint32_t matchFree(const int8_t *group);
+
+        /**
+         * @param mask A non-zero mask.
+         * @return The index of the lowest set bit of the mask.
+         */
+        static int lowestBit(uint32_t mask);
+    };
+}
+
+#include "structs/hashMap.hpp"
\ No newline at end of file
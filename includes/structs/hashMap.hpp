@@ -0,0 +1,352 @@
+#include <new>
+#include <utility>
+#include "structs/hashMap.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HMS_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace List;
+
+template <class K, class V, class H>
+HashMap<K, V, H>::HashMap() : control(nullptr), slots(nullptr), capacity(0), size(0), growthLeft(0), hasher(){};
+
+template <class K, class V, class H>
+HashMap<K, V, H>::~HashMap()
+{
+    this->release();
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::reset()
+{
+    for (int i = 0; i < this->capacity; i++)
+    {
+        if (this->control[i] >= 0)
+        {
+            this->slots[i].~Slot();
+        }
+        this->control[i] = EMPTY;
+    }
+    this->size = 0;
+    this->growthLeft = this->capacity - this->capacity / 8;
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::reserve(int count)
+{
+    // Keep the load at 7/8 at most.
+    int newCapacity = GROUP_SIZE;
+    while (newCapacity - newCapacity / 8 < count)
+    {
+        newCapacity *= 2;
+    }
+
+    if (newCapacity > this->capacity)
+    {
+        this->rehash(newCapacity);
+    }
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::insert(K key, V value)
+{
+    uint64_t hash = this->hash(key);
+    int index = this->capacity ? this->findSlot(key, hash) : -1;
+    if (index != -1)
+    {
+        this->slots[index].value = std::move(value);
+        return;
+    }
+
+    index = this->capacity ? this->findFreeSlot(hash) : -1;
+    if (index == -1 || (this->control[index] == EMPTY && this->growthLeft == 0))
+    {
+        // Double the table when it is really full, otherwise the deleted slots are what ran it out of room.
+        int newCapacity = this->capacity == 0 ? GROUP_SIZE : this->capacity;
+        if (this->size + 1 > (newCapacity - newCapacity / 8) / 2)
+        {
+            newCapacity *= 2;
+        }
+        this->rehash(newCapacity);
+        index = this->findFreeSlot(hash);
+    }
+
+    if (this->control[index] == EMPTY)
+    {
+        this->growthLeft--;
+    }
+    this->control[index] = (int8_t)(hash & 0x7F);
+    new (&this->slots[index]) Slot{std::move(key), std::move(value)};
+    this->size++;
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::insert(K keys[], V values[], int count)
+{
+    // The control bytes of a key are fetched AHEAD keys early. Half way there they are in cache, so the free
+    // slot the key will most likely take is known and fetched too.
+    const int AHEAD = 16;
+    this->reserve(this->size + count);
+    for (int i = -AHEAD; i < count; i++)
+    {
+        if (i + AHEAD < count)
+        {
+            this->prefetch(this->control + (this->hash(keys[i + AHEAD]) >> 7 & (this->capacity / GROUP_SIZE - 1)) * GROUP_SIZE);
+        }
+        if (i + AHEAD / 2 >= 0 && i + AHEAD / 2 < count)
+        {
+            this->prefetch(this->slots + this->findFreeSlot(this->hash(keys[i + AHEAD / 2])));
+        }
+        if (i >= 0)
+        {
+            this->insert(keys[i], values[i]);
+        }
+    }
+}
+
+template <class K, class V, class H>
+bool HashMap<K, V, H>::remove(K key)
+{
+    if (this->size == 0)
+    {
+        return false;
+    }
+
+    int index = this->findSlot(key, this->hash(key));
+    if (index == -1)
+    {
+        return false;
+    }
+
+    this->slots[index].~Slot();
+    this->size--;
+
+    // Lookups stop at the first group with an empty slot, so if this group has one the slot can become empty again.
+    int8_t *group = this->control + (index & ~(GROUP_SIZE - 1));
+    if (match(group, EMPTY))
+    {
+        this->control[index] = EMPTY;
+        this->growthLeft++;
+    }
+    else
+    {
+        this->control[index] = DELETED;
+    }
+    return true;
+}
+
+template <class K, class V, class H>
+V *HashMap<K, V, H>::find(K key)
+{
+    if (this->size == 0)
+    {
+        return nullptr;
+    }
+
+    int index = this->findSlot(key, this->hash(key));
+    return index == -1 ? nullptr : &this->slots[index].value;
+}
+
+template <class K, class V, class H>
+bool HashMap<K, V, H>::contains(K key)
+{
+    return this->find(key) != nullptr;
+}
+
+template <class K, class V, class H>
+bool HashMap<K, V, H>::isEmpty()
+{
+    return this->size == 0;
+}
+
+template <class K, class V, class H>
+int HashMap<K, V, H>::getSize()
+{
+    return this->size;
+}
+
+template <class K, class V, class H>
+uint64_t HashMap<K, V, H>::hash(K &key)
+{
+    // Fibonacci hashing: the multiplication carries every input bit into the high bits.
+    uint64_t hash = (uint64_t)this->hasher(key) * 0x9E3779B97F4A7C15ull;
+    return hash ^ (hash >> 32);
+}
+
+template <class K, class V, class H>
+int HashMap<K, V, H>::findSlot(K &key, uint64_t hash)
+{
+    int8_t byte = (int8_t)(hash & 0x7F);
+    int groupMask = this->capacity / GROUP_SIZE - 1;
+    int group = (int)(hash >> 7) & groupMask;
+
+    // Triangular probing visits every group once.
+    for (int step = 1;; step++)
+    {
+        int8_t *groupControl = this->control + group * GROUP_SIZE;
+        for (uint32_t candidates = match(groupControl, byte); candidates; candidates &= candidates - 1)
+        {
+            int index = group * GROUP_SIZE + lowestBit(candidates);
+            if (this->slots[index].key == key)
+            {
+                return index;
+            }
+        }
+
+        if (match(groupControl, EMPTY) || step > groupMask)
+        {
+            return -1;
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+template <class K, class V, class H>
+int HashMap<K, V, H>::findFreeSlot(uint64_t hash)
+{
+    int groupMask = this->capacity / GROUP_SIZE - 1;
+    int group = (int)(hash >> 7) & groupMask;
+    for (int step = 1; step <= groupMask + 1; step++)
+    {
+        uint32_t free = matchFree(this->control + group * GROUP_SIZE);
+        if (free)
+        {
+            return group * GROUP_SIZE + lowestBit(free);
+        }
+        group = (group + step) & groupMask;
+    }
+    return -1;
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::prefetch(const void *address)
+{
+#ifdef HMS_HASH_MAP_SSE2
+    _mm_prefetch((const char *)address, _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::rehash(int newCapacity)
+{
+    int8_t *oldControl = this->control;
+    Slot *oldSlots = this->slots;
+    int oldCapacity = this->capacity;
+
+    this->allocate(newCapacity);
+    this->growthLeft -= this->size;
+    for (int i = 0; i < oldCapacity; i++)
+    {
+        if (oldControl[i] < 0)
+        {
+            continue;
+        }
+
+        uint64_t hash = this->hash(oldSlots[i].key);
+        int index = this->findFreeSlot(hash);
+        this->control[index] = (int8_t)(hash & 0x7F);
+        new (&this->slots[index]) Slot(std::move(oldSlots[i]));
+        oldSlots[i].~Slot();
+    }
+
+    if (oldControl != nullptr)
+    {
+        ::operator delete(oldControl, std::align_val_t(GROUP_SIZE));
+    }
+    ::operator delete(oldSlots);
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::allocate(int newCapacity)
+{
+    // Group loads are aligned, so the control bytes start on a 16 byte boundary.
+    this->control = (int8_t *)::operator new(newCapacity, std::align_val_t(GROUP_SIZE));
+    for (int i = 0; i < newCapacity; i++)
+    {
+        this->control[i] = EMPTY;
+    }
+
+    this->slots = (Slot *)::operator new(sizeof(Slot) * newCapacity);
+    this->capacity = newCapacity;
+    this->growthLeft = newCapacity - newCapacity / 8;
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::release()
+{
+    for (int i = 0; i < this->capacity; i++)
+    {
+        if (this->control[i] >= 0)
+        {
+            this->slots[i].~Slot();
+        }
+    }
+    if (this->control != nullptr)
+    {
+        ::operator delete(this->control, std::align_val_t(GROUP_SIZE));
+    }
+    ::operator delete(this->slots);
+
+    this->control = nullptr;
+    this->slots = nullptr;
+    this->capacity = 0;
+    this->size = 0;
+    this->growthLeft = 0;
+}
+
+template <class K, class V, class H>
+uint32_t HashMap<K, V, H>::match(const int8_t *group, int8_t byte)
+{
+#ifdef HMS_HASH_MAP_SSE2
+    __m128i bytes = _mm_load_si128((const __m128i *)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(byte)));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < GROUP_SIZE; i++)
+    {
+        if (group[i] == byte)
+        {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+template <class K, class V, class H>
+uint32_t HashMap<K, V, H>::matchFree(const int8_t *group)
+{
+#ifdef HMS_HASH_MAP_SSE2
+    // Empty and deleted are the only negative control bytes, so the sign bits are the mask.
+    return (uint32_t)_mm_movemask_epi8(_mm_load_si128((const __m128i *)group));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < GROUP_SIZE; i++)
+    {
+        if (group[i] < 0)
+        {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+template <class K, class V, class H>
+int HashMap<K, V, H>::lowestBit(uint32_t mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int)index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "structs/hashMap.h"
+
+namespace List
+{
+    /**
+     * @brief Template class representing an indexed d-ary heap: a priority queue of handles whose priorities
+     * can be changed or removed after they are queued.
+     * Each handle's position in the heap is tracked, so update, remove and dequeue are O(log n) and peek is O(1).
+     * A d-ary heap is shallower than a binary one, and the D children of a node sit next to each other in memory.
+     * @tparam H The type of the handles, unique within the heap.
+     * @tparam P The type of the priorities.
+     * @tparam D The number of children of each node.
+     * @tparam C The type of the comparison, returning true if the first priority goes before the second.
+     */
+    template <class H, class P, int D = 4, class C = std::less<P>>
+    class IndexedHeap
+    {
+    public:
+        static_assert(D >= 2, "A heap node needs at least two children");
+
+        /**
+         * @brief Constructs an empty indexed heap.
+         * @param compare The comparison deciding which priority goes first.
+         */
+        IndexedHeap(C compare = C());
+
+        /**
+         * @brief Resets the indexed heap to an empty state.
+         */
+        void reset();
+
+        /**
+         * @brief Queues a handle with a priority, or moves an already queued handle to its new priority.
+         * @param handle The handle.
+         * @param priority The priority of the handle.
+         */
+        void update(H handle, P priority);
+
+        /**
+         * @brief Replaces the heap with a set of handles, sorting them into place instead of queueing them one by one.
+         * @param handles The handles, each at most once.
+         * @param priorities The priority of each handle.
+         * @param count The number of handles.
+         */
+        void bulkLoad(H handles[], P priorities[], int count);
+
+        /**
+         * @brief Removes a handle from the heap.
+         * @param handle The handle to remove.
+         * @return true if the handle was queued, false otherwise.
+         */
+        bool remove(H handle);
+
+        /**
+         * @brief Checks if a handle is queued.
+         * @param handle The handle to look for.
+         * @return true if the handle is queued, false otherwise.
+         */
+        bool contains(H handle);
+
+        /**
+         * @brief Gets the priority of a queued handle.
+         * @param handle The handle.
+         * @return Pointer to the priority, or nullptr if the handle is not queued.
+         */
+        P *getPriority(H handle);
+
+        /**
+         * @brief Gets the handle at the front of the heap. Among equal priorities the smallest handle goes first.
+         * @return Pointer to the handle that goes first.
+         */
+        H *peek();
+
+        /**
+         * @brief Removes the handle at the front of the heap.
+         */
+        void dequeue();
+
+        /**
+         * @brief Checks if the indexed heap is empty.
+         * @return true if the indexed heap is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets the number of handles in the indexed heap.
+         * @return The size of the indexed heap.
+         */
+        int getSize();
+
+    protected:
+        /**
+         * @brief A queued handle with its priority.
+         */
+        struct Entry
+        {
+            H handle;   /**< The handle */
+            P priority; /**< The priority of the handle */
+        };
+
+        std::vector<Entry> entries;           /**< The heap, with the children of i at D*i+1 to D*i+D */
+        HashMap<H, int> positions;            /**< The index of each handle in the heap */
+        C compare;                            /**< The comparison deciding which priority goes first */
+
+        /**
+         * @brief Checks if an entry goes before another, breaking ties by handle.
+         * @param entry The first entry.
+         * @param other The second entry.
+         * @return true if the first entry goes before the second, false otherwise.
+         */
+        bool before(Entry &entry, Entry &other);
+
+        /**
+         * @brief Removes the entry at an index, filling the hole with the last entry.
+         * @param index The index of the entry.
+         */
+        void removeAt(int index);
+
+        /**
+         * @brief Moves an entry up until its parent goes before it.
+         * @param index The index of the entry.
+         */
+        void siftUp(int index);
+
+        /**
+         * @brief Moves an entry down until it goes before all of its children.
+         * @param index The index of the entry.
+         */
+        void siftDown(int index);
+
+        /**
+         * @brief Stores an entry at an index and records its position.
+         * @param index The index to store at.
+         * @param entry The entry to store.
+         */
+        void place(int index, Entry &&entry);
+    };
+}
+
+#include "structs/indexedHeap.hpp"
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "structs/indexedHeap.h"
+
+using namespace List;
+
+template <class H, class P, int D, class C>
+IndexedHeap<H, P, D, C>::IndexedHeap(C compare) : entries(), positions(), compare(compare){};
+
+template <class H, class P, int D, class C>
+void IndexedHeap<H, P, D, C>::reset()
+{
+    this->entries.clear();
+    this->positions.reset();
+}
+
+template <class H, class P, int D, class C>
+void IndexedHeap<H, P, D, C>::update(H handle, P priority)
+{
+    int *found = this->positions.find(handle);
+    if (found == nullptr)
+    {
+        int index = this->getSize();
+        this->entries.push_back({handle, priority});
+        this->positions.insert(handle, index);
+        this->siftUp(index);
+        return;
+    }
+
+    // The entry moves up if it now goes before its parent, otherwise down if it goes after a child.
+    int index = *found;
+    this->entries[index].priority = priority;
+    this->siftUp(index);
+    this->siftDown(*this->positions.find(handle));
+}
+
+template <class H, class P, int D, class C>
+void IndexedHeap<H, P, D, C>::bulkLoad(H handles[], P priorities[], int count)
+{
+    this->reset();
+    this->entries.reserve(count);
+    for (int i = 0; i < count; i++)
+    {
+        this->entries.push_back({handles[i], priorities[i]});
+    }
+
+    // An array in order is a heap, and sorting it moves the entries without recording every position on the way.
+    auto goesFirst = [this](Entry &entry, Entry &other)
+    { return this->before(entry, other); };
+    std::sort(this->entries.begin(), this->entries.end(), goesFirst);
+    this->positions.reserve(count);
+    for (int i = 0; i < count; i++)
+    {
+        this->positions.insert(this->entries[i].handle, i);
+    }
+}
+
+template <class H, class P, int D, class C>
+bool IndexedHeap<H, P, D, C>::remove(H handle)
+{
+    int *found = this->positions.find(handle);
+    if (found == nullptr)
+    {
+        return false;
+    }
+
+    this->removeAt(*found);
+    return true;
+}
+
+template <class H, class P, int D, class C>
+bool IndexedHeap<H, P, D, C>::contains(H handle)
+{
+    return this->positions.contains(handle);
+}
+
+template <class H, class P, int D, class C>
+P *IndexedHeap<H, P, D, C>::getPriority(H handle)
+{
+    int *found = this->positions.find(handle);
+    if (found == nullptr)
+    {
+        return nullptr;
+    }
+
+    return &this->entries[*found].priority;
+}
+
+template <class H, class P, int D, class C>
+H *IndexedHeap<H, P, D, C>::peek()
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("Queue is empty.");
+    }
+
+    return &this->entries.front().handle;
+}
+
+template <class H, class P, int D, class C>
+void IndexedHeap<H, P, D, C>::dequeue()
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("Queue is empty.");
+    }
+
+    this->removeAt(0);
+}
+
+template <class H, class P, int D, class C>
+bool IndexedHeap<H, P, D, C>::isEmpty()
+{
+    return this->entries.empty();
+}
+
+template <class H, class P, int D, class C>
+int IndexedHeap<H, P, D, C>::getSize()
+{
+    return (int)this->entries.size();
+}
+
+template <class H, class P, int D, class C>
+bool IndexedHeap<H, P, D, C>::before(Entry &entry, Entry &other)
+{
+    if (this->compare(entry.priority, other.priority))
+    {
+        return true;
+    }
+    if (this->compare(other.priority, entry.priority))
+    {
+        return false;
+    }
+    return entry.handle < other.handle;
+}
+
+template <class H, class P, int D, class C>
+void IndexedHeap<H, P, D, C>::removeAt(int index)
+{
+    this->positions.remove(this->entries[index].handle);
+
+    int last = this->getSize() - 1;
+    if (index == last)
+    {
+        this->entries.pop_back();
+        return;
+    }
+
+    // Fill the hole with the last entry, which then moves up or down into place.
+    H moved = this->entries[last].handle;
+    this->place(index, std::move(this->entries[last]));
+    this->entries.pop_back();
+    this->siftUp(index);
+    this->siftDown(*this->positions.find(moved));
+}
+
+template <class H, class P, int D, class C>
+void IndexedHeap<H, P, D, C>::siftUp(int index)
+{
+    Entry entry = std::move(this->entries[index]);
+    while (index > 0)
+    {
+        int parent = (index - 1) / D;
+        if (!this->before(entry, this->entries[parent]))
+        {
+            break;
+        }
+
+        this->place(index, std::move(this->entries[parent]));
+        index = parent;
+    }
+    this->place(index, std::move(entry));
+}
+
+template <class H, class P, int D, class C>
+void IndexedHeap<H, P, D, C>::siftDown(int index)
+{
+    int size = this->getSize();
+    Entry entry = std::move(this->entries[index]);
+    while (true)
+    {
+        int first = D * index + 1;
+        if (first >= size)
+        {
+            break;
+        }
+
+        // Pick the child that goes first.
+        int child = first;
+        int end = first + D < size ? first + D : size;
+        for (int i = first + 1; i < end; i++)
+        {
+            if (this->before(this->entries[i], this->entries[child]))
+            {
+                child = i;
+            }
+        }
+
+        if (!this->before(this->entries[child], entry))
+        {
+            break;
+        }
+
+        this->place(index, std::move(this->entries[child]));
+        index = child;
+    }
+    this->place(index, std::move(entry));
+}
+
+template <class H, class P, int D, class C>
+void IndexedHeap<H, P, D, C>::place(int index, Entry &&entry)
+{
+    this->positions.insert(entry.handle, index);
+    this->entries[index] = std::move(entry);
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+namespace List
+{
+    /**
+     * @brief Hook embedded in an object so it can be linked into an IntrusiveList without a separate node.
+     * An object can be in as many intrusive lists at once as it has hooks. The hook unlinks itself when the
+     * object is destroyed; copying an object gives the copy unlinked hooks and leaves the original's links alone.
+     * @tparam T The type of the object embedding the hook.
+     */
+    template <class T>
+    class IntrusiveHook
+    {
+    public:
+        IntrusiveHook<T> *prev; /**< The previous hook in the list, nullptr when unlinked */
+        IntrusiveHook<T> *next; /**< The next hook in the list, nullptr when unlinked */
+        T *owner;               /**< The object embedding the hook, nullptr for the root of a list */
+        int *size;              /**< The size counter of the list the hook is linked into */
+
+        /**
+         * @brief Constructs an unlinked hook.
+         */
+        IntrusiveHook();
+
+        /**
+         * @brief Constructs an unlinked hook; links belong to the object, not to its copies.
+         * @param other The hook of the object being copied.
+         */
+        IntrusiveHook(const IntrusiveHook<T> &other);
+
+        /**
+         * @brief Keeps the links of this hook; links belong to the object, not to its copies.
+         * @param other The hook of the object being copied.
+         * @return Reference to this hook.
+         */
+        IntrusiveHook<T> &operator=(const IntrusiveHook<T> &other);
+
+        /**
+         * @brief Destructor. Unlinks the hook from its list.
+         */
+        ~IntrusiveHook();
+
+        /**
+         * @brief Checks if the hook is linked into a list.
+         * @return true if the hook is linked, false otherwise.
+         */
+        bool isLinked();
+
+        /**
+         * @brief Links the hook before another hook of a list.
+         * @param position The hook to link before.
+         * @param owner The object embedding the hook.
+         * @param size The size counter of the list, incremented.
+         */
+        void linkBefore(IntrusiveHook<T> *position, T *owner, int *size);
+
+        /**
+         * @brief Unlinks the hook from its list in O(1). Does nothing if the hook is not linked.
+         */
+        void unlink();
+    };
+}
+
+#include "structs/intrusiveHook.hpp"
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "structs/intrusiveHook.h"
+
+using namespace List;
+
+template <class T>
+IntrusiveHook<T>::IntrusiveHook() : prev(nullptr), next(nullptr), owner(nullptr), size(nullptr){};
+
+template <class T>
+IntrusiveHook<T>::IntrusiveHook(const IntrusiveHook<T> &) : IntrusiveHook<T>(){};
+
+template <class T>
+IntrusiveHook<T> &IntrusiveHook<T>::operator=(const IntrusiveHook<T> &)
+{
+    return *this;
+};
+
+template <class T>
+IntrusiveHook<T>::~IntrusiveHook()
+{
+    this->unlink();
+}
+
+template <class T>
+bool IntrusiveHook<T>::isLinked()
+{
+    return this->next != nullptr;
+}
+
+template <class T>
+void IntrusiveHook<T>::linkBefore(IntrusiveHook<T> *position, T *owner, int *size)
+{
+    this->prev = position->prev;
+    this->next = position;
+    this->owner = owner;
+    this->size = size;
+
+    position->prev->next = this;
+    position->prev = this;
+    (*size)++;
+}
+
+template <class T>
+void IntrusiveHook<T>::unlink()
+{
+    if (!this->isLinked())
+    {
+        return;
+    }
+
+    this->prev->next = this->next;
+    this->next->prev = this->prev;
+    (*this->size)--;
+
+    this->prev = nullptr;
+    this->next = nullptr;
+    this->owner = nullptr;
+    this->size = nullptr;
+}
\ No newline at end of file
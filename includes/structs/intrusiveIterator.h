@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include "structs/intrusiveHook.h"
+
+namespace List
+{
+    /**
+     * @brief Iterator over the objects of an intrusive list.
+     * Offers both the hasNext/getData/next interface of Iterator<T> and the standard library
+     * bidirectional iterator interface.
+     * @tparam T The type of the objects in the list.
+     */
+    template <class T>
+    class IntrusiveIterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag; /**< Hooks are linked both ways */
+        using value_type = T;                                      /**< The type of the objects */
+        using difference_type = std::ptrdiff_t;                    /**< The type of the distance between two iterators */
+        using pointer = T *;                                       /**< Pointer to an object */
+        using reference = T &;                                     /**< Reference to an object */
+
+        /**
+         * @brief Constructs an iterator positioned on a hook of a list.
+         * @param hook The hook of the current object.
+         * @param root The root hook of the list, which marks its end.
+         */
+        IntrusiveIterator(IntrusiveHook<T> *hook, IntrusiveHook<T> *root);
+
+        /**
+         * @return true if there is a next object, false otherwise.
+         */
+        bool hasNext();
+
+        /**
+         * @return Pointer to the current object, or nullptr at the end of the list.
+         */
+        T *getData();
+
+        /**
+         * @brief The `next` method advances the iterator to the next object in the list.
+         */
+        void next();
+
+        /**
+         * @return A standard library iterator to the current object.
+         */
+        IntrusiveIterator<T> begin();
+
+        /**
+         * @return A standard library iterator past the last object.
+         */
+        IntrusiveIterator<T> end();
+
+        /**
+         * @return Reference to the current object.
+         */
+        reference operator*() const;
+
+        /**
+         * @return Pointer to the current object.
+         */
+        pointer operator->() const;
+
+        /**
+         * @brief Advances the iterator to the next object.
+         * @return Reference to this iterator after advancing.
+         */
+        IntrusiveIterator<T> &operator++();
+
+        /**
+         * @brief Advances the iterator to the next object.
+         * @return A copy of the iterator before advancing.
+         */
+        IntrusiveIterator<T> operator++(int);
+
+        /**
+         * @brief Moves the iterator back to the previous object.
+         * @return Reference to this iterator after moving.
+         */
+        IntrusiveIterator<T> &operator--();
+
+        /**
+         * @brief Moves the iterator back to the previous object.
+         * @return A copy of the iterator before moving.
+         */
+        IntrusiveIterator<T> operator--(int);
+
+        /**
+         * @param other The iterator to compare with.
+         * @return true if both iterators are on the same object, false otherwise.
+         */
+        bool operator==(const IntrusiveIterator<T> &other) const;
+
+        /**
+         * @param other The iterator to compare with.
+         * @return true if the iterators are on different objects, false otherwise.
+         */
+        bool operator!=(const IntrusiveIterator<T> &other) const;
+
+    private:
+        IntrusiveHook<T> *hook; /**< The hook of the current object */
+        IntrusiveHook<T> *root; /**< The root hook of the list */
+    };
+}
+
+#include "structs/intrusiveIterator.hpp"
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "structs/intrusiveIterator.h"
+
+using namespace List;
+
+template <class T>
+IntrusiveIterator<T>::IntrusiveIterator(IntrusiveHook<T> *hook, IntrusiveHook<T> *root) : hook(hook), root(root){};
+
+template <class T>
+bool IntrusiveIterator<T>::hasNext()
+{
+    return this->hook->next != this->root;
+}
+
+template <class T>
+T *IntrusiveIterator<T>::getData()
+{
+    if (this->hook == this->root)
+    {
+        return nullptr;
+    }
+    return this->hook->owner;
+}
+
+template <class T>
+void IntrusiveIterator<T>::next()
+{
+    this->hook = this->hook->next;
+}
+
+template <class T>
+IntrusiveIterator<T> IntrusiveIterator<T>::begin()
+{
+    return *this;
+}
+
+template <class T>
+IntrusiveIterator<T> IntrusiveIterator<T>::end()
+{
+    return IntrusiveIterator<T>(this->root, this->root);
+}
+
+template <class T>
+typename IntrusiveIterator<T>::reference IntrusiveIterator<T>::operator*() const
+{
+    return *this->hook->owner;
+}
+
+template <class T>
+typename IntrusiveIterator<T>::pointer IntrusiveIterator<T>::operator->() const
+{
+    return this->hook->owner;
+}
+
+template <class T>
+IntrusiveIterator<T> &IntrusiveIterator<T>::operator++()
+{
+    this->hook = this->hook->next;
+    return *this;
+}
+
+template <class T>
+IntrusiveIterator<T> IntrusiveIterator<T>::operator++(int)
+{
+    IntrusiveIterator<T> previous = *this;
+    this->hook = this->hook->next;
+    return previous;
+}
+
+template <class T>
+IntrusiveIterator<T> &IntrusiveIterator<T>::operator--()
+{
+    this->hook = this->hook->prev;
+    return *this;
+}
+
+template <class T>
+IntrusiveIterator<T> IntrusiveIterator<T>::operator--(int)
+{
+    IntrusiveIterator<T> following = *this;
+    this->hook = this->hook->prev;
+    return following;
+}
+
+template <class T>
+bool IntrusiveIterator<T>::operator==(const IntrusiveIterator<T> &other) const
+{
+    return this->hook == other.hook;
+}
+
+template <class T>
+bool IntrusiveIterator<T>::operator!=(const IntrusiveIterator<T> &other) const
+{
+    return this->hook != other.hook;
+}
\ No newline at end of file
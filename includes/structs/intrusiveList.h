@@ -0,0 +1,134 @@
+#pragma once
+
+#include <vector>
+#include "structs/intrusiveHook.h"
+#include "structs/intrusiveIterator.h"
+#include "structs/sortKey.h"
+#include "structs/parallelSort.h"
+
+namespace List
+{
+    /**
+     * @brief Template class representing an intrusive doubly linked list.
+     * The list links objects through a hook they embed instead of copying them into nodes, so no node is
+     * allocated, linking and unlinking an object are O(1), and an object with several hooks can be in
+     * several lists at once. The list does not own the objects; an object leaves the list when it is destroyed.
+     * @tparam T The type of the objects in the list.
+     * @tparam Hook The member of T used to link the objects into this list.
+     */
+    template <class T, IntrusiveHook<T> T::*Hook>
+    class IntrusiveList
+    {
+    public:
+        using iterator = IntrusiveIterator<T>; /**< Standard library iterator */
+
+        /**
+         * @brief Constructs an empty intrusive list.
+         */
+        IntrusiveList();
+
+        /**
+         * @brief Destructor. Unlinks every object.
+         */
+        ~IntrusiveList();
+
+        /**
+         * @brief Intrusive lists are not copied; the objects' hooks point into the list.
+         */
+        IntrusiveList(const IntrusiveList<T, Hook> &other) = delete;
+
+        /**
+         * @brief Intrusive lists are not copied; the objects' hooks point into the list.
+         */
+        IntrusiveList<T, Hook> &operator=(const IntrusiveList<T, Hook> &other) = delete;
+
+        /**
+         * @brief Unlinks every object, leaving the list empty.
+         */
+        void reset();
+
+        /**
+         * @brief Links an object at the end of the list. An object already linked through the same hook
+         * is unlinked from its list first.
+         * @param data The object to link.
+         */
+        void addNode(T &data);
+
+        /**
+         * @brief Unlinks an object from the list in O(1).
+         * @param data The object to unlink.
+         */
+        void deleteNode(T &data);
+
+        /**
+         * @brief Checks in O(1) if an object is linked into this list.
+         * @param data The object to look for.
+         * @return true if the object is in the list, false otherwise.
+         */
+        bool contains(T &data);
+
+        /**
+         * @brief Gets the first object in the list.
+         * @return Pointer to the first object.
+         */
+        T *getFirst();
+
+        /**
+         * @brief Sorts the objects in the list using a custom comparison function.
+         * @tparam C The type of the comparison, a function pointer, lambda or function object.
+         * @param compare A callable returning true if the first object goes before the second.
+         */
+        template <class C>
+        void sortNodes(C compare);
+
+        /**
+         * @brief Sorts the objects in the list using a comparison function known at compile time.
+         * If SortKey<Compare> is specialized, each object's key is computed once and the keys are sorted instead.
+         * @tparam Compare The comparison function.
+         */
+        template <auto Compare>
+        void sortNodes();
+
+        /**
+         * @brief Checks if the intrusive list is empty.
+         * @return true if the intrusive list is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets the number of objects in the intrusive list.
+         * @return The size of the intrusive list.
+         */
+        int getSize();
+
+        /**
+         * @brief Returns an iterator for iterating through the intrusive list.
+         * @return An iterator for the intrusive list.
+         */
+        iterator iterate();
+
+        /**
+         * @brief Returns a standard library iterator to the first object.
+         * @return An iterator to the first object.
+         */
+        iterator begin();
+
+        /**
+         * @brief Returns a standard library iterator past the last object.
+         * @return An iterator past the last object.
+         */
+        iterator end();
+
+    private:
+        IntrusiveHook<T> root; /**< Root of the circular list of hooks, linked to itself when empty */
+        int size;              /**< The number of objects in the list, kept up to date by the hooks */
+
+        /**
+         * @brief Relinks the objects in the given order.
+         * @param order Every object of the list, in their new order.
+         */
+        void relink(std::vector<T *> &order);
+    };
+}
+
+#include "structs/intrusiveList.hpp"
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "structs/intrusiveList.h"
+
+using namespace List;
+
+template <class T, IntrusiveHook<T> T::*Hook>
+IntrusiveList<T, Hook>::IntrusiveList() : root(), size(0)
+{
+    this->root.prev = &this->root;
+    this->root.next = &this->root;
+};
+
+template <class T, IntrusiveHook<T> T::*Hook>
+IntrusiveList<T, Hook>::~IntrusiveList()
+{
+    this->reset();
+
+    // The root is not linked to anything once the list is gone.
+    this->root.prev = nullptr;
+    this->root.next = nullptr;
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::reset()
+{
+    while (this->root.next != &this->root)
+    {
+        this->root.next->unlink();
+    }
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::addNode(T &data)
+{
+    IntrusiveHook<T> &hook = data.*Hook;
+    hook.unlink();
+    hook.linkBefore(&this->root, &data, &this->size);
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::deleteNode(T &data)
+{
+    if (!this->contains(data))
+    {
+        throw std::out_of_range("Node not found");
+    }
+
+    (data.*Hook).unlink();
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::contains(T &data)
+{
+    return (data.*Hook).size == &this->size;
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+T *IntrusiveList<T, Hook>::getFirst()
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    return this->root.next->owner;
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+template <class C>
+void IntrusiveList<T, Hook>::sortNodes(C compare)
+{
+    std::vector<T *> order;
+    order.reserve(this->size);
+    for (T &data : *this)
+    {
+        order.push_back(&data);
+    }
+
+    // Stable, like the merge sort used by LinkedList<T>.
+    ParallelSort::stableSort(order.begin(), order.end(), [&compare](T *a, T *b)
+                             { return compare(*a, *b); });
+    this->relink(order);
+};
+
+template <class T, IntrusiveHook<T> T::*Hook>
+template <auto Compare>
+void IntrusiveList<T, Hook>::sortNodes()
+{
+    if constexpr (SortKey<Compare>::enabled)
+    {
+        // Compute every key once, sort the keys along with their objects, then relink the objects in that order.
+        using Key = decltype(SortKey<Compare>::key(*this->root.owner));
+        std::vector<std::pair<Key, T *>> entries;
+        entries.reserve(this->size);
+        for (T &data : *this)
+        {
+            entries.push_back(std::make_pair(SortKey<Compare>::key(data), &data));
+        }
+
+        ParallelSort::stableSort(entries.begin(), entries.end(), [](const std::pair<Key, T *> &a, const std::pair<Key, T *> &b)
+                                 { return a.first < b.first; });
+
+        std::vector<T *> order;
+        order.reserve(entries.size());
+        for (std::pair<Key, T *> &entry : entries)
+        {
+            order.push_back(entry.second);
+        }
+        this->relink(order);
+    }
+    else
+    {
+        this->sortNodes([](T &a, T &b)
+                        { return Compare(a, b); });
+    }
+};
+
+template <class T, IntrusiveHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::relink(std::vector<T *> &order)
+{
+    IntrusiveHook<T> *previous = &this->root;
+    for (T *data : order)
+    {
+        IntrusiveHook<T> *hook = &(data->*Hook);
+        previous->next = hook;
+        hook->prev = previous;
+        previous = hook;
+    }
+    previous->next = &this->root;
+    this->root.prev = previous;
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::isEmpty()
+{
+    return this->size == 0;
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+int IntrusiveList<T, Hook>::getSize()
+{
+    return this->size;
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::iterate()
+{
+    return iterator(this->root.next, &this->root);
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::begin()
+{
+    return iterator(this->root.next, &this->root);
+}
+
+template <class T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::end()
+{
+    return iterator(&this->root, &this->root);
+}
\ No newline at end of file
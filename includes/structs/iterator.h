@@ -1,6 +1,7 @@
 #pragma once
 
 #include "structs/node.h"
+#include "structs/listIterator.h"
 
 namespace List
 {
@@ -33,6 +34,19 @@ namespace List
 		 */
         void next();
 
+        /**
+         * @brief Returns a standard library iterator to the current node, so the rest of the list can be
+         * walked with a range-based for loop or passed to the standard algorithms.
+         * @return An iterator to the current node.
+         */
+        ListIterator<T> begin();
+
+        /**
+         * @brief Returns a standard library iterator past the last node.
+         * @return An iterator past the last node.
+         */
+        ListIterator<T> end();
+
     private:
     	/** 
 		 *@brief Keeps track of the iterator's position as it traverses the list.
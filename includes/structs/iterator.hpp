@@ -25,4 +25,16 @@ template <class T>
 void Iterator<T>::next()
 {
     this->current = this->current->next;
+}
+
+template <class T>
+ListIterator<T> Iterator<T>::begin()
+{
+    return ListIterator<T>(this->current);
+}
+
+template <class T>
+ListIterator<T> Iterator<T>::end()
+{
+    return ListIterator<T>();
 }
\ No newline at end of file
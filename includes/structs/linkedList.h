@@ -1,7 +1,11 @@
 #pragma once
 
 #include "structs/node.h"
+#include "structs/nodePool.h"
 #include "structs/iterator.h"
+#include "structs/listIterator.h"
+#include "structs/sortKey.h"
+#include "structs/parallelSort.h"
 
 namespace List
 {
@@ -13,13 +17,23 @@ namespace List
     class LinkedList
     {
     public:
+        using iterator = ListIterator<T>;                /**< Standard library iterator */
+        using const_iterator = ListIterator<T, const T>; /**< Standard library const iterator */
+
     	/**
          * @brief Constructs an empty linked list.
          */
         LinkedList();
+
+        /**
+         * @brief Constructs an empty linked list that allocates its nodes from a shared pool.
+         * @param pool The pool to allocate nodes from. It must outlive the list.
+         */
+        LinkedList(NodePool<T> *pool);
         
         /**
-         * @brief Copy constructor.
+         * @brief Copy constructor. The copy shares the other list's pool if that pool is shared,
+         * otherwise it gets a pool of its own.
          * @param other Another LinkedList object to copy from.
          */
         LinkedList(const LinkedList<T> &other);
@@ -30,6 +44,19 @@ namespace List
          * @return Reference to this LinkedList object after assignment.
          */
         LinkedList<T> &operator=(const LinkedList<T> &other);
+
+        /**
+         * @brief Move constructor. Takes over the nodes and the pool of the other list, leaving it empty.
+         * @param other Another LinkedList object to move from.
+         */
+        LinkedList(LinkedList<T> &&other);
+
+        /**
+         * @brief Move assignment operator. Takes over the nodes and the pool of the other list, leaving it empty.
+         * @param other Another LinkedList object to move from.
+         * @return Reference to this LinkedList object after assignment.
+         */
+        LinkedList<T> &operator=(LinkedList<T> &&other);
         
         /**
          * @brief Destructor.
@@ -46,29 +73,59 @@ namespace List
          * @param data The data to be added to the linked list.
          */
         void addNode(T &data);
+
+        /**
+         * @brief Adds a new node to the end of the linked list, moving the given data into it.
+         * @param data The data to be moved into the linked list.
+         */
+        void addNode(T &&data);
+
+        /**
+         * @brief Adds a new node to the end of the linked list, constructing its data in place.
+         * @tparam Args The types of the arguments.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <class... Args>
+        void emplaceNode(Args &&...args);
         
         /**
          * @brief Searches nodes in the linked list using a custom comparison function.
+         * @tparam L The type of the list receiving the matches (LinkedList<T>, ArrayList<T>, ...).
+         * @tparam C The type of the comparison, a function pointer, lambda or function object.
          * @tparam K The type of the value to compare against.
-         * @param list Another LinkedList object where matching nodes will be added.
-         * @param compare A function pointer to compare T and K.
+         * @param list Another list object where matching nodes will be added.
+         * @param compare A callable to compare T and K.
          * @param compareValue The value to compare against K.
          */
-        template <class K>
-        void searchNodes(LinkedList<T> &list, bool (*compare)(T &a, K b), K compareValue);
+        template <class L, class C, class K>
+        void searchNodes(L &list, C compare, K compareValue);
         
          /**
          * @brief Searches nodes in the linked list by comparing node data directly.
-         * @param list Another LinkedList object where matching nodes will be added.
+         * @tparam L The type of the list receiving the matches (LinkedList<T>, ArrayList<T>, ...).
+         * @param list Another list object where matching nodes will be added.
          * @param compareValue The value to compare against node data.
          */
-        void searchNodes(LinkedList<T> &list, T compareValue);
+        template <class L>
+        void searchNodes(L &list, T compareValue);
         
         /**
-         * @brief Sorts the nodes in the linked list using a custom comparison function. 
-         * @param compare A function pointer to a comparison function.
+         * @brief Sorts the nodes in the linked list using a custom comparison function.
+         * The sort is stable and takes linear time on a list that is already sorted.
+         * Large lists are sorted on several threads, see ParallelSort.
+         * @tparam C The type of the comparison, a function pointer, lambda or function object.
+         * @param compare A callable returning true if the first data goes before the second.
+         */
+        template <class C>
+        void sortNodes(C compare);
+
+        /**
+         * @brief Sorts the nodes in the linked list using a comparison function known at compile time.
+         * If SortKey<Compare> is specialized, each node's key is computed once and the keys are sorted instead.
+         * @tparam Compare The comparison function.
          */
-        void sortNodes(bool (*compare)(T &a, T &b));
+        template <auto Compare>
+        void sortNodes();
         
         /**
          * @brief Sorts the nodes in the linked list using the default comparison.
@@ -119,6 +176,48 @@ namespace List
          */
         Iterator<T> iterate();
 
+        /**
+         * @brief Returns a standard library iterator to the first node.
+         * @return An iterator to the first node.
+         */
+        iterator begin();
+
+        /**
+         * @brief Returns a standard library iterator past the last node.
+         * @return An iterator past the last node.
+         */
+        iterator end();
+
+        /**
+         * @brief Returns a const standard library iterator to the first node.
+         * @return A const iterator to the first node.
+         */
+        const_iterator begin() const;
+
+        /**
+         * @brief Returns a const standard library iterator past the last node.
+         * @return A const iterator past the last node.
+         */
+        const_iterator end() const;
+
+        /**
+         * @brief Returns a const standard library iterator to the first node.
+         * @return A const iterator to the first node.
+         */
+        const_iterator cbegin() const;
+
+        /**
+         * @brief Returns a const standard library iterator past the last node.
+         * @return A const iterator past the last node.
+         */
+        const_iterator cend() const;
+
+        /**
+         * @brief Gets the pool the linked list allocates its nodes from.
+         * @return Pointer to the pool, or nullptr if no node was allocated yet.
+         */
+        NodePool<T> *getPool();
+
     protected:
     	/**
          * @brief Pointer to the first node in the linked list.
@@ -131,41 +230,101 @@ namespace List
         int size;
 
         /**
-         * @brief Divides a linked list into two halves. 
-         * @param head Pointer to the head of the list to divide.
-         * @param newHead Reference to a pointer where the new head of the divided list will be stored.
+         * @brief The pool nodes are allocated from.
          */
-        void divideList(Node<T> *head, Node<T> *&newHead);
-        
+        NodePool<T> *pool;
+
         /**
-         * @brief Merges two sorted linked lists into one sorted linked list using a custom comparison function.
-         * @param head Pointer to the head of the first list to merge.
-         * @param secondHead Pointer to the head of the second list to merge.
-         * @param compare A function pointer to a comparison function.
-         * @return Pointer to the head of the merged sorted list.
+         * @brief Whether the pool belongs to this list alone.
          */
-        Node<T> *mergeList(Node<T> *head, Node<T> *secondHead, bool (*compare)(T &a, T &b));
-        
+        bool ownsPool;
+
+        /**
+         * @brief Allocates a node from the pool, forwarding the arguments to the node's constructor.
+         * @tparam Args The types of the arguments.
+         * @param args The data, or the arguments to construct the data from.
+         * @return Pointer to the new node.
+         */
+        template <class... Args>
+        Node<T> *createNode(Args &&...args);
+
+        /**
+         * @brief Destroys a node and returns its storage to the pool.
+         * @param node The node to destroy.
+         */
+        void destroyNode(Node<T> *node);
+
+        /**
+         * @brief Attaches a node at the end of the linked list.
+         * @param newData The node to attach.
+         */
+        void appendNode(Node<T> *newData);
+
+        /**
+         * @brief Takes over the nodes and the pool of another list, leaving it empty.
+         * A pool owned by the other list changes hands, a shared pool is kept by both.
+         * @param other The list to move from.
+         */
+        void moveNodes(LinkedList<T> &other);
+
         /**
-         * @brief Merges two sorted linked lists into one sorted linked list using the default comparison. 
+         * @brief Runs shorter than this are extended by insertion before merging.
+         */
+        static const int MIN_RUN = 16;
+
+        /**
+         * @brief Detaches the next run from the front of a list. A non-descending run is taken as is,
+         * a strictly descending run is reversed, and a run shorter than MIN_RUN is extended by insertion.
+         * @tparam C The type of the comparison.
+         * @param rest Reference to the head of the remaining list, advanced past the run.
+         * @param length Receives the number of nodes in the run.
+         * @param compare A callable returning true if the first data goes before the second.
+         * @return Pointer to the head of the sorted run.
+         */
+        template <class C>
+        Node<T> *takeRun(Node<T> *&rest, int &length, C &compare);
+
+        /**
+         * @brief Merges two sorted linked lists into one sorted linked list using a custom comparison function.
+         * On ties the node of the first list goes first, so merging is stable.
+         * @tparam C The type of the comparison.
          * @param head Pointer to the head of the first list to merge.
          * @param secondHead Pointer to the head of the second list to merge.
+         * @param compare A callable returning true if the first data goes before the second.
          * @return Pointer to the head of the merged sorted list.
          */
-        Node<T> *mergeList(Node<T> *head, Node<T> *secondHead);
-        
+        template <class C>
+        Node<T> *mergeList(Node<T> *head, Node<T> *secondHead, C &compare);
+
         /**
-         * @brief Recursively sorts a linked list using a custom comparison function.
+         * @brief Sorts a linked list with an iterative, stable natural merge sort.
+         * Sorted runs already present in the list are detected and merged with a run stack kept balanced
+         * as in TimSort, so presorted input is sorted in O(n) and no recursion is needed.
+         * @tparam C The type of the comparison.
          * @param head Reference to a pointer to the head of the list to sort.
-         * @param compare A function pointer to a comparison function.
+         * @param compare A callable returning true if the first data goes before the second.
          */
-        void recSortList(Node<T> *&head, bool (*compare)(T &a, T &b));
-        
+        template <class C>
+        void mergeSortList(Node<T> *&head, C &compare);
+
         /**
-         * @brief Recursively sorts a linked list using the default comparison.
+         * @brief Sorts a linked list on several threads. The list is cut into one segment per thread,
+         * the segments are merge sorted concurrently and then merged pairwise, also concurrently.
+         * @tparam C The type of the comparison.
          * @param head Reference to a pointer to the head of the list to sort.
+         * @param compare A callable returning true if the first data goes before the second.
+         * @param threads The number of threads to use.
+         */
+        template <class C>
+        void parallelSortList(Node<T> *&head, C &compare, int threads);
+
+        /**
+         * @brief Sorts the nodes by a key computed once per node, then relinks them in key order.
+         * @tparam E The type of the key extractor.
+         * @param key A callable returning the key of a node's data.
          */
-        void recSortList(Node<T> *&head);
+        template <class E>
+        void sortByKey(E key);
     };
 }
 
@@ -1,5 +1,9 @@
 #include <iostream>
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 #include "structs/linkedList.h"
 
 using namespace List;
@@ -9,18 +13,36 @@ LinkedList<T>::LinkedList()
 {
     this->first = nullptr;
     this->size = 0;
+    this->pool = nullptr; // Created on the first node.
+    this->ownsPool = false;
+}
+
+template <class T>
+LinkedList<T>::LinkedList(NodePool<T> *pool)
+{
+    this->first = nullptr;
+    this->size = 0;
+    this->pool = pool;
+    this->ownsPool = false;
 }
 
 template <class T>
 LinkedList<T>::~LinkedList()
 {
     this->reset();
+
+    if (this->ownsPool)
+    {
+        delete this->pool; // Frees every slab at once.
+    }
 }
 
 template <class T>
 LinkedList<T>::LinkedList(const LinkedList<T> &other)
     : first(nullptr),
-      size(0)
+      size(0),
+      pool(other.ownsPool ? nullptr : other.pool),
+      ownsPool(false)
 {
     if (other.first == nullptr)
     {
@@ -33,7 +55,7 @@ LinkedList<T>::LinkedList(const LinkedList<T> &other)
 
     while (currentOther != nullptr)
     {
-        Node<T> *newNode = new Node<T>(currentOther->data);
+        Node<T> *newNode = this->createNode(currentOther->data);
 
         if (this->first == nullptr) // If current list has no element yet.
         {
@@ -69,7 +91,7 @@ LinkedList<T> &LinkedList<T>::operator=(const LinkedList<T> &other)
 
         while (currentOther != nullptr)
         {
-            Node<T> *newNode = new Node<T>(currentOther->data);
+            Node<T> *newNode = this->createNode(currentOther->data);
 
             if (first == nullptr)
             {
@@ -90,14 +112,58 @@ LinkedList<T> &LinkedList<T>::operator=(const LinkedList<T> &other)
     return *this;
 }
 
+template <class T>
+LinkedList<T>::LinkedList(LinkedList<T> &&other)
+    : first(nullptr),
+      size(0),
+      pool(nullptr),
+      ownsPool(false)
+{
+    this->moveNodes(other);
+}
+
+template <class T>
+LinkedList<T> &LinkedList<T>::operator=(LinkedList<T> &&other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    // The nodes of the other list stay in its pool, so this list gives up its own.
+    this->reset();
+    if (this->ownsPool)
+    {
+        delete this->pool;
+    }
+    this->moveNodes(other);
+
+    return *this;
+}
+
 template <class T>
 void LinkedList<T>::reset()
 {
-    while (this->first != nullptr)
+    // A pool only used by this list can drop every node at once,
+    // a shared pool needs each node back on its free list.
+    if (this->ownsPool)
     {
-        Node<T> *temp = this->first;
-        this->first = this->first->next;
-        delete temp;
+        while (this->first != nullptr)
+        {
+            Node<T> *temp = this->first;
+            this->first = this->first->next;
+            temp->~Node<T>();
+        }
+        this->pool->clear();
+    }
+    else
+    {
+        while (this->first != nullptr)
+        {
+            Node<T> *temp = this->first;
+            this->first = this->first->next;
+            this->destroyNode(temp);
+        }
     }
 
     this->size = 0;
@@ -106,8 +172,25 @@ void LinkedList<T>::reset()
 template <class T>
 void LinkedList<T>::addNode(T &data)
 {
-    Node<T> *newData = new Node<T>(data);
+    this->appendNode(this->createNode(data));
+}
+
+template <class T>
+void LinkedList<T>::addNode(T &&data)
+{
+    this->appendNode(this->createNode(std::move(data)));
+}
+
+template <class T>
+template <class... Args>
+void LinkedList<T>::emplaceNode(Args &&...args)
+{
+    this->appendNode(this->createNode(std::forward<Args>(args)...));
+}
 
+template <class T>
+void LinkedList<T>::appendNode(Node<T> *newData)
+{
     // If the list is empty, just point LinkedList<T>::first to the node.
     if (this->isEmpty())
     {
@@ -130,8 +213,8 @@ void LinkedList<T>::addNode(T &data)
 }
 
 template <class T>
-template <class K>
-void LinkedList<T>::searchNodes(LinkedList<T> &list, bool (*compare)(T &a, K b), K compareValue)
+template <class L, class C, class K>
+void LinkedList<T>::searchNodes(L &list, C compare, K compareValue)
 {
     Node<T> *current = this->first;
     while (current != nullptr)
@@ -145,7 +228,8 @@ void LinkedList<T>::searchNodes(LinkedList<T> &list, bool (*compare)(T &a, K b),
 };
 
 template <class T>
-void LinkedList<T>::searchNodes(LinkedList<T> &list, T compareValue)
+template <class L>
+void LinkedList<T>::searchNodes(L &list, T compareValue)
 {
     Node<T> *current = this->first;
     while (current != nullptr)
@@ -159,15 +243,40 @@ void LinkedList<T>::searchNodes(LinkedList<T> &list, T compareValue)
 };
 
 template <class T>
-void LinkedList<T>::sortNodes(bool (*compare)(T &a, T &b))
+template <class C>
+void LinkedList<T>::sortNodes(C compare)
 {
-    this->recSortList(this->first, compare); // call merge sort function
+    int threads = ParallelSort::threadsFor(this->size);
+    if (threads > 1)
+    {
+        this->parallelSortList(this->first, compare, threads);
+    }
+    else
+    {
+        this->mergeSortList(this->first, compare); // call merge sort function
+    }
+};
+
+template <class T>
+template <auto Compare>
+void LinkedList<T>::sortNodes()
+{
+    if constexpr (SortKey<Compare>::enabled)
+    {
+        this->sortByKey(SortKey<Compare>::key);
+    }
+    else
+    {
+        this->sortNodes([](T &a, T &b)
+                        { return Compare(a, b); });
+    }
 };
 
 template <class T>
 void LinkedList<T>::sortNodes()
 {
-    this->recSortList(this->first); // call merge sort function
+    this->sortNodes([](T &a, T &b)
+                    { return a < b; }); // call merge sort function
 };
 
 template <class T>
@@ -182,7 +291,7 @@ void LinkedList<T>::deleteNode(int index)
     {
         Node<T> *temp = this->first;
         this->first = this->first->next;
-        delete temp;
+        this->destroyNode(temp);
         this->size--;
         return;
     }
@@ -195,7 +304,7 @@ void LinkedList<T>::deleteNode(int index)
         if (currentIndex == index)
         {
             trail->next = head->next;
-            delete head;
+            this->destroyNode(head);
             this->size--;
             return;
         }
@@ -220,7 +329,7 @@ void LinkedList<T>::deleteNode(T &data)
     {
         Node<T> *temp = this->first;
         this->first = this->first->next;
-        delete temp;
+        this->destroyNode(temp);
         this->size--;
         return;
     }
@@ -232,7 +341,7 @@ void LinkedList<T>::deleteNode(T &data)
         if (head->data == data)
         {
             trail->next = head->next;
-            delete head;
+            this->destroyNode(head);
             this->size--;
             return;
         }
@@ -301,47 +410,70 @@ int LinkedList<T>::getSize()
 }
 
 template <class T>
-void LinkedList<T>::divideList(Node<T> *head, Node<T> *&newHead)
+template <class C>
+Node<T> *LinkedList<T>::takeRun(Node<T> *&rest, int &length, C &compare)
 {
-    Node<T> *current;
-    Node<T> *middle;
+    Node<T> *runHead = rest;
+    Node<T> *runTail = rest;
+    Node<T> *current = rest->next;
+    length = 1;
 
-    if (head == nullptr) // List have no node (cannot divide)
+    if (current != nullptr && compare(current->data, runHead->data))
     {
-        newHead = nullptr;
+        // Strictly descending run, reverse it while walking.
+        // Equal nodes end the run, so reversing keeps the sort stable.
+        while (current != nullptr && compare(current->data, runHead->data))
+        {
+            Node<T> *next = current->next;
+            current->next = runHead;
+            runHead = current;
+            current = next;
+            length++;
+        }
     }
-    else if (head->next == nullptr) // List only have one node (cannot divide)
+    else
     {
-        newHead = nullptr;
+        // Non-descending run.
+        while (current != nullptr && !compare(current->data, runTail->data))
+        {
+            runTail = current;
+            current = current->next;
+            length++;
+        }
     }
-    else // List has more than two nodes
+    runTail->next = nullptr;
+
+    // Extend a short run by inserting the following nodes after every node that does not go after them.
+    while (length < MIN_RUN && current != nullptr)
     {
-        // Traverse the list with two pointer,
-        // One traverse twice the length than the other to get the middle node in the list.
-        current = head->next;
-        middle = head;
+        Node<T> *node = current;
+        current = current->next;
 
-        if (current != nullptr)
+        if (compare(node->data, runHead->data))
         {
-            current = current->next;
+            node->next = runHead;
+            runHead = node;
         }
-        while (current != nullptr)
+        else
         {
-            middle = middle->next;
-            current = current->next;
-            if (current != nullptr)
+            Node<T> *position = runHead;
+            while (position->next != nullptr && !compare(node->data, position->next->data))
             {
-                current = current->next;
+                position = position->next;
             }
+            node->next = position->next;
+            position->next = node;
         }
-
-        newHead = middle->next;
-        middle->next = nullptr;
+        length++;
     }
-};
+
+    rest = current;
+    return runHead;
+}
 
 template <class T>
-Node<T> *LinkedList<T>::mergeList(Node<T> *head, Node<T> *secondHead, bool (*compare)(T &a, T &b))
+template <class C>
+Node<T> *LinkedList<T>::mergeList(Node<T> *head, Node<T> *secondHead, C &compare)
 {
     Node<T> *lastMerged;
     Node<T> *newHead;
@@ -357,8 +489,8 @@ Node<T> *LinkedList<T>::mergeList(Node<T> *head, Node<T> *secondHead, bool (*com
     else
     {
         // Compare the first node of each list
-        // to choose the smallest node
-        if (compare(head->data, secondHead->data))
+        // to choose the smallest node, the one of the first list on ties
+        if (!compare(secondHead->data, head->data))
         {
             newHead = head;
             head = head->next;
@@ -374,7 +506,7 @@ Node<T> *LinkedList<T>::mergeList(Node<T> *head, Node<T> *secondHead, bool (*com
         while (head != nullptr && secondHead != nullptr)
         {
             // Compare and choose smaller node
-            if (compare(head->data, secondHead->data))
+            if (!compare(secondHead->data, head->data))
             {
                 lastMerged->next = head;
                 lastMerged = head;
@@ -403,99 +535,230 @@ Node<T> *LinkedList<T>::mergeList(Node<T> *head, Node<T> *secondHead, bool (*com
 }
 
 template <class T>
-Node<T> *LinkedList<T>::mergeList(Node<T> *head, Node<T> *secondHead)
+template <class C>
+void LinkedList<T>::mergeSortList(Node<T> *&head, C &compare)
 {
-    Node<T> *lastMerged;
-    Node<T> *newHead;
-
-    if (head == nullptr)
-    {
-        return secondHead;
-    }
-    else if (secondHead == nullptr)
+    // Pending runs, oldest first. The balancing rules below keep run lengths growing at least
+    // like the Fibonacci numbers down the stack, so 64 entries are more than any list can need.
+    struct Run
     {
-        return head;
-    }
-    else
+        Node<T> *head;
+        int length;
+    } runs[64];
+    int count = 0;
+
+    auto mergeAt = [&](int index)
     {
-        if (head->data < secondHead->data)
+        runs[index].head = this->mergeList(runs[index].head, runs[index + 1].head, compare);
+        runs[index].length += runs[index + 1].length;
+        if (index + 2 < count)
         {
-            newHead = head;
-            head = head->next;
-            lastMerged = newHead;
-        }
-        else
-        {
-            newHead = secondHead;
-            secondHead = secondHead->next;
-            lastMerged = newHead;
+            runs[index + 1] = runs[index + 2];
         }
+        count--;
+    };
 
-        while (head != nullptr && secondHead != nullptr)
+    Node<T> *rest = head;
+    while (rest != nullptr)
+    {
+        runs[count].head = this->takeRun(rest, runs[count].length, compare);
+        count++;
+
+        // Merge until every run is longer than the two above it combined.
+        while (count > 1)
         {
-            if (head->data < secondHead->data)
+            int index = count - 2;
+            if ((index > 0 && runs[index - 1].length <= runs[index].length + runs[index + 1].length) ||
+                (index > 1 && runs[index - 2].length <= runs[index - 1].length + runs[index].length))
             {
-                lastMerged->next = head;
-                lastMerged = head;
-                head = head->next;
+                if (runs[index - 1].length < runs[index + 1].length)
+                {
+                    index--;
+                }
             }
-            else
+            else if (runs[index].length > runs[index + 1].length)
             {
-                lastMerged->next = secondHead;
-                lastMerged = secondHead;
-                secondHead = secondHead->next;
+                break;
             }
+            mergeAt(index);
         }
-    
-        if (head == nullptr)
-        {
-            lastMerged->next = secondHead;
-        }
-        else
-        {
-            lastMerged->next = head;
-        }
+    }
 
-        return newHead;
+    // Merge whatever is left, newest runs first.
+    while (count > 1)
+    {
+        mergeAt(count - 2);
     }
+
+    head = count == 0 ? nullptr : runs[0].head;
 }
 
 template <class T>
-void LinkedList<T>::recSortList(Node<T> *&head, bool (*compare)(T &a, T &b))
+template <class C>
+void LinkedList<T>::parallelSortList(Node<T> *&head, C &compare, int threads)
 {
-    Node<T> *otherHead;
-    if (head != nullptr)
+    // Cut the list into segments of nearly equal length.
+    std::vector<Node<T> *> segments(threads, nullptr);
+    Node<T> *current = head;
+    for (int i = 0; i < threads; i++)
     {
-        if (head->next != nullptr)
+        segments[i] = current;
+
+        int length = this->size / threads + (i < this->size % threads ? 1 : 0);
+        for (int j = 1; j < length; j++)
+        {
+            current = current->next;
+        }
+
+        Node<T> *next = current->next;
+        current->next = nullptr;
+        current = next;
+    }
+
+    // Sort the segments concurrently, the last one on this thread.
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads - 1; i++)
+    {
+        workers.emplace_back([this, &segments, &compare, i]()
+                             { this->mergeSortList(segments[i], compare); });
+    }
+    this->mergeSortList(segments[threads - 1], compare);
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    // Merge neighbouring segments pairwise, each round halving the segments.
+    // Merging a segment only with the one after it keeps the sort stable.
+    for (int step = 1; step < threads; step *= 2)
+    {
+        workers.clear();
+        for (int i = 0; i + step < threads; i += 2 * step)
+        {
+            workers.emplace_back([this, &segments, &compare, i, step]()
+                                 { segments[i] = this->mergeList(segments[i], segments[i + step], compare); });
+        }
+        for (std::thread &worker : workers)
         {
-            this->divideList(head, otherHead); // Divide list and get two pointers pointing to each of the list
-            // Sort recursively of those lists.
-            this->recSortList(head, compare);
-            this->recSortList(otherHead, compare);
-            head = this->mergeList(head, otherHead, compare); // Merge the sorted list together.
+            worker.join();
         }
     }
+
+    head = segments[0];
 }
 
 template <class T>
-void LinkedList<T>::recSortList(Node<T> *&head)
+template <class E>
+void LinkedList<T>::sortByKey(E key)
 {
-    Node<T> *otherHead;
+    using Key = decltype(key(this->first->data));
 
-    if (head != nullptr)
+    if (this->first == nullptr)
     {
-        if (head->next != nullptr)
-        {
-            this->divideList(head, otherHead);
-            this->recSortList(head);
-            this->recSortList(otherHead);
-            head = this->mergeList(head, otherHead);
-        }
+        return;
+    }
+
+    // Compute every key once, sort the keys along with their nodes, then relink the nodes in that order.
+    std::vector<std::pair<Key, Node<T> *>> entries;
+    entries.reserve(this->size);
+    for (Node<T> *current = this->first; current != nullptr; current = current->next)
+    {
+        entries.push_back(std::make_pair(key(current->data), current));
+    }
+
+    // Stable, like the merge sort.
+    ParallelSort::stableSort(entries.begin(), entries.end(), [](const std::pair<Key, Node<T> *> &a, const std::pair<Key, Node<T> *> &b)
+                             { return a.first < b.first; });
+
+    for (int i = 0; i + 1 < (int)entries.size(); i++)
+    {
+        entries[i].second->next = entries[i + 1].second;
     }
+    entries.back().second->next = nullptr;
+    this->first = entries.front().second;
 }
 
 template <class T>
 Iterator<T> LinkedList<T>::iterate()
 {
     return Iterator<T>(this->first);
-}
\ No newline at end of file
+}
+
+template <class T>
+typename LinkedList<T>::iterator LinkedList<T>::begin()
+{
+    return iterator(this->first);
+}
+
+template <class T>
+typename LinkedList<T>::iterator LinkedList<T>::end()
+{
+    return iterator();
+}
+
+template <class T>
+typename LinkedList<T>::const_iterator LinkedList<T>::begin() const
+{
+    return const_iterator(this->first);
+}
+
+template <class T>
+typename LinkedList<T>::const_iterator LinkedList<T>::end() const
+{
+    return const_iterator();
+}
+
+template <class T>
+typename LinkedList<T>::const_iterator LinkedList<T>::cbegin() const
+{
+    return const_iterator(this->first);
+}
+
+template <class T>
+typename LinkedList<T>::const_iterator LinkedList<T>::cend() const
+{
+    return const_iterator();
+}
+
+template <class T>
+NodePool<T> *LinkedList<T>::getPool()
+{
+    return this->pool;
+}
+
+template <class T>
+template <class... Args>
+Node<T> *LinkedList<T>::createNode(Args &&...args)
+{
+    if (this->pool == nullptr)
+    {
+        this->pool = new NodePool<T>();
+        this->ownsPool = true;
+    }
+
+    return this->pool->acquire(std::forward<Args>(args)...);
+}
+
+template <class T>
+void LinkedList<T>::destroyNode(Node<T> *node)
+{
+    this->pool->release(node);
+}
+
+template <class T>
+void LinkedList<T>::moveNodes(LinkedList<T> &other)
+{
+    this->first = other.first;
+    this->size = other.size;
+    this->pool = other.pool;
+    this->ownsPool = other.ownsPool;
+
+    other.first = nullptr;
+    other.size = 0;
+    if (other.ownsPool)
+    {
+        // The other list creates a new pool if it is used again.
+        other.pool = nullptr;
+        other.ownsPool = false;
+    }
+}
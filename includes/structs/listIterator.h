@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include "structs/node.h"
+
+namespace List
+{
+    /**
+     * @brief Standard library compatible forward iterator over linked nodes.
+     * Lets the list containers be used with range-based for loops and the <algorithm> and <numeric> functions,
+     * including their execution policy overloads.
+     * @tparam T The type of data stored in the nodes.
+     * @tparam V T for a mutable iterator, const T for a const iterator.
+     */
+    template <class T, class V = T>
+    class ListIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;    /**< Nodes are only linked forward */
+        using value_type = typename std::remove_const<V>::type; /**< The type of data stored in the nodes */
+        using difference_type = std::ptrdiff_t;                 /**< The type of the distance between two iterators */
+        using pointer = V *;                                    /**< Pointer to the data */
+        using reference = V &;                                  /**< Reference to the data */
+
+        /**
+         * @brief Constructs an iterator past the end of every list.
+         */
+        ListIterator();
+
+        /**
+         * @brief Constructs an iterator positioned on the given node.
+         * @param node Pointer to the node, or nullptr for the end of the list.
+         */
+        ListIterator(Node<T> *node);
+
+        /**
+         * @brief Constructs an iterator from a mutable one, so a mutable iterator converts to a const iterator.
+         * @param other The mutable iterator to copy the position from.
+         */
+        ListIterator(const ListIterator<T, T> &other);
+
+        /**
+         * @return Reference to the data of the current node.
+         */
+        reference operator*() const;
+
+        /**
+         * @return Pointer to the data of the current node.
+         */
+        pointer operator->() const;
+
+        /**
+         * @brief Advances the iterator to the next node.
+         * @return Reference to this iterator after advancing.
+         */
+        ListIterator<T, V> &operator++();
+
+        /**
+         * @brief Advances the iterator to the next node.
+         * @return A copy of the iterator before advancing.
+         */
+        ListIterator<T, V> operator++(int);
+
+        /**
+         * @param other The iterator to compare with.
+         * @return true if both iterators are on the same node, false otherwise.
+         */
+        bool operator==(const ListIterator<T, V> &other) const;
+
+        /**
+         * @param other The iterator to compare with.
+         * @return true if the iterators are on different nodes, false otherwise.
+         */
+        bool operator!=(const ListIterator<T, V> &other) const;
+
+        /**
+         * @return The node the iterator is positioned on.
+         */
+        Node<T> *getNode() const;
+
+    private:
+        Node<T> *current; /**< The node the iterator is positioned on, nullptr at the end */
+    };
+}
+
+#include "structs/listIterator.hpp"
\ No newline at end of file
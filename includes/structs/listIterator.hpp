@@ -0,0 +1,57 @@
+#include "structs/listIterator.h"
+
+using namespace List;
+
+template <class T, class V>
+ListIterator<T, V>::ListIterator() : current(nullptr){};
+
+template <class T, class V>
+ListIterator<T, V>::ListIterator(Node<T> *node) : current(node){};
+
+template <class T, class V>
+ListIterator<T, V>::ListIterator(const ListIterator<T, T> &other) : current(other.getNode()){};
+
+template <class T, class V>
+typename ListIterator<T, V>::reference ListIterator<T, V>::operator*() const
+{
+    return this->current->data;
+}
+
+template <class T, class V>
+typename ListIterator<T, V>::pointer ListIterator<T, V>::operator->() const
+{
+    return &this->current->data;
+}
+
+template <class T, class V>
+ListIterator<T, V> &ListIterator<T, V>::operator++()
+{
+    this->current = this->current->next;
+    return *this;
+}
+
+template <class T, class V>
+ListIterator<T, V> ListIterator<T, V>::operator++(int)
+{
+    ListIterator<T, V> previous = *this;
+    this->current = this->current->next;
+    return previous;
+}
+
+template <class T, class V>
+bool ListIterator<T, V>::operator==(const ListIterator<T, V> &other) const
+{
+    return this->current == other.current;
+}
+
+template <class T, class V>
+bool ListIterator<T, V>::operator!=(const ListIterator<T, V> &other) const
+{
+    return this->current != other.current;
+}
+
+template <class T, class V>
+Node<T> *ListIterator<T, V>::getNode() const
+{
+    return this->current;
+}
\ No newline at end of file
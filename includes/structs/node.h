@@ -25,6 +25,20 @@ namespace List
          * @param data The data to be stored in the node.
          */
         Node(T &data);
+
+        /**
+         * @brief Constructs a node taking over the given data.
+         * @param data The data to be moved into the node.
+         */
+        Node(T &&data);
+
+        /**
+         * @brief Constructs the node's data in place from the given constructor arguments.
+         * @tparam Args The types of the arguments.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <class... Args>
+        explicit Node(Args &&...args);
     };
 }
 
@@ -1,9 +1,13 @@
+#include <utility>
 #include "structs/node.h"
 #include "structs/iterator.h"
 
 template <class T>
-Node<T>::Node(T &data)
-{
-    this->data = data;
-    this->next = nullptr;
-}
+Node<T>::Node(T &data) : data(data), next(nullptr){};
+
+template <class T>
+Node<T>::Node(T &&data) : data(std::move(data)), next(nullptr){};
+
+template <class T>
+template <class... Args>
+Node<T>::Node(Args &&...args) : data(std::forward<Args>(args)...), next(nullptr){};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <mutex>
+#include "structs/node.h"
+
+namespace List
+{
+    /**
+     * @brief Slab allocator for linked list nodes.
+     * Nodes are carved out of slabs that grow geometrically, deleted nodes are kept on a
+     * free list for reuse, and every slab is returned to the heap at once when the pool is cleared
+     * or destroyed. A pool can be owned by one list or shared between several lists.
+     * Acquiring and releasing are serialized by a mutex, so lists whose nodes come from one pool may be used
+     * from different threads, e.g. patients built on an intake thread and stored by the menu thread. Nodes are
+     * constructed and destroyed outside the lock.
+     * @tparam T The type of data stored in the nodes.
+     */
+    template <class T>
+    class NodePool
+    {
+    public:
+        /**
+         * @brief Constructs an empty pool. No memory is allocated until the first node is acquired.
+         */
+        NodePool();
+
+        /**
+         * @brief Destructor. Frees every slab; nodes still in use must already be destroyed.
+         */
+        ~NodePool();
+
+        /**
+         * @brief Pools own raw memory and cannot be copied.
+         */
+        NodePool(const NodePool<T> &other) = delete;
+
+        /**
+         * @brief Pools own raw memory and cannot be copied.
+         */
+        NodePool<T> &operator=(const NodePool<T> &other) = delete;
+
+        /**
+         * @brief Allocates and constructs a node, forwarding the arguments to the node's constructor.
+         * The node holds a copy of an lvalue, takes over an rvalue, or builds its data in place from other arguments.
+         * @tparam Args The types of the arguments.
+         * @param args The data, or the arguments to construct the data from.
+         * @return Pointer to the new node.
+         */
+        template <class... Args>
+        Node<T> *acquire(Args &&...args);
+
+        /**
+         * @brief Destroys a node and puts its storage on the free list.
+         * @param node The node to release, which must come from this pool.
+         */
+        void release(Node<T> *node);
+
+        /**
+         * @brief Forgets every node at once and rewinds to the first slab, keeping the slabs for reuse.
+         * The caller is responsible for having destroyed the nodes' data beforehand, and for no other thread
+         * using the pool meanwhile.
+         */
+        void clear();
+
+        /**
+         * @brief Frees every slab at once. The caller is responsible for having destroyed the nodes' data beforehand,
+         * and for no other thread using the pool meanwhile.
+         */
+        void releaseAll();
+
+        /**
+         * @return The number of nodes handed out by the pool.
+         */
+        int getAllocations();
+
+        /**
+         * @return The number of nodes served from the free list.
+         */
+        int getReuses();
+
+        /**
+         * @return The number of slabs requested from the heap.
+         */
+        int getSlabAllocations();
+
+        /**
+         * @return The number of heap allocations saved compared to allocating every node with `new`.
+         */
+        int getAllocationsAvoided();
+
+    private:
+        /**
+         * @brief Storage unit of a slab. Holds either a node, a free list link, or (in a slab's first slot) the slab header.
+         */
+        union Slot
+        {
+            Slot *nextFree; /**< Next free slot when the slot is on the free list */
+            struct
+            {
+                Slot *nextSlab; /**< Next slab in the chain */
+                int capacity;   /**< Number of node slots in the slab */
+            } header;
+            alignas(Node<T>) unsigned char node[sizeof(Node<T>)]; /**< Raw storage for a node */
+        };
+
+        static const int FIRST_SLAB_CAPACITY = 8;   /**< Node slots in the first slab */
+        static const int MAX_SLAB_CAPACITY = 4096;  /**< Upper bound for the slab growth */
+
+        std::mutex mutex;  /**< Serializes acquiring and releasing */
+        Slot *firstSlab;   /**< First slab in the chain */
+        Slot *currentSlab; /**< Slab nodes are currently carved from */
+        int currentUsed;   /**< Slots already carved from the current slab */
+        Slot *freeList;    /**< Slots of released nodes */
+
+        int allocations;     /**< Nodes handed out */
+        int reuses;          /**< Nodes served from the free list */
+        int slabAllocations; /**< Slabs requested from the heap */
+
+        /**
+         * @brief Returns storage for one node, taking it from the free list or the slabs. Called with the mutex held.
+         * @return Pointer to uninitialized node storage.
+         */
+        void *allocateSlot();
+    };
+}
+
+#include "structs/nodePool.hpp"
\ No newline at end of file
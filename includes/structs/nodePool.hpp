@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <new>
+#include <utility>
+#include "structs/nodePool.h"
+
+using namespace List;
+
+template <class T>
+NodePool<T>::NodePool()
+    : mutex(),
+      firstSlab(nullptr),
+      currentSlab(nullptr),
+      currentUsed(0),
+      freeList(nullptr),
+      allocations(0),
+      reuses(0),
+      slabAllocations(0){};
+
+template <class T>
+NodePool<T>::~NodePool()
+{
+    this->releaseAll();
+}
+
+template <class T>
+template <class... Args>
+Node<T> *NodePool<T>::acquire(Args &&...args)
+{
+    void *slot;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        slot = this->allocateSlot();
+        this->allocations++;
+    }
+    return new (slot) Node<T>(std::forward<Args>(args)...);
+}
+
+template <class T>
+void NodePool<T>::release(Node<T> *node)
+{
+    node->~Node<T>();
+
+    // Put the slot in front of the free list, so the next node reuses it.
+    Slot *slot = reinterpret_cast<Slot *>(node);
+    std::lock_guard<std::mutex> lock(this->mutex);
+    slot->nextFree = this->freeList;
+    this->freeList = slot;
+}
+
+template <class T>
+void NodePool<T>::clear()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->currentSlab = this->firstSlab;
+    this->currentUsed = 0;
+    this->freeList = nullptr;
+}
+
+template <class T>
+void NodePool<T>::releaseAll()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    while (this->firstSlab != nullptr)
+    {
+        Slot *temp = this->firstSlab;
+        this->firstSlab = this->firstSlab->header.nextSlab;
+        delete[] temp;
+    }
+
+    this->currentSlab = nullptr;
+    this->currentUsed = 0;
+    this->freeList = nullptr;
+}
+
+template <class T>
+int NodePool<T>::getAllocations()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->allocations;
+}
+
+template <class T>
+int NodePool<T>::getReuses()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->reuses;
+}
+
+template <class T>
+int NodePool<T>::getSlabAllocations()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->slabAllocations;
+}
+
+template <class T>
+int NodePool<T>::getAllocationsAvoided()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->allocations - this->slabAllocations;
+}
+
+template <class T>
+void *NodePool<T>::allocateSlot()
+{
+    // Reuse the storage of a deleted node first.
+    if (this->freeList != nullptr)
+    {
+        Slot *slot = this->freeList;
+        this->freeList = slot->nextFree;
+        this->reuses++;
+        return slot;
+    }
+
+    // Move on to the next slab when the current one is used up,
+    // allocating a slab twice as large if there is none left from a previous clear().
+    if (this->currentSlab == nullptr || this->currentUsed == this->currentSlab->header.capacity)
+    {
+        Slot *next = this->currentSlab == nullptr ? nullptr : this->currentSlab->header.nextSlab;
+        if (next == nullptr)
+        {
+            int capacity = FIRST_SLAB_CAPACITY;
+            if (this->currentSlab != nullptr)
+            {
+                capacity = std::min(this->currentSlab->header.capacity * 2, (int)MAX_SLAB_CAPACITY);
+            }
+
+            // The first slot of every slab holds its header.
+            next = new Slot[capacity + 1];
+            next->header.nextSlab = nullptr;
+            next->header.capacity = capacity;
+            this->slabAllocations++;
+
+            if (this->currentSlab == nullptr)
+            {
+                this->firstSlab = next;
+            }
+            else
+            {
+                this->currentSlab->header.nextSlab = next;
+            }
+        }
+
+        this->currentSlab = next;
+        this->currentUsed = 0;
+    }
+
+    return &this->currentSlab[1 + this->currentUsed++];
+}
\ No newline at end of file
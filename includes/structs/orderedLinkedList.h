@@ -13,12 +13,37 @@ namespace List
     class OrderedLinkedList : public LinkedList<T>
     {
     public:
+        /**
+         * @brief Constructs an empty ordered linked list.
+         */
+        OrderedLinkedList();
+
+        /**
+         * @brief Constructs an empty ordered linked list that allocates its nodes from a shared pool.
+         * @param pool The pool to allocate nodes from. It must outlive the list.
+         */
+        OrderedLinkedList(NodePool<T> *pool);
+
         /**
          * @brief Adds a node with the given data to the ordered linked list in sorted order.
          * @param data The data to be added to the ordered linked list.
          */
         void addNode(T &data);
 
+        /**
+         * @brief Adds a node to the ordered linked list in sorted order, moving the given data into it.
+         * @param data The data to be moved into the ordered linked list.
+         */
+        void addNode(T &&data);
+
+        /**
+         * @brief Constructs data in a new node from the given arguments and adds it in sorted order.
+         * @tparam Args The types of the arguments.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <class... Args>
+        void emplaceNode(Args &&...args);
+
         /**
          * @brief Deletes the node containing the given data from the ordered linked list.
          * @param data The data to be deleted from the ordered linked list.
@@ -59,6 +84,12 @@ namespace List
          * @return The middle node.
          */
         Node<T> *getMiddle(Node<T> *first, Node<T> *last);
+
+        /**
+         * @brief Links a new node into its sorted position.
+         * @param newData The node to link.
+         */
+        void insertNode(Node<T> *newData);
     };
 }
 
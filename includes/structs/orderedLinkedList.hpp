@@ -1,14 +1,40 @@
 #include <stdexcept>
 #include <iostream>
+#include <utility>
 #include "structs/linkedList.h"
 #include "structs/orderedLinkedList.h"
 
 using namespace List;
 
+template <class T>
+OrderedLinkedList<T>::OrderedLinkedList() : LinkedList<T>(){};
+
+template <class T>
+OrderedLinkedList<T>::OrderedLinkedList(NodePool<T> *pool) : LinkedList<T>(pool){};
+
 template <class T>
 void OrderedLinkedList<T>::addNode(T &data)
 {
-    Node<T> *newData = new Node<T>(data);
+    this->insertNode(this->createNode(data));
+}
+
+template <class T>
+void OrderedLinkedList<T>::addNode(T &&data)
+{
+    this->insertNode(this->createNode(std::move(data)));
+}
+
+template <class T>
+template <class... Args>
+void OrderedLinkedList<T>::emplaceNode(Args &&...args)
+{
+    this->insertNode(this->createNode(std::forward<Args>(args)...));
+}
+
+template <class T>
+void OrderedLinkedList<T>::insertNode(Node<T> *newData)
+{
+    T &data = newData->data;
 
     if (this->isEmpty())
     {
@@ -51,7 +77,7 @@ void OrderedLinkedList<T>::deleteNode(T &data)
     {
         Node<T> *temp = this->first;
         this->first = this->first->next;
-        delete temp;
+        this->destroyNode(temp);
         this->size--;
         return;
     }
@@ -68,7 +94,7 @@ void OrderedLinkedList<T>::deleteNode(T &data)
         if (head->data == data)
         {
             trail->next = head->next;
-            delete head;
+            this->destroyNode(head);
             this->size--;
             return;
         }
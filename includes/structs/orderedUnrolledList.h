@@ -0,0 +1,85 @@
+#pragma once
+
+#include "structs/unrolledList.h"
+
+namespace List
+{
+    /**
+     * @brief Template class representing an ordered unrolled linked list.
+     * Inherits functionality from UnrolledList<T, B>. Lookups skip whole chunks by their last element,
+     * then binary search inside the chunk.
+     * @tparam T The type of data stored in the ordered unrolled list.
+     * @tparam B The number of elements per chunk.
+     */
+    template <class T, int B = unrolledCapacity<T>()>
+    class OrderedUnrolledList : public UnrolledList<T, B>
+    {
+    public:
+        /**
+         * @brief Constructs an empty ordered unrolled list.
+         */
+        OrderedUnrolledList();
+
+        /**
+         * @brief Adds an element with the given data to the ordered unrolled list in sorted order.
+         * @param data The data to be added to the ordered unrolled list.
+         */
+        void addNode(T &data);
+
+        /**
+         * @brief Adds an element to the ordered unrolled list in sorted order, moving the given data into it.
+         * @param data The data to be moved into the ordered unrolled list.
+         */
+        void addNode(T &&data);
+
+        /**
+         * @brief Constructs data from the given arguments and adds it in sorted order.
+         * @tparam Args The types of the arguments.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <class... Args>
+        void emplaceNode(Args &&...args);
+
+        /**
+         * @brief Deletes the element at the specified index.
+         * Uses the base class method UnrolledList<T, B>::deleteNode.
+         */
+        using UnrolledList<T, B>::deleteNode;
+
+        /**
+         * @brief Deletes the element containing the given data from the ordered unrolled list.
+         * @param data The data to be deleted from the ordered unrolled list.
+         */
+        void deleteNode(T &data);
+
+        /**
+         * @brief Retrieves the data stored at the specified index.
+         * Uses the base class method UnrolledList<T, B>::getData.
+         */
+        using UnrolledList<T, B>::getData;
+
+        /**
+         * @brief Retrieves the data stored in the element that matches the given data.
+         * @param data The data to match against elements in the ordered unrolled list.
+         * @return Pointer to the matching data.
+         */
+        T *getData(T &data);
+
+    protected:
+        /**
+         * @brief Finds the first element that does not go before the given data.
+         * @param data The data to look for.
+         * @param position Receives the position of the element in its chunk.
+         * @return The chunk holding the element, or nullptr if every element goes before the data.
+         */
+        UnrolledChunk<T, B> *lowerBound(T &data, int &position);
+
+        /**
+         * @brief Moves data into its sorted position.
+         * @param data The data to be moved into the list.
+         */
+        void insertSorted(T &&data);
+    };
+}
+
+#include "structs/orderedUnrolledList.hpp"
\ No newline at end of file
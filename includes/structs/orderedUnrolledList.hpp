@@ -0,0 +1,136 @@
+#include <stdexcept>
+#include <utility>
+#include "structs/orderedUnrolledList.h"
+
+using namespace List;
+
+template <class T, int B>
+OrderedUnrolledList<T, B>::OrderedUnrolledList() : UnrolledList<T, B>(){};
+
+template <class T, int B>
+void OrderedUnrolledList<T, B>::addNode(T &data)
+{
+    this->insertSorted(T(data));
+}
+
+template <class T, int B>
+void OrderedUnrolledList<T, B>::addNode(T &&data)
+{
+    this->insertSorted(std::move(data));
+}
+
+template <class T, int B>
+template <class... Args>
+void OrderedUnrolledList<T, B>::emplaceNode(Args &&...args)
+{
+    this->insertSorted(T(std::forward<Args>(args)...));
+}
+
+template <class T, int B>
+void OrderedUnrolledList<T, B>::insertSorted(T &&data)
+{
+    // Like OrderedLinkedList<T>, new data goes before the elements it equals.
+    int position;
+    UnrolledChunk<T, B> *chunk = this->lowerBound(data, position);
+    if (chunk == nullptr)
+    {
+        UnrolledList<T, B>::emplaceNode(std::move(data));
+        return;
+    }
+
+    this->insertInto(chunk, position, std::move(data));
+}
+
+template <class T, int B>
+void OrderedUnrolledList<T, B>::deleteNode(T &data)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    int position;
+    UnrolledChunk<T, B> *chunk = this->lowerBound(data, position);
+    while (chunk != nullptr)
+    {
+        T &element = chunk->elements()[position];
+        if (element > data)
+        {
+            break;
+        }
+
+        if (element == data)
+        {
+            this->removeFrom(chunk, position);
+            return;
+        }
+
+        position++;
+        if (position == chunk->count)
+        {
+            chunk = chunk->next;
+            position = 0;
+        }
+    }
+
+    throw std::out_of_range("Node not found");
+}
+
+template <class T, int B>
+T *OrderedUnrolledList<T, B>::getData(T &data)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    int position;
+    UnrolledChunk<T, B> *chunk = this->lowerBound(data, position);
+    if (chunk != nullptr && chunk->elements()[position] == data)
+    {
+        return chunk->elements() + position;
+    }
+
+    throw std::out_of_range("Index out of range");
+};
+
+template <class T, int B>
+UnrolledChunk<T, B> *OrderedUnrolledList<T, B>::lowerBound(T &data, int &position)
+{
+    // Skip the chunks whose last element goes before the data.
+    UnrolledChunk<T, B> *chunk = this->first;
+    while (chunk != nullptr && chunk->elements()[chunk->count - 1] < data)
+    {
+        chunk = chunk->next;
+        if (chunk != nullptr)
+        {
+            chunk->prefetchNext();
+        }
+    }
+
+    if (chunk == nullptr)
+    {
+        position = 0;
+        return nullptr;
+    }
+
+    // Binary search inside the chunk.
+    T *elements = chunk->elements();
+    int low = 0;
+    int high = chunk->count - 1;
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+        if (elements[middle] < data)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    position = low;
+    return chunk;
+};
\ No newline at end of file
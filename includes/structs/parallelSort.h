@@ -0,0 +1,53 @@
+#pragma once
+
+namespace List
+{
+    /**
+     * @brief Settings and helpers for the multi-threaded sort mode of the list containers.
+     * A sort is split into one segment per thread once every thread gets at least MIN_SEGMENT elements,
+     * the segments are sorted concurrently and then merged pairwise, also concurrently.
+     * Smaller inputs stay on the serial path. Comparison functions must be safe to call from several threads at once.
+     */
+    class ParallelSort
+    {
+    public:
+        /**
+         * @brief The smallest number of elements worth handing to a thread.
+         */
+        static const int MIN_SEGMENT = 16384;
+
+        /**
+         * @brief Caps the number of threads a sort may use.
+         * @param threads The maximum number of threads, or 0 to use every hardware thread.
+         */
+        static void setMaxThreads(int threads);
+
+        /**
+         * @return The maximum number of threads a sort may use, 0 meaning every hardware thread.
+         */
+        static int getMaxThreads();
+
+        /**
+         * @brief Picks the number of threads for sorting the given number of elements.
+         * @param size The number of elements to sort.
+         * @return The number of threads, 1 for the serial path.
+         */
+        static int threadsFor(int size);
+
+        /**
+         * @brief Stable sorts a random access range, in parallel when it is large enough.
+         * @tparam I The type of the random access iterators.
+         * @tparam C The type of the comparison.
+         * @param first Iterator to the first element.
+         * @param last Iterator past the last element.
+         * @param compare A callable returning true if the first element goes before the second.
+         */
+        template <class I, class C>
+        static void stableSort(I first, I last, C compare);
+
+    private:
+        static inline int maxThreads = 0; /**< Thread cap, 0 for every hardware thread */
+    };
+}
+
+#include "structs/parallelSort.hpp"
\ No newline at end of file
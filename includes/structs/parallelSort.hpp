@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "structs/parallelSort.h"
+
+using namespace List;
+
+inline void ParallelSort::setMaxThreads(int threads)
+{
+    ParallelSort::maxThreads = threads < 0 ? 0 : threads;
+}
+
+inline int ParallelSort::getMaxThreads()
+{
+    return ParallelSort::maxThreads;
+}
+
+inline int ParallelSort::threadsFor(int size)
+{
+    int threads = ParallelSort::maxThreads;
+    if (threads == 0)
+    {
+        threads = (int)std::thread::hardware_concurrency();
+    }
+
+    // Only split as far as every thread still gets a worthwhile segment.
+    threads = std::min(threads, size / MIN_SEGMENT);
+    return threads < 1 ? 1 : threads;
+}
+
+template <class I, class C>
+void ParallelSort::stableSort(I first, I last, C compare)
+{
+    int size = (int)(last - first);
+    int threads = ParallelSort::threadsFor(size);
+    if (threads == 1)
+    {
+        std::stable_sort(first, last, compare);
+        return;
+    }
+
+    // Segment boundaries, segment i being [bounds[i], bounds[i + 1]).
+    std::vector<I> bounds;
+    for (int i = 0; i <= threads; i++)
+    {
+        bounds.push_back(first + (long long)size * i / threads);
+    }
+
+    // Sort the segments concurrently, the last one on this thread.
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads - 1; i++)
+    {
+        workers.emplace_back([&bounds, &compare, i]()
+                             { std::stable_sort(bounds[i], bounds[i + 1], compare); });
+    }
+    std::stable_sort(bounds[threads - 1], bounds[threads], compare);
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    // Merge neighbouring segments pairwise, each round halving the segments.
+    // Merging a segment only with the one after it keeps the sort stable.
+    for (int step = 1; step < threads; step *= 2)
+    {
+        workers.clear();
+        for (int i = 0; i + step < threads; i += 2 * step)
+        {
+            I middle = bounds[i + step];
+            I end = bounds[std::min(i + 2 * step, threads)];
+            workers.emplace_back([&bounds, &compare, i, middle, end]()
+                                 { std::inplace_merge(bounds[i], middle, end, compare); });
+        }
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+}
\ No newline at end of file
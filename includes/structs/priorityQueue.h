@@ -0,0 +1,126 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+namespace List
+{
+    /**
+     * @brief Template class representing a priority queue stored as a binary heap in one contiguous block.
+     * The front of the queue is the element that goes first according to the comparison: enqueue and dequeue
+     * are O(log n), peek is O(1), and building the queue from n elements at once is O(n).
+     * @tparam T The type of data stored in the priority queue.
+     * @tparam C The type of the comparison, returning true if the first element goes before the second.
+     */
+    template <class T, class C = std::less<T>>
+    class PriorityQueue
+    {
+    public:
+        /**
+         * @brief Constructs an empty priority queue.
+         * @param compare The comparison deciding which element goes first.
+         */
+        PriorityQueue(C compare = C());
+
+        /**
+         * @brief Resets the priority queue to an empty state.
+         */
+        void reset();
+
+        /**
+         * @brief Reserves storage for at least the given number of elements.
+         * @param capacity The number of elements to reserve space for.
+         */
+        void reserve(int capacity);
+
+        /**
+         * @brief Replaces the content of the priority queue with a range of elements, heapifying them in O(n).
+         * @tparam I The type of the iterators.
+         * @param first Iterator to the first element.
+         * @param last Iterator past the last element.
+         */
+        template <class I>
+        void assign(I first, I last);
+
+        /**
+         * @brief Adds an element to the priority queue.
+         * @param data The data to be added to the priority queue.
+         */
+        void enqueue(T &data);
+
+        /**
+         * @brief Adds an element to the priority queue, moving the given data into it.
+         * @param data The data to be moved into the priority queue.
+         */
+        void enqueue(T &&data);
+
+        /**
+         * @brief Adds an element to the priority queue, constructing it in place.
+         * @tparam Args The types of the arguments.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <class... Args>
+        void emplace(Args &&...args);
+
+        /**
+         * @brief Removes the element at the front of the priority queue.
+         */
+        void dequeue();
+
+        /**
+         * @brief Gets the element at the front of the priority queue.
+         * @return Pointer to the element that goes first.
+         */
+        T *peek();
+
+        /**
+         * @brief Visits the elements ranked from `offset` to `offset + limit` in queue order, leaving the queue untouched.
+         * Walks the heap best first, holding only the children of the elements taken so far, so the first
+         * k = offset + limit elements are selected in O(k log k) however large the queue is.
+         * @tparam F The type of the visitor.
+         * @param offset The number of leading elements to skip.
+         * @param limit The largest number of elements to visit.
+         * @param visit Function called with a reference to each element, in order.
+         * @return The number of elements visited.
+         */
+        template <class F>
+        int visitInOrder(int offset, int limit, F visit);
+
+        /**
+         * @brief Checks if the priority queue is empty.
+         * @return true if the priority queue is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets the number of elements in the priority queue.
+         * @return The size of the priority queue.
+         */
+        int getSize();
+
+    protected:
+        /**
+         * @brief The heap, with the front of the queue at index 0 and the children of i at 2i+1 and 2i+2.
+         */
+        std::vector<T> elements;
+
+        /**
+         * @brief The comparison deciding which element goes first.
+         */
+        C compare;
+
+        /**
+         * @brief Moves an element up until its parent goes before it.
+         * @param index The index of the element.
+         */
+        void siftUp(int index);
+
+        /**
+         * @brief Moves an element down until it goes before both of its children.
+         * @param index The index of the element.
+         */
+        void siftDown(int index);
+    };
+}
+
+#include "structs/priorityQueue.hpp"
\ No newline at end of file
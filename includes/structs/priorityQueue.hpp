@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "structs/priorityQueue.h"
+
+using namespace List;
+
+template <class T, class C>
+PriorityQueue<T, C>::PriorityQueue(C compare) : elements(), compare(compare){};
+
+template <class T, class C>
+void PriorityQueue<T, C>::reset()
+{
+    this->elements.clear();
+}
+
+template <class T, class C>
+void PriorityQueue<T, C>::reserve(int capacity)
+{
+    this->elements.reserve(capacity);
+}
+
+template <class T, class C>
+template <class I>
+void PriorityQueue<T, C>::assign(I first, I last)
+{
+    this->elements.assign(first, last);
+
+    // Sift down every parent, from the last one to the root.
+    for (int i = this->getSize() / 2 - 1; i >= 0; i--)
+    {
+        this->siftDown(i);
+    }
+}
+
+template <class T, class C>
+void PriorityQueue<T, C>::enqueue(T &data)
+{
+    this->elements.push_back(data);
+    this->siftUp(this->getSize() - 1);
+}
+
+template <class T, class C>
+void PriorityQueue<T, C>::enqueue(T &&data)
+{
+    this->elements.push_back(std::move(data));
+    this->siftUp(this->getSize() - 1);
+}
+
+template <class T, class C>
+template <class... Args>
+void PriorityQueue<T, C>::emplace(Args &&...args)
+{
+    this->elements.emplace_back(std::forward<Args>(args)...);
+    this->siftUp(this->getSize() - 1);
+}
+
+template <class T, class C>
+void PriorityQueue<T, C>::dequeue()
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("Queue is empty.");
+    }
+
+    // Move the last leaf to the root and let it sink back into place.
+    if (this->getSize() > 1)
+    {
+        this->elements.front() = std::move(this->elements.back());
+    }
+    this->elements.pop_back();
+
+    if (!this->isEmpty())
+    {
+        this->siftDown(0);
+    }
+}
+
+template <class T, class C>
+T *PriorityQueue<T, C>::peek()
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("Queue is empty.");
+    }
+
+    return &this->elements.front();
+}
+
+template <class T, class C>
+template <class F>
+int PriorityQueue<T, C>::visitInOrder(int offset, int limit, F visit)
+{
+    // The frontier is a heap of element indices whose top is the element that goes first.
+    auto goesLater = [this](int a, int b)
+    { return this->compare(this->elements[b], this->elements[a]); };
+    std::vector<int> frontier;
+    if (!this->isEmpty() && limit > 0)
+    {
+        frontier.push_back(0);
+    }
+
+    int visited = 0;
+    for (int rank = 0; visited < limit && !frontier.empty(); rank++)
+    {
+        std::pop_heap(frontier.begin(), frontier.end(), goesLater);
+        int index = frontier.back();
+        frontier.pop_back();
+        if (rank >= offset)
+        {
+            visit(this->elements[index]);
+            visited++;
+        }
+
+        // Only the children of a taken element can come next.
+        for (int child = 2 * index + 1; child <= 2 * index + 2 && child < this->getSize(); child++)
+        {
+            frontier.push_back(child);
+            std::push_heap(frontier.begin(), frontier.end(), goesLater);
+        }
+    }
+    return visited;
+}
+
+template <class T, class C>
+bool PriorityQueue<T, C>::isEmpty()
+{
+    return this->elements.empty();
+}
+
+template <class T, class C>
+int PriorityQueue<T, C>::getSize()
+{
+    return (int)this->elements.size();
+}
+
+template <class T, class C>
+void PriorityQueue<T, C>::siftUp(int index)
+{
+    // Hold the element aside and shift parents down instead of swapping at every level.
+    T data = std::move(this->elements[index]);
+    while (index > 0)
+    {
+        int parent = (index - 1) / 2;
+        if (!this->compare(data, this->elements[parent]))
+        {
+            break;
+        }
+
+        this->elements[index] = std::move(this->elements[parent]);
+        index = parent;
+    }
+    this->elements[index] = std::move(data);
+}
+
+template <class T, class C>
+void PriorityQueue<T, C>::siftDown(int index)
+{
+    int size = this->getSize();
+    T data = std::move(this->elements[index]);
+    while (true)
+    {
+        int child = 2 * index + 1;
+        if (child >= size)
+        {
+            break;
+        }
+
+        // Pick the child that goes first.
+        if (child + 1 < size && this->compare(this->elements[child + 1], this->elements[child]))
+        {
+            child++;
+        }
+
+        if (!this->compare(this->elements[child], data))
+        {
+            break;
+        }
+
+        this->elements[index] = std::move(this->elements[child]);
+        index = child;
+    }
+    this->elements[index] = std::move(data);
+}
\ No newline at end of file
@@ -11,6 +11,9 @@ template <class T>
 class Queue
 {
 public:
+    using iterator = typename LinkedList<T>::iterator;             /**< Standard library iterator */
+    using const_iterator = typename LinkedList<T>::const_iterator; /**< Standard library const iterator */
+
     Queue();
     /**
      * @brief Adds an element to the end of the queue.
@@ -18,6 +21,20 @@ public:
      */
     void enqueue(T &data);
 
+    /**
+     * @brief Adds an element to the end of the queue, moving the given data into it.
+     * @param data The data to be moved into the queue.
+     */
+    void enqueue(T &&data);
+
+    /**
+     * @brief Adds an element to the end of the queue, constructing it in place.
+     * @tparam Args The types of the arguments.
+     * @param args The arguments forwarded to the constructor of T.
+     */
+    template <class... Args>
+    void emplace(Args &&...args);
+
     /**
      * @brief Removes the element from the front of the queue.
      */
@@ -36,9 +53,18 @@ public:
 
     /**
      * @brief Sorts the queue using the given comparison function.
-     * @param compare A function pointer to a comparison function.
+     * @tparam C The type of the comparison, a function pointer, lambda or function object.
+     * @param compare A callable returning true if the first element goes before the second.
      */
-    void sortQueue(bool (*compare)(T &a, T &b));
+    template <class C>
+    void sortQueue(C compare);
+
+    /**
+     * @brief Sorts the queue using a comparison function known at compile time, by its SortKey if it has one.
+     * @tparam Compare The comparison function.
+     */
+    template <auto Compare>
+    void sortQueue();
 
     /**
      * @brief Sorts the queue using the default comparison.
@@ -55,6 +81,36 @@ public:
      */
     Iterator<T> iterate();
 
+    /**
+     * @return A standard library iterator to the front of the queue.
+     */
+    iterator begin();
+
+    /**
+     * @return A standard library iterator past the back of the queue.
+     */
+    iterator end();
+
+    /**
+     * @return A const standard library iterator to the front of the queue.
+     */
+    const_iterator begin() const;
+
+    /**
+     * @return A const standard library iterator past the back of the queue.
+     */
+    const_iterator end() const;
+
+    /**
+     * @return A const standard library iterator to the front of the queue.
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @return A const standard library iterator past the back of the queue.
+     */
+    const_iterator cend() const;
+
 private:
     /**
      * @brief The linked list used to implement the queue.
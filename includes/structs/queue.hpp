@@ -1,4 +1,5 @@
 #include <stdexcept>
+#include <utility>
 #include "structs/queue.h"
 
 template <class T>
@@ -10,6 +11,19 @@ void Queue<T>::enqueue(T &data)
     this->queue.addNode(data);
 };
 
+template <class T>
+void Queue<T>::enqueue(T &&data)
+{
+    this->queue.addNode(std::move(data));
+};
+
+template <class T>
+template <class... Args>
+void Queue<T>::emplace(Args &&...args)
+{
+    this->queue.emplaceNode(std::forward<Args>(args)...);
+};
+
 template <class T>
 void Queue<T>::dequeue()
 {
@@ -35,11 +49,19 @@ bool Queue<T>::isEmpty()
 };
 
 template <class T>
-void Queue<T>::sortQueue(bool (*compare)(T &a, T &b))
+template <class C>
+void Queue<T>::sortQueue(C compare)
 {
     this->queue.sortNodes(compare);
 };
 
+template <class T>
+template <auto Compare>
+void Queue<T>::sortQueue()
+{
+    this->queue.template sortNodes<Compare>();
+};
+
 template <class T>
 void Queue<T>::sortQueue()
 {
@@ -56,4 +78,40 @@ template <class T>
 Iterator<T> Queue<T>::iterate()
 {
     return this->queue.iterate();
+};
+
+template <class T>
+typename Queue<T>::iterator Queue<T>::begin()
+{
+    return this->queue.begin();
+};
+
+template <class T>
+typename Queue<T>::iterator Queue<T>::end()
+{
+    return this->queue.end();
+};
+
+template <class T>
+typename Queue<T>::const_iterator Queue<T>::begin() const
+{
+    return this->queue.begin();
+};
+
+template <class T>
+typename Queue<T>::const_iterator Queue<T>::end() const
+{
+    return this->queue.end();
+};
+
+template <class T>
+typename Queue<T>::const_iterator Queue<T>::cbegin() const
+{
+    return this->queue.cbegin();
+};
+
+template <class T>
+typename Queue<T>::const_iterator Queue<T>::cend() const
+{
+    return this->queue.cend();
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace List
+{
+    /**
+     * @brief Node class for a radix trie.
+     * Each node is labelled with a run of characters, so a chain of single-child nodes is stored as one node.
+     * @tparam V The type of the values stored under a key.
+     */
+    template <class V>
+    class RadixNode
+    {
+    public:
+        /**
+         * @brief The characters on the edge leading to the node.
+         */
+        std::string label;
+
+        /**
+         * @brief The children of the node, sorted by the first character of their label.
+         */
+        std::vector<RadixNode<V> *> children;
+
+        /**
+         * @brief The values of the key ending at the node, in insertion order.
+         */
+        std::vector<V> values;
+
+        /**
+         * @brief Constructs a node with a label and no children or values.
+         * @param label The characters on the edge leading to the node.
+         */
+        RadixNode(std::string label);
+
+        /**
+         * @brief Finds where the child starting with a character is, or would be inserted.
+         * @param character The first character of the child's label.
+         * @return The index of the first child whose label starts with `character` or a greater character.
+         */
+        int childIndex(char character);
+
+        /**
+         * @brief Finds the child starting with a character.
+         * @param character The first character of the child's label.
+         * @return The index of the child, or -1 if there is none.
+         */
+        int findChild(char character);
+    };
+}
+
+#include "structs/radixNode.hpp"
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include <utility>
+#include "structs/radixNode.h"
+
+using namespace List;
+
+template <class V>
+RadixNode<V>::RadixNode(std::string label) : label(std::move(label)), children(), values(){};
+
+template <class V>
+int RadixNode<V>::childIndex(char character)
+{
+    // Binary search over the first characters; compared unsigned so the order matches std::string.
+    int low = 0;
+    int high = (int)this->children.size();
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+        if ((unsigned char)this->children[middle]->label[0] < (unsigned char)character)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+template <class V>
+int RadixNode<V>::findChild(char character)
+{
+    int index = this->childIndex(character);
+    if (index < (int)this->children.size() && this->children[index]->label[0] == character)
+    {
+        return index;
+    }
+    return -1;
+}
\ No newline at end of file
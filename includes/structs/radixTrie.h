@@ -0,0 +1,136 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "structs/radixNode.h"
+
+namespace List
+{
+    /**
+     * @brief Template class representing a radix trie mapping string keys to values, several values per key.
+     * Keys sharing a prefix share the nodes of that prefix, so exact and prefix lookups take time
+     * proportional to the length of the query, plus the number of matches, whatever the number of keys.
+     * @tparam V The type of the values, compared with == when removed.
+     */
+    template <class V>
+    class RadixTrie
+    {
+    public:
+        /**
+         * @brief Constructs an empty radix trie.
+         */
+        RadixTrie();
+
+        /**
+         * @brief Destructor.
+         */
+        ~RadixTrie();
+
+        /**
+         * @brief Radix tries are not copied.
+         */
+        RadixTrie(const RadixTrie<V> &other) = delete;
+
+        /**
+         * @brief Radix tries are not copied.
+         */
+        RadixTrie<V> &operator=(const RadixTrie<V> &other) = delete;
+
+        /**
+         * @brief Resets the radix trie to an empty state.
+         */
+        void reset();
+
+        /**
+         * @brief Adds a value under a key.
+         * @param key The key.
+         * @param value The value to add.
+         */
+        void insert(const std::string &key, V value);
+
+        /**
+         * @brief Adds several values under a key, walking the trie once for all of them.
+         * @param key The key.
+         * @param values The values to add, moved from, in the order they go after the key's values.
+         * @param count The number of values.
+         */
+        void insert(const std::string &key, V values[], int count);
+
+        /**
+         * @brief Removes a value from under a key.
+         * @param key The key.
+         * @param value The value to remove.
+         * @return true if the value was under the key, false otherwise.
+         */
+        bool remove(const std::string &key, V value);
+
+        /**
+         * @brief Visits the values under a key.
+         * @tparam F The type of the callable, taking a V &.
+         * @param key The key to look up.
+         * @param visit The callable receiving each value, in insertion order.
+         * @return The number of values visited.
+         */
+        template <class F>
+        int find(const std::string &key, F visit);
+
+        /**
+         * @brief Visits the values under every key starting with a prefix.
+         * @tparam F The type of the callable, taking a V &.
+         * @param prefix The prefix to look up. An empty prefix visits every value.
+         * @param visit The callable receiving each value, in key order.
+         * @return The number of values visited.
+         */
+        template <class F>
+        int findPrefix(const std::string &prefix, F visit);
+
+        /**
+         * @brief Checks if the radix trie is empty.
+         * @return true if the radix trie is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets the number of values in the radix trie.
+         * @return The size of the radix trie.
+         */
+        int getSize();
+
+    private:
+        RadixNode<V> *root; /**< The root node, labelled with the empty string */
+        int size;           /**< The number of values in the trie */
+
+        /**
+         * @brief Finds the node of a key.
+         * @param key The key to look up.
+         * @param path Receives the nodes from the root down to the parent of the node.
+         * @return The node whose path spells the key, or nullptr if there is none.
+         */
+        RadixNode<V> *findNode(const std::string &key, std::vector<RadixNode<V> *> *path);
+
+        /**
+         * @brief Finds the node of a key, adding the nodes and splitting the labels it needs.
+         * @param key The key.
+         * @return The node whose path spells the key.
+         */
+        RadixNode<V> *insertNode(const std::string &key);
+
+        /**
+         * @brief Visits every value in a subtree, in key order.
+         * @tparam F The type of the callable, taking a V &.
+         * @param node The root of the subtree.
+         * @param visit The callable receiving each value.
+         * @return The number of values visited.
+         */
+        template <class F>
+        int visitAll(RadixNode<V> *node, F &visit);
+
+        /**
+         * @brief Frees a subtree.
+         * @param node The root of the subtree.
+         */
+        void destroy(RadixNode<V> *node);
+    };
+}
+
+#include "structs/radixTrie.hpp"
\ No newline at end of file
@@ -0,0 +1,244 @@
+#include <algorithm>
+#include <utility>
+#include "structs/radixTrie.h"
+
+using namespace List;
+
+template <class V>
+RadixTrie<V>::RadixTrie() : root(new RadixNode<V>("")), size(0){};
+
+template <class V>
+RadixTrie<V>::~RadixTrie()
+{
+    this->destroy(this->root);
+}
+
+template <class V>
+void RadixTrie<V>::reset()
+{
+    this->destroy(this->root);
+    this->root = new RadixNode<V>("");
+    this->size = 0;
+}
+
+template <class V>
+void RadixTrie<V>::insert(const std::string &key, V value)
+{
+    this->insertNode(key)->values.push_back(std::move(value));
+    this->size++;
+}
+
+template <class V>
+void RadixTrie<V>::insert(const std::string &key, V values[], int count)
+{
+    std::vector<V> &nodeValues = this->insertNode(key)->values;
+    nodeValues.reserve(nodeValues.size() + count);
+    for (int i = 0; i < count; i++)
+    {
+        nodeValues.push_back(std::move(values[i]));
+    }
+    this->size += count;
+}
+
+template <class V>
+RadixNode<V> *RadixTrie<V>::insertNode(const std::string &key)
+{
+    RadixNode<V> *node = this->root;
+    size_t position = 0;
+    while (position < key.size())
+    {
+        int index = node->findChild(key[position]);
+        if (index == -1)
+        {
+            // Nothing shares the rest of the key: hang it below as a single leaf.
+            RadixNode<V> *leaf = new RadixNode<V>(key.substr(position));
+            node->children.insert(node->children.begin() + node->childIndex(key[position]), leaf);
+            node = leaf;
+            break;
+        }
+
+        RadixNode<V> *child = node->children[index];
+        size_t common = 0;
+        while (common < child->label.size() && position + common < key.size() && child->label[common] == key[position + common])
+        {
+            common++;
+        }
+
+        if (common < child->label.size())
+        {
+            // The key leaves the label part way through: split the label where they differ.
+            RadixNode<V> *middle = new RadixNode<V>(child->label.substr(0, common));
+            child->label.erase(0, common);
+            middle->children.push_back(child);
+            node->children[index] = middle;
+            child = middle;
+        }
+
+        node = child;
+        position += common;
+    }
+    return node;
+}
+
+template <class V>
+bool RadixTrie<V>::remove(const std::string &key, V value)
+{
+    std::vector<RadixNode<V> *> path;
+    RadixNode<V> *node = this->findNode(key, &path);
+    if (node == nullptr)
+    {
+        return false;
+    }
+
+    auto found = std::find(node->values.begin(), node->values.end(), value);
+    if (found == node->values.end())
+    {
+        return false;
+    }
+    node->values.erase(found);
+    this->size--;
+
+    if (node == this->root || !node->values.empty())
+    {
+        return true;
+    }
+
+    // Keep the trie compact: drop a node left without values or children,
+    // and fold a node left with a single child and no values into that child.
+    RadixNode<V> *parent = path.back();
+    if (node->children.empty())
+    {
+        parent->children.erase(parent->children.begin() + parent->findChild(node->label[0]));
+        delete node;
+        node = parent;
+        if (node == this->root || !node->values.empty())
+        {
+            return true;
+        }
+        path.pop_back();
+        parent = path.back();
+    }
+
+    if (node->children.size() == 1)
+    {
+        RadixNode<V> *child = node->children.front();
+        child->label.insert(0, node->label);
+        parent->children[parent->findChild(child->label[0])] = child;
+        delete node;
+    }
+    return true;
+}
+
+template <class V>
+template <class F>
+int RadixTrie<V>::find(const std::string &key, F visit)
+{
+    RadixNode<V> *node = this->findNode(key, nullptr);
+    if (node == nullptr)
+    {
+        return 0;
+    }
+
+    for (V &value : node->values)
+    {
+        visit(value);
+    }
+    return (int)node->values.size();
+}
+
+template <class V>
+template <class F>
+int RadixTrie<V>::findPrefix(const std::string &prefix, F visit)
+{
+    RadixNode<V> *node = this->root;
+    size_t position = 0;
+    while (position < prefix.size())
+    {
+        int index = node->findChild(prefix[position]);
+        if (index == -1)
+        {
+            return 0;
+        }
+
+        // The prefix may end inside the child's label; everything below the child still matches.
+        RadixNode<V> *child = node->children[index];
+        size_t length = std::min(child->label.size(), prefix.size() - position);
+        if (child->label.compare(0, length, prefix, position, length) != 0)
+        {
+            return 0;
+        }
+
+        node = child;
+        position += length;
+    }
+
+    return this->visitAll(node, visit);
+}
+
+template <class V>
+bool RadixTrie<V>::isEmpty()
+{
+    return this->size == 0;
+}
+
+template <class V>
+int RadixTrie<V>::getSize()
+{
+    return this->size;
+}
+
+template <class V>
+RadixNode<V> *RadixTrie<V>::findNode(const std::string &key, std::vector<RadixNode<V> *> *path)
+{
+    RadixNode<V> *node = this->root;
+    size_t position = 0;
+    while (position < key.size())
+    {
+        int index = node->findChild(key[position]);
+        if (index == -1)
+        {
+            return nullptr;
+        }
+
+        RadixNode<V> *child = node->children[index];
+        if (key.compare(position, child->label.size(), child->label) != 0)
+        {
+            return nullptr;
+        }
+
+        if (path != nullptr)
+        {
+            path->push_back(node);
+        }
+        node = child;
+        position += child->label.size();
+    }
+    return node;
+}
+
+template <class V>
+template <class F>
+int RadixTrie<V>::visitAll(RadixNode<V> *node, F &visit)
+{
+    int count = 0;
+    for (V &value : node->values)
+    {
+        visit(value);
+        count++;
+    }
+    for (RadixNode<V> *child : node->children)
+    {
+        count += this->visitAll(child, visit);
+    }
+    return count;
+}
+
+template <class V>
+void RadixTrie<V>::destroy(RadixNode<V> *node)
+{
+    for (RadixNode<V> *child : node->children)
+    {
+        this->destroy(child);
+    }
+    delete node;
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "structs/roaringContainer.h"
+
+namespace List
+{
+    /**
+     * @brief Class representing a compressed set of 32-bit unsigned integers, in the style of a roaring bitmap.
+     * Values are split by their high 16 bits into containers, each a sorted array while sparse and a bitset
+     * once dense, so memory follows the number of values and intersections work a container at a time.
+     * The cardinality is kept up to date, so getSize() is O(1).
+     */
+    class RoaringBitmap
+    {
+    public:
+        /**
+         * @brief Constructs an empty bitmap.
+         */
+        RoaringBitmap();
+
+        /**
+         * @brief Resets the bitmap to an empty state.
+         */
+        void reset();
+
+        /**
+         * @brief Adds a value to the bitmap.
+         * @param value The value to add.
+         * @return true if the value was added, false if it was already present.
+         */
+        bool add(uint32_t value);
+
+        /**
+         * @brief Removes a value from the bitmap.
+         * @param value The value to remove.
+         * @return true if the value was removed, false if it was not present.
+         */
+        bool remove(uint32_t value);
+
+        /**
+         * @brief Checks if a value is in the bitmap.
+         * @param value The value to look for.
+         * @return true if the value is present, false otherwise.
+         */
+        bool contains(uint32_t value);
+
+        /**
+         * @brief Computes the intersection of two bitmaps.
+         * @param other The other bitmap.
+         * @return A bitmap holding the values present in both.
+         */
+        RoaringBitmap intersect(RoaringBitmap &other);
+
+        /**
+         * @brief Counts the values present in both bitmaps without building their intersection.
+         * @param other The other bitmap.
+         * @return The number of common values.
+         */
+        int intersectionSize(RoaringBitmap &other);
+
+        /**
+         * @brief Visits the values of the bitmap in ascending order.
+         * @tparam F The type of the callable, taking a uint32_t.
+         * @param visit The callable receiving each value.
+         */
+        template <class F>
+        void forEach(F visit);
+
+        /**
+         * @brief Checks if the bitmap is empty.
+         * @return true if the bitmap is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets the number of values in the bitmap.
+         * @return The size of the bitmap.
+         */
+        int getSize();
+
+    private:
+        std::vector<uint16_t> keys;                /**< The high 16 bits of each container, ascending */
+        std::vector<RoaringContainer> containers;  /**< The containers, none of them empty */
+        int size;                                  /**< The number of values in the bitmap */
+
+        /**
+         * @brief Finds where the container of a key is, or would be inserted.
+         * @param key The high 16 bits of a value.
+         * @return The index of the first container whose key is not less than `key`.
+         */
+        int containerIndex(uint16_t key);
+    };
+}
+
+#include "structs/roaringBitmap.hpp"
\ No newline at end of file
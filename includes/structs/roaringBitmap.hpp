@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <utility>
+#include "structs/roaringBitmap.h"
+
+using namespace List;
+
+inline RoaringBitmap::RoaringBitmap() : keys(), containers(), size(0){};
+
+inline void RoaringBitmap::reset()
+{
+    this->keys.clear();
+    this->containers.clear();
+    this->size = 0;
+}
+
+inline bool RoaringBitmap::add(uint32_t value)
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    int index = this->containerIndex(key);
+    if (index == (int)this->keys.size() || this->keys[index] != key)
+    {
+        this->keys.insert(this->keys.begin() + index, key);
+        this->containers.insert(this->containers.begin() + index, RoaringContainer());
+    }
+
+    if (!this->containers[index].add((uint16_t)value))
+    {
+        return false;
+    }
+    this->size++;
+    return true;
+}
+
+inline bool RoaringBitmap::remove(uint32_t value)
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    int index = this->containerIndex(key);
+    if (index == (int)this->keys.size() || this->keys[index] != key || !this->containers[index].remove((uint16_t)value))
+    {
+        return false;
+    }
+    this->size--;
+
+    if (this->containers[index].cardinality == 0)
+    {
+        this->keys.erase(this->keys.begin() + index);
+        this->containers.erase(this->containers.begin() + index);
+    }
+    return true;
+}
+
+inline bool RoaringBitmap::contains(uint32_t value)
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    int index = this->containerIndex(key);
+    return index < (int)this->keys.size() && this->keys[index] == key && this->containers[index].contains((uint16_t)value);
+}
+
+inline RoaringBitmap RoaringBitmap::intersect(RoaringBitmap &other)
+{
+    // Only containers with a key in both bitmaps can share values.
+    RoaringBitmap result;
+    int first = 0;
+    int second = 0;
+    while (first < (int)this->keys.size() && second < (int)other.keys.size())
+    {
+        if (this->keys[first] < other.keys[second])
+        {
+            first++;
+        }
+        else if (other.keys[second] < this->keys[first])
+        {
+            second++;
+        }
+        else
+        {
+            RoaringContainer both = this->containers[first].intersect(other.containers[second]);
+            if (both.cardinality > 0)
+            {
+                result.size += both.cardinality;
+                result.keys.push_back(this->keys[first]);
+                result.containers.push_back(std::move(both));
+            }
+            first++;
+            second++;
+        }
+    }
+    return result;
+}
+
+inline int RoaringBitmap::intersectionSize(RoaringBitmap &other)
+{
+    int count = 0;
+    int first = 0;
+    int second = 0;
+    while (first < (int)this->keys.size() && second < (int)other.keys.size())
+    {
+        if (this->keys[first] < other.keys[second])
+        {
+            first++;
+        }
+        else if (other.keys[second] < this->keys[first])
+        {
+            second++;
+        }
+        else
+        {
+            count += this->containers[first].intersectionSize(other.containers[second]);
+            first++;
+            second++;
+        }
+    }
+    return count;
+}
+
+template <class F>
+void RoaringBitmap::forEach(F visit)
+{
+    for (int i = 0; i < (int)this->keys.size(); i++)
+    {
+        this->containers[i].forEach((uint32_t)this->keys[i] << 16, visit);
+    }
+}
+
+inline bool RoaringBitmap::isEmpty()
+{
+    return this->size == 0;
+}
+
+inline int RoaringBitmap::getSize()
+{
+    return this->size;
+}
+
+inline int RoaringBitmap::containerIndex(uint16_t key)
+{
+    return (int)(std::lower_bound(this->keys.begin(), this->keys.end(), key) - this->keys.begin());
+}
\ No newline at end of file
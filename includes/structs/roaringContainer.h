@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace List
+{
+    /**
+     * @brief Container class holding the values of a roaring bitmap that share their high 16 bits.
+     * A sparse container is a sorted array of the low 16 bits; once it holds more than ARRAY_LIMIT values
+     * it becomes a 65536-bit bitset, which is smaller at that point. Both forms know their cardinality.
+     */
+    class RoaringContainer
+    {
+    public:
+        /**
+         * @brief The largest number of values kept in array form.
+         */
+        static const int ARRAY_LIMIT = 4096;
+
+        /**
+         * @brief The number of 64-bit words of a bitset.
+         */
+        static const int BITSET_WORDS = 65536 / 64;
+
+        /**
+         * @brief The sorted low 16 bits of the values, while the container is in array form.
+         */
+        std::vector<uint16_t> array;
+
+        /**
+         * @brief One bit per low 16 bits, while the container is in bitset form.
+         */
+        std::vector<uint64_t> bitset;
+
+        /**
+         * @brief The number of values in the container.
+         */
+        int cardinality;
+
+        /**
+         * @brief Constructs an empty container in array form.
+         */
+        RoaringContainer();
+
+        /**
+         * @brief Checks if the container is in bitset form.
+         * @return true if the container is a bitset, false if it is an array.
+         */
+        bool isBitset();
+
+        /**
+         * @brief Adds a value to the container.
+         * @param low The low 16 bits of the value.
+         * @return true if the value was added, false if it was already present.
+         */
+        bool add(uint16_t low);
+
+        /**
+         * @brief Removes a value from the container.
+         * @param low The low 16 bits of the value.
+         * @return true if the value was removed, false if it was not present.
+         */
+        bool remove(uint16_t low);
+
+        /**
+         * @brief Checks if a value is in the container.
+         * @param low The low 16 bits of the value.
+         * @return true if the value is present, false otherwise.
+         */
+        bool contains(uint16_t low);
+
+        /**
+         * @brief Computes the intersection of two containers.
+         * @param other The other container.
+         * @return A container holding the values present in both.
+         */
+        RoaringContainer intersect(RoaringContainer &other);
+
+        /**
+         * @brief Counts the values present in both containers without building their intersection.
+         * @param other The other container.
+         * @return The number of common values.
+         */
+        int intersectionSize(RoaringContainer &other);
+
+        /**
+         * @brief Visits the values of the container in ascending order.
+         * @tparam F The type of the callable, taking a uint32_t.
+         * @param high The high 16 bits shared by the values, already shifted into place.
+         * @param visit The callable receiving each value.
+         */
+        template <class F>
+        void forEach(uint32_t high, F &visit);
+
+    private:
+        /**
+         * @brief Turns the array form into the bitset form.
+         */
+        void toBitset();
+
+        /**
+         * @brief Turns the bitset form into the array form.
+         */
+        void toArray();
+
+        /**
+         * @brief Counts the set bits of a word.
+         * @param word The word.
+         * @return The number of set bits.
+         */
+        static int popcount(uint64_t word);
+
+        /**
+         * @param word A non-zero word.
+         * @return The index of the lowest set bit of the word.
+         */
+        static int lowestBit(uint64_t word);
+
+        /**
+         * @brief ANDs two bitsets word by word, with SSE2 where available.
+         * @param first The first bitset.
+         * @param second The second bitset.
+         * @param result Receives the AND of the bitsets, or nullptr to only count.
+         * @return The number of set bits of the AND.
+         */
+        static int andBitsets(const uint64_t *first, const uint64_t *second, uint64_t *result);
+    };
+}
+
+#include "structs/roaringContainer.hpp"
\ No newline at end of file
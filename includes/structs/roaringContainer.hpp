@@ -0,0 +1,263 @@
+#include <algorithm>
+#include <iterator>
+#include "structs/roaringContainer.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HMS_ROARING_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace List;
+
+inline RoaringContainer::RoaringContainer() : array(), bitset(), cardinality(0){};
+
+inline bool RoaringContainer::isBitset()
+{
+    return !this->bitset.empty();
+}
+
+inline bool RoaringContainer::add(uint16_t low)
+{
+    if (this->isBitset())
+    {
+        uint64_t bit = 1ull << (low & 63);
+        if (this->bitset[low >> 6] & bit)
+        {
+            return false;
+        }
+        this->bitset[low >> 6] |= bit;
+        this->cardinality++;
+        return true;
+    }
+
+    auto position = std::lower_bound(this->array.begin(), this->array.end(), low);
+    if (position != this->array.end() && *position == low)
+    {
+        return false;
+    }
+    this->array.insert(position, low);
+    this->cardinality++;
+
+    if (this->cardinality > ARRAY_LIMIT)
+    {
+        this->toBitset();
+    }
+    return true;
+}
+
+inline bool RoaringContainer::remove(uint16_t low)
+{
+    if (this->isBitset())
+    {
+        uint64_t bit = 1ull << (low & 63);
+        if (!(this->bitset[low >> 6] & bit))
+        {
+            return false;
+        }
+        this->bitset[low >> 6] &= ~bit;
+        this->cardinality--;
+
+        if (this->cardinality <= ARRAY_LIMIT)
+        {
+            this->toArray();
+        }
+        return true;
+    }
+
+    auto position = std::lower_bound(this->array.begin(), this->array.end(), low);
+    if (position == this->array.end() || *position != low)
+    {
+        return false;
+    }
+    this->array.erase(position);
+    this->cardinality--;
+    return true;
+}
+
+inline bool RoaringContainer::contains(uint16_t low)
+{
+    if (this->isBitset())
+    {
+        return (this->bitset[low >> 6] >> (low & 63)) & 1;
+    }
+    return std::binary_search(this->array.begin(), this->array.end(), low);
+}
+
+inline RoaringContainer RoaringContainer::intersect(RoaringContainer &other)
+{
+    RoaringContainer result;
+    if (this->isBitset() && other.isBitset())
+    {
+        result.bitset.resize(BITSET_WORDS);
+        result.cardinality = andBitsets(this->bitset.data(), other.bitset.data(), result.bitset.data());
+        if (result.cardinality <= ARRAY_LIMIT)
+        {
+            result.toArray();
+        }
+        return result;
+    }
+
+    if (this->isBitset() || other.isBitset())
+    {
+        // Probe the bitset with each value of the array; the result is no larger than the array.
+        RoaringContainer &array = this->isBitset() ? other : *this;
+        RoaringContainer &bitset = this->isBitset() ? *this : other;
+        for (uint16_t low : array.array)
+        {
+            if ((bitset.bitset[low >> 6] >> (low & 63)) & 1)
+            {
+                result.array.push_back(low);
+            }
+        }
+        result.cardinality = (int)result.array.size();
+        return result;
+    }
+
+    std::set_intersection(this->array.begin(), this->array.end(), other.array.begin(), other.array.end(), std::back_inserter(result.array));
+    result.cardinality = (int)result.array.size();
+    return result;
+}
+
+inline int RoaringContainer::intersectionSize(RoaringContainer &other)
+{
+    if (this->isBitset() && other.isBitset())
+    {
+        return andBitsets(this->bitset.data(), other.bitset.data(), nullptr);
+    }
+
+    if (this->isBitset() || other.isBitset())
+    {
+        RoaringContainer &array = this->isBitset() ? other : *this;
+        RoaringContainer &bitset = this->isBitset() ? *this : other;
+        int count = 0;
+        for (uint16_t low : array.array)
+        {
+            count += (bitset.bitset[low >> 6] >> (low & 63)) & 1;
+        }
+        return count;
+    }
+
+    int count = 0;
+    auto first = this->array.begin();
+    auto second = other.array.begin();
+    while (first != this->array.end() && second != other.array.end())
+    {
+        if (*first < *second)
+        {
+            first++;
+        }
+        else if (*second < *first)
+        {
+            second++;
+        }
+        else
+        {
+            count++;
+            first++;
+            second++;
+        }
+    }
+    return count;
+}
+
+template <class F>
+void RoaringContainer::forEach(uint32_t high, F &visit)
+{
+    if (!this->isBitset())
+    {
+        for (uint16_t low : this->array)
+        {
+            visit(high | low);
+        }
+        return;
+    }
+
+    for (int i = 0; i < BITSET_WORDS; i++)
+    {
+        for (uint64_t word = this->bitset[i]; word; word &= word - 1)
+        {
+            visit(high | (uint32_t)(i * 64 + lowestBit(word)));
+        }
+    }
+}
+
+inline void RoaringContainer::toBitset()
+{
+    this->bitset.assign(BITSET_WORDS, 0);
+    for (uint16_t low : this->array)
+    {
+        this->bitset[low >> 6] |= 1ull << (low & 63);
+    }
+    std::vector<uint16_t>().swap(this->array);
+}
+
+inline void RoaringContainer::toArray()
+{
+    this->array.clear();
+    this->array.reserve(this->cardinality);
+    for (int i = 0; i < BITSET_WORDS; i++)
+    {
+        for (uint64_t word = this->bitset[i]; word; word &= word - 1)
+        {
+            this->array.push_back((uint16_t)(i * 64 + lowestBit(word)));
+        }
+    }
+    std::vector<uint64_t>().swap(this->bitset);
+}
+
+inline int RoaringContainer::popcount(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (int)((word * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+inline int RoaringContainer::lowestBit(uint64_t word)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return (int)index;
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+inline int RoaringContainer::andBitsets(const uint64_t *first, const uint64_t *second, uint64_t *result)
+{
+    int count = 0;
+#ifdef HMS_ROARING_SSE2
+    // Two words per instruction; the counts are taken from the stored words.
+    for (int i = 0; i < BITSET_WORDS; i += 2)
+    {
+        __m128i both = _mm_and_si128(_mm_loadu_si128((const __m128i *)(first + i)), _mm_loadu_si128((const __m128i *)(second + i)));
+        alignas(16) uint64_t words[2];
+        _mm_store_si128((__m128i *)words, both);
+        if (result != nullptr)
+        {
+            result[i] = words[0];
+            result[i + 1] = words[1];
+        }
+        count += popcount(words[0]) + popcount(words[1]);
+    }
+#else
+    for (int i = 0; i < BITSET_WORDS; i++)
+    {
+        uint64_t word = first[i] & second[i];
+        if (result != nullptr)
+        {
+            result[i] = word;
+        }
+        count += popcount(word);
+    }
+#endif
+    return count;
+}
\ No newline at end of file
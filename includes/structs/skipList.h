@@ -0,0 +1,259 @@
+#pragma once
+
+#include "structs/node.h"
+#include "structs/skipNode.h"
+#include "structs/iterator.h"
+#include "structs/listIterator.h"
+
+namespace List
+{
+    /**
+     * @brief Template class representing an ordered skip list.
+     * Offers the interface of OrderedLinkedList<T> with expected O(log n) insert, lookup and delete.
+     * The lowest level is an ordinary sorted linked list, so the skip list is iterated with Iterator<T>.
+     * @tparam T The type of data stored in the skip list.
+     */
+    template <class T>
+    class SkipList
+    {
+    public:
+        using iterator = ListIterator<T>;                /**< Standard library iterator */
+        using const_iterator = ListIterator<T, const T>; /**< Standard library const iterator */
+
+        /**
+         * @brief Constructs an empty skip list.
+         */
+        SkipList();
+
+        /**
+         * @brief Copy constructor.
+         * @param other Another SkipList object to copy from.
+         */
+        SkipList(const SkipList<T> &other);
+
+        /**
+         * @brief Assignment operator.
+         * @param other Another SkipList object to assign from.
+         * @return Reference to this SkipList object after assignment.
+         */
+        SkipList<T> &operator=(const SkipList<T> &other);
+
+        /**
+         * @brief Move constructor. Takes over the nodes of the other skip list, leaving it empty.
+         * @param other Another SkipList object to move from.
+         */
+        SkipList(SkipList<T> &&other);
+
+        /**
+         * @brief Move assignment operator. Takes over the nodes of the other skip list, leaving it empty.
+         * @param other Another SkipList object to move from.
+         * @return Reference to this SkipList object after assignment.
+         */
+        SkipList<T> &operator=(SkipList<T> &&other);
+
+        /**
+         * @brief Destructor.
+         */
+        ~SkipList();
+
+        /**
+         * @brief Resets the skip list to an empty state.
+         */
+        void reset();
+
+        /**
+         * @brief Adds a node with the given data to the skip list in sorted order.
+         * @param data The data to be added to the skip list.
+         */
+        void addNode(T &data);
+
+        /**
+         * @brief Adds a node to the skip list in sorted order, moving the given data into it.
+         * @param data The data to be moved into the skip list.
+         */
+        void addNode(T &&data);
+
+        /**
+         * @brief Constructs data from the given arguments and adds it to the skip list in sorted order.
+         * @tparam Args The types of the arguments.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <class... Args>
+        void emplaceNode(Args &&...args);
+
+        /**
+         * @brief Appends nodes after the last node without searching for their places, e.g. to rebuild a list
+         * from data that is already in order. The data of each node must not go before the node in front of it.
+         * @tparam F The type of the function building the data.
+         * @tparam V The type of the function visiting the stored data.
+         * @param count The number of nodes to append.
+         * @param make Function returning the data of the node at an index, from 0, to move into the node.
+         * @param visit Function called with the stored data and the index of each node once it is linked,
+         * e.g. to index the data while it is still in cache.
+         */
+        template <class F, class V>
+        void appendNodes(int count, F make, V visit);
+
+        /**
+         * @brief Deletes the node containing the given data from the skip list.
+         * @param data The data to be deleted from the skip list.
+         */
+        void deleteNode(T &data);
+
+        /**
+         * @brief Searches nodes in the skip list using a custom comparison function.
+         * @tparam L The type of the list receiving the matches.
+         * @tparam C The type of the comparison, a function pointer, lambda or function object.
+         * @tparam K The type of the value to compare against.
+         * @param list Another list object where matching nodes will be added.
+         * @param compare A callable to compare T and K.
+         * @param compareValue The value to compare against K.
+         */
+        template <class L, class C, class K>
+        void searchNodes(L &list, C compare, K compareValue);
+
+        /**
+         * @brief Searches nodes in the skip list by comparing node data directly.
+         * @tparam L The type of the list receiving the matches.
+         * @param list Another list object where matching nodes will be added.
+         * @param compareValue The value to compare against node data.
+         */
+        template <class L>
+        void searchNodes(L &list, T compareValue);
+
+        /**
+         * @brief Checks if the skip list is empty.
+         * @return true if the skip list is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets a pointer to the data stored at the specified index in the skip list.
+         * @param index The index of the data to retrieve.
+         * @return Pointer to the data at the specified index.
+         */
+        T *getData(int index);
+
+        /**
+         * @brief Retrieves the data stored in the node that matches the given data.
+         * @param data The data to match against nodes in the skip list.
+         * @return Pointer to the matching data, or nullptr if no match is found.
+         */
+        T *getData(T &data);
+
+        /**
+         * @brief Gets the number of nodes in the skip list.
+         * @return The size of the skip list.
+         */
+        int getSize();
+
+        /**
+         * @brief Returns an iterator for iterating through the skip list in order.
+         * @return An iterator for the skip list.
+         */
+        Iterator<T> iterate();
+
+        /**
+         * @brief Returns a standard library iterator to the first node in order.
+         * @return An iterator to the first node in order.
+         */
+        iterator begin();
+
+        /**
+         * @brief Returns a standard library iterator past the last node.
+         * @return An iterator past the last node.
+         */
+        iterator end();
+
+        /**
+         * @brief Returns a const standard library iterator to the first node in order.
+         * @return A const iterator to the first node in order.
+         */
+        const_iterator begin() const;
+
+        /**
+         * @brief Returns a const standard library iterator past the last node.
+         * @return A const iterator past the last node.
+         */
+        const_iterator end() const;
+
+        /**
+         * @brief Returns a const standard library iterator to the first node in order.
+         * @return A const iterator to the first node in order.
+         */
+        const_iterator cbegin() const;
+
+        /**
+         * @brief Returns a const standard library iterator past the last node.
+         * @return A const iterator past the last node.
+         */
+        const_iterator cend() const;
+
+    protected:
+        /**
+         * @brief The maximum number of levels. With a promotion chance of 1/4 this covers billions of nodes.
+         */
+        static const int MAX_LEVEL = 16;
+
+        /**
+         * @brief The first node of each level.
+         */
+        Node<T> *head[MAX_LEVEL];
+
+        /**
+         * @brief The number of levels currently in use.
+         */
+        int level;
+
+        /**
+         * @brief The current size of the skip list.
+         */
+        int size;
+
+        /**
+         * @brief State of the random generator deciding node levels.
+         */
+        unsigned int seed;
+
+        /**
+         * @brief Gets the link slot of a node on the given level.
+         * @param node The node, or nullptr for the head of the list.
+         * @param level The level of the link.
+         * @return Pointer to the slot holding the next node on that level.
+         */
+        Node<T> **getLink(Node<T> *node, int level);
+
+        /**
+         * @brief Finds, on every level, the link slot after which the given data belongs.
+         * @param data The data to locate.
+         * @param update Array receiving a link slot per level.
+         */
+        void findPosition(T &data, Node<T> **update[]);
+
+        /**
+         * @brief Draws a random level for a new node.
+         * @return The level of the new node.
+         */
+        int randomLevel();
+
+        /**
+         * @brief Links a new node into every level it was drawn for, in sorted position.
+         * @param newData The node to link.
+         */
+        void linkNode(SkipNode<T> *newData);
+
+        /**
+         * @brief Copies the nodes of another skip list, which are already sorted, in linear time.
+         * @param other The skip list to copy from.
+         */
+        void copyNodes(const SkipList<T> &other);
+
+        /**
+         * @brief Takes over the nodes of another skip list, leaving it empty.
+         * @param other The skip list to move from.
+         */
+        void moveNodes(SkipList<T> &other);
+    };
+}
+
+#include "structs/skipList.hpp"
\ No newline at end of file
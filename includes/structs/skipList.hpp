@@ -0,0 +1,428 @@
+#include <stdexcept>
+#include <utility>
+#include "structs/skipList.h"
+
+using namespace List;
+
+template <class T>
+SkipList<T>::SkipList()
+{
+    for (int i = 0; i < MAX_LEVEL; i++)
+    {
+        this->head[i] = nullptr;
+    }
+    this->level = 1;
+    this->size = 0;
+    this->seed = 2463534242u;
+}
+
+template <class T>
+SkipList<T>::SkipList(const SkipList<T> &other) : SkipList()
+{
+    this->copyNodes(other);
+}
+
+template <class T>
+SkipList<T> &SkipList<T>::operator=(const SkipList<T> &other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    this->reset();
+    this->copyNodes(other);
+
+    return *this;
+}
+
+template <class T>
+SkipList<T>::SkipList(SkipList<T> &&other) : SkipList()
+{
+    this->moveNodes(other);
+}
+
+template <class T>
+SkipList<T> &SkipList<T>::operator=(SkipList<T> &&other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    this->reset();
+    this->moveNodes(other);
+
+    return *this;
+}
+
+template <class T>
+SkipList<T>::~SkipList()
+{
+    this->reset();
+}
+
+template <class T>
+void SkipList<T>::reset()
+{
+    // Every node is on level 0, so deleting along it frees the whole list.
+    while (this->head[0] != nullptr)
+    {
+        SkipNode<T> *temp = static_cast<SkipNode<T> *>(this->head[0]);
+        this->head[0] = this->head[0]->next;
+        delete temp;
+    }
+
+    for (int i = 0; i < MAX_LEVEL; i++)
+    {
+        this->head[i] = nullptr;
+    }
+    this->level = 1;
+    this->size = 0;
+}
+
+template <class T>
+void SkipList<T>::addNode(T &data)
+{
+    this->linkNode(new SkipNode<T>(data, this->randomLevel()));
+}
+
+template <class T>
+void SkipList<T>::addNode(T &&data)
+{
+    this->linkNode(new SkipNode<T>(std::move(data), this->randomLevel()));
+}
+
+template <class T>
+template <class... Args>
+void SkipList<T>::emplaceNode(Args &&...args)
+{
+    // The position depends on the data, so it is built before the node.
+    this->addNode(T(std::forward<Args>(args)...));
+}
+
+template <class T>
+template <class F, class V>
+void SkipList<T>::appendNodes(int count, F make, V visit)
+{
+    // Find the last link of each level once, then append the nodes after them like copyNodes().
+    Node<T> **tail[MAX_LEVEL];
+    Node<T> *current = nullptr;
+    for (int i = MAX_LEVEL - 1; i >= 0; i--)
+    {
+        Node<T> **link = this->getLink(current, i);
+        while (*link != nullptr)
+        {
+            current = *link;
+            link = this->getLink(current, i);
+        }
+        tail[i] = link;
+    }
+
+    for (int index = 0; index < count; index++)
+    {
+        int newLevel = this->randomLevel();
+        SkipNode<T> *newData = new SkipNode<T>(make(index), newLevel);
+        for (int i = 0; i < newLevel; i++)
+        {
+            *tail[i] = newData;
+            tail[i] = this->getLink(newData, i);
+        }
+
+        if (newLevel > this->level)
+        {
+            this->level = newLevel;
+        }
+        this->size++;
+        visit(newData->data, index);
+    }
+}
+
+template <class T>
+void SkipList<T>::deleteNode(T &data)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    Node<T> **update[MAX_LEVEL];
+    this->findPosition(data, update);
+
+    Node<T> *target = *update[0];
+    if (target == nullptr || !(target->data == data))
+    {
+        throw std::out_of_range("Node not found");
+    }
+
+    // Unlink the node from every level it is on.
+    SkipNode<T> *targetNode = static_cast<SkipNode<T> *>(target);
+    for (int i = 0; i < targetNode->level; i++)
+    {
+        if (*update[i] == target)
+        {
+            *update[i] = *this->getLink(target, i);
+        }
+    }
+    delete targetNode;
+    this->size--;
+
+    // Drop the levels left empty.
+    while (this->level > 1 && this->head[this->level - 1] == nullptr)
+    {
+        this->level--;
+    }
+}
+
+template <class T>
+template <class L, class C, class K>
+void SkipList<T>::searchNodes(L &list, C compare, K compareValue)
+{
+    Node<T> *current = this->head[0];
+    while (current != nullptr)
+    {
+        if (compare(current->data, compareValue))
+        {
+            list.addNode(current->data);
+        }
+        current = current->next;
+    }
+};
+
+template <class T>
+template <class L>
+void SkipList<T>::searchNodes(L &list, T compareValue)
+{
+    Node<T> *current = this->head[0];
+    while (current != nullptr)
+    {
+        if (current->data == compareValue)
+        {
+            list.addNode(current->data);
+        }
+        current = current->next;
+    }
+};
+
+template <class T>
+bool SkipList<T>::isEmpty()
+{
+    return this->size == 0;
+}
+
+template <class T>
+T *SkipList<T>::getData(int index)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    int currentIndex = 0;
+    Node<T> *temp = this->head[0];
+    while (temp != nullptr)
+    {
+        if (currentIndex == index)
+        {
+            return &temp->data;
+        }
+
+        temp = temp->next;
+        currentIndex++;
+    }
+
+    throw std::out_of_range("Index out of range");
+};
+
+template <class T>
+T *SkipList<T>::getData(T &data)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    Node<T> **update[MAX_LEVEL];
+    this->findPosition(data, update);
+
+    // The first node not less than the data is the only candidate.
+    Node<T> *candidate = *update[0];
+    if (candidate != nullptr && candidate->data == data)
+    {
+        return &candidate->data;
+    }
+
+    return nullptr;
+};
+
+template <class T>
+int SkipList<T>::getSize()
+{
+    return this->size;
+}
+
+template <class T>
+Iterator<T> SkipList<T>::iterate()
+{
+    return Iterator<T>(this->head[0]);
+}
+
+template <class T>
+typename SkipList<T>::iterator SkipList<T>::begin()
+{
+    return iterator(this->head[0]);
+}
+
+template <class T>
+typename SkipList<T>::iterator SkipList<T>::end()
+{
+    return iterator();
+}
+
+template <class T>
+typename SkipList<T>::const_iterator SkipList<T>::begin() const
+{
+    return const_iterator(this->head[0]);
+}
+
+template <class T>
+typename SkipList<T>::const_iterator SkipList<T>::end() const
+{
+    return const_iterator();
+}
+
+template <class T>
+typename SkipList<T>::const_iterator SkipList<T>::cbegin() const
+{
+    return const_iterator(this->head[0]);
+}
+
+template <class T>
+typename SkipList<T>::const_iterator SkipList<T>::cend() const
+{
+    return const_iterator();
+}
+
+template <class T>
+Node<T> **SkipList<T>::getLink(Node<T> *node, int level)
+{
+    if (node == nullptr)
+    {
+        return &this->head[level];
+    }
+
+    if (level == 0)
+    {
+        return &node->next;
+    }
+
+    return &static_cast<SkipNode<T> *>(node)->forward[level - 1];
+}
+
+template <class T>
+void SkipList<T>::findPosition(T &data, Node<T> **update[])
+{
+    // Start from the top level, moving right while the next node is smaller,
+    // then drop down a level.
+    Node<T> *current = nullptr;
+    for (int i = this->level - 1; i >= 0; i--)
+    {
+        Node<T> **link = this->getLink(current, i);
+        while (*link != nullptr && (*link)->data < data)
+        {
+            current = *link;
+            link = this->getLink(current, i);
+        }
+        update[i] = link;
+    }
+}
+
+template <class T>
+int SkipList<T>::randomLevel()
+{
+    // Xorshift generator, each extra level has a 1/4 chance.
+    this->seed ^= this->seed << 13;
+    this->seed ^= this->seed >> 17;
+    this->seed ^= this->seed << 5;
+
+    int newLevel = 1;
+    unsigned int bits = this->seed;
+    while (newLevel < MAX_LEVEL && (bits & 3) == 0)
+    {
+        newLevel++;
+        bits >>= 2;
+    }
+
+    return newLevel;
+}
+
+template <class T>
+void SkipList<T>::linkNode(SkipNode<T> *newData)
+{
+    Node<T> **update[MAX_LEVEL];
+    this->findPosition(newData->data, update);
+
+    int newLevel = newData->level;
+    if (newLevel > this->level)
+    {
+        // Levels not used so far start from the head.
+        for (int i = this->level; i < newLevel; i++)
+        {
+            update[i] = &this->head[i];
+        }
+        this->level = newLevel;
+    }
+
+    // Splice the node in after the found slot of each of its levels.
+    for (int i = 0; i < newLevel; i++)
+    {
+        *this->getLink(newData, i) = *update[i];
+        *update[i] = newData;
+    }
+    this->size++;
+}
+
+template <class T>
+void SkipList<T>::copyNodes(const SkipList<T> &other)
+{
+    // The nodes arrive in order, so each one is appended after the last node of its levels.
+    Node<T> **tail[MAX_LEVEL];
+    for (int i = 0; i < MAX_LEVEL; i++)
+    {
+        tail[i] = &this->head[i];
+    }
+
+    Node<T> *currentOther = other.head[0];
+    while (currentOther != nullptr)
+    {
+        int newLevel = this->randomLevel();
+        SkipNode<T> *newData = new SkipNode<T>(currentOther->data, newLevel);
+        for (int i = 0; i < newLevel; i++)
+        {
+            *tail[i] = newData;
+            tail[i] = this->getLink(newData, i);
+        }
+
+        if (newLevel > this->level)
+        {
+            this->level = newLevel;
+        }
+        this->size++;
+        currentOther = currentOther->next;
+    }
+}
+
+template <class T>
+void SkipList<T>::moveNodes(SkipList<T> &other)
+{
+    for (int i = 0; i < MAX_LEVEL; i++)
+    {
+        this->head[i] = other.head[i];
+        other.head[i] = nullptr;
+    }
+    this->level = other.level;
+    this->size = other.size;
+
+    other.level = 1;
+    other.size = 0;
+}
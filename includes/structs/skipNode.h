@@ -0,0 +1,54 @@
+#pragma once
+
+#include "structs/node.h"
+
+namespace List
+{
+    /**
+     * @brief Node class for a skip list.
+     * Level 0 is the inherited `next` pointer, so a skip list can be walked with Iterator<T>.
+     * @tparam T The type of data stored in the node.
+     */
+    template <class T>
+    class SkipNode : public Node<T>
+    {
+    public:
+        /**
+         * @brief The number of levels the node is linked into.
+         */
+        int level;
+
+        /**
+         * @brief Pointers to the next node on levels 1 to level - 1, or nullptr for a level 1 node.
+         */
+        Node<T> **forward;
+
+        /**
+         * @brief Constructs a skip list node with the given data.
+         * @param data The data to be stored in the node.
+         * @param level The number of levels the node is linked into.
+         */
+        SkipNode(T &data, int level);
+
+        /**
+         * @brief Constructs a skip list node taking over the given data.
+         * @param data The data to be moved into the node.
+         * @param level The number of levels the node is linked into.
+         */
+        SkipNode(T &&data, int level);
+
+        /**
+         * @brief Destructor.
+         */
+        ~SkipNode();
+
+    private:
+        /**
+         * @brief Allocates the forward pointers of the levels above level 0.
+         * @param level The number of levels the node is linked into.
+         */
+        void allocateLevels(int level);
+    };
+}
+
+#include "structs/skipNode.hpp"
\ No newline at end of file
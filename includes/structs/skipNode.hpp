@@ -0,0 +1,36 @@
+#include <utility>
+#include "structs/skipNode.h"
+
+template <class T>
+SkipNode<T>::SkipNode(T &data, int level) : Node<T>(data)
+{
+    this->allocateLevels(level);
+}
+
+template <class T>
+SkipNode<T>::SkipNode(T &&data, int level) : Node<T>(std::move(data))
+{
+    this->allocateLevels(level);
+}
+
+template <class T>
+SkipNode<T>::~SkipNode()
+{
+    delete[] this->forward;
+}
+
+template <class T>
+void SkipNode<T>::allocateLevels(int level)
+{
+    this->level = level;
+    this->forward = nullptr;
+
+    if (level > 1)
+    {
+        this->forward = new Node<T> *[level - 1];
+        for (int i = 0; i < level - 1; i++)
+        {
+            this->forward[i] = nullptr;
+        }
+    }
+}
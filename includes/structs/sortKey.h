@@ -0,0 +1,19 @@
+#pragma once
+
+namespace List
+{
+    /**
+     * @brief Compile-time sort key of a comparison function.
+     * By default a comparison function has no key and sorting calls it for every comparison.
+     * A comparison function that orders elements by a value computable from each element alone
+     * can be specialized with `enabled` set to true and a `static Key key(T &data)` for which
+     * `Compare(a, b)` equals `key(a) < key(b)`. Sorting with sortNodes<Compare>() then computes
+     * each key once and compares the plain keys, which the compiler can inline.
+     * @tparam Compare The comparison function.
+     */
+    template <auto Compare>
+    struct SortKey
+    {
+        static const bool enabled = false; /**< Whether the comparison function has a key */
+    };
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include "structs/hashMap.h"
+
+namespace List
+{
+    /**
+     * @brief Handle of a string interned in a StringPool. Two handles from the same pool are equal exactly when
+     * their strings are.
+     */
+    typedef uint32_t Symbol;
+
+    /**
+     * @brief Class interning strings, so each distinct value is stored once and is referred to by a 32-bit Symbol.
+     * Strings live in fixed size chunks that never move, so looking a symbol up takes no lock and the returned
+     * reference stays valid for the life of the pool. Interning is serialized by a mutex and may be called from
+     * any thread.
+     */
+    class StringPool
+    {
+    public:
+        /**
+         * @brief The symbol of the empty string, interned by every pool.
+         */
+        static const Symbol EMPTY = 0;
+
+        /**
+         * @brief The number of strings in a chunk, as a power of two.
+         */
+        static const int CHUNK_BITS = 12;
+
+        /**
+         * @brief The number of strings in a chunk.
+         */
+        static const int CHUNK_SIZE = 1 << CHUNK_BITS;
+
+        /**
+         * @brief The largest number of chunks, which bounds the number of distinct strings.
+         */
+        static const int MAX_CHUNKS = 1 << 12;
+
+        /**
+         * @brief Constructs a pool holding only the empty string.
+         */
+        StringPool();
+
+        /**
+         * @brief Destructor.
+         */
+        ~StringPool();
+
+        /**
+         * @brief String pools are not copied.
+         */
+        StringPool(const StringPool &other) = delete;
+
+        /**
+         * @brief String pools are not copied.
+         */
+        StringPool &operator=(const StringPool &other) = delete;
+
+        /**
+         * @brief Gets the pool shared by the whole process.
+         * @return Reference to the global string pool.
+         */
+        static StringPool &global();
+
+        /**
+         * @brief Gets the symbol of a string, adding the string to the pool if it is new.
+         * @param value The string to intern.
+         * @return The symbol of the string.
+         * @throws std::out_of_range if the pool is full.
+         */
+        Symbol intern(std::string_view value);
+
+        /**
+         * @brief Looks up the symbol of a string without adding it.
+         * @param value The string to look up.
+         * @param symbol Receives the symbol of the string if it is in the pool.
+         * @return true if the string is in the pool, false otherwise.
+         */
+        bool find(std::string_view value, Symbol &symbol);
+
+        /**
+         * @brief Gets the string of a symbol.
+         * @param symbol A symbol returned by this pool.
+         * @return Reference to the string, valid for the life of the pool.
+         */
+        const std::string &get(Symbol symbol);
+
+        /**
+         * @brief Gets the number of distinct strings in the pool.
+         * @return The size of the pool.
+         */
+        int getSize();
+
+    private:
+        std::mutex mutex;                              /**< Serializes interning */
+        HashMap<std::string_view, Symbol> symbols;     /**< Symbol of each string, keyed by views of the stored strings */
+        std::atomic<std::string *> chunks[MAX_CHUNKS]; /**< The chunks of strings, allocated as they fill up */
+        std::atomic<int> size;                         /**< The number of strings in the pool */
+    };
+}
+
+#include "structs/stringPool.hpp"
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <stdexcept>
+#include "structs/stringPool.h"
+
+using namespace List;
+
+inline StringPool::StringPool() : mutex(), symbols(), size(0)
+{
+    for (int i = 0; i < MAX_CHUNKS; i++)
+    {
+        this->chunks[i].store(nullptr, std::memory_order_relaxed);
+    }
+    this->intern(std::string_view());
+}
+
+inline StringPool::~StringPool()
+{
+    for (int i = 0; i < MAX_CHUNKS; i++)
+    {
+        delete[] this->chunks[i].load(std::memory_order_relaxed);
+    }
+}
+
+inline StringPool &StringPool::global()
+{
+    static StringPool pool;
+    return pool;
+}
+
+inline Symbol StringPool::intern(std::string_view value)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    Symbol *found = this->symbols.find(value);
+    if (found != nullptr)
+    {
+        return *found;
+    }
+
+    int index = this->size.load(std::memory_order_relaxed);
+    if (index >= MAX_CHUNKS * CHUNK_SIZE)
+    {
+        throw std::out_of_range("String pool is full");
+    }
+
+    std::string *chunk = this->chunks[index >> CHUNK_BITS].load(std::memory_order_relaxed);
+    if (chunk == nullptr)
+    {
+        chunk = new std::string[CHUNK_SIZE];
+        this->chunks[index >> CHUNK_BITS].store(chunk, std::memory_order_release);
+    }
+
+    // The map keys view the stored string, which never moves, so each value is held once.
+    std::string &stored = chunk[index & (CHUNK_SIZE - 1)];
+    stored.assign(value.data(), value.size());
+    this->symbols.insert(std::string_view(stored), Symbol(index));
+    this->size.store(index + 1, std::memory_order_release);
+    return Symbol(index);
+}
+
+inline bool StringPool::find(std::string_view value, Symbol &symbol)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    Symbol *found = this->symbols.find(value);
+    if (found == nullptr)
+    {
+        return false;
+    }
+    symbol = *found;
+    return true;
+}
+
+inline const std::string &StringPool::get(Symbol symbol)
+{
+    return this->chunks[symbol >> CHUNK_BITS].load(std::memory_order_acquire)[symbol & (CHUNK_SIZE - 1)];
+}
+
+inline int StringPool::getSize()
+{
+    return this->size.load(std::memory_order_acquire);
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+namespace List
+{
+    /**
+     * @brief Default number of elements per chunk, so the elements of a chunk span about eight cache lines.
+     * @tparam T The type of data stored in the chunk.
+     * @return The number of elements per chunk.
+     */
+    template <class T>
+    constexpr int unrolledCapacity()
+    {
+        return sizeof(T) >= 64 ? 8 : (int)(512 / sizeof(T));
+    }
+
+    /**
+     * @brief Chunk of an unrolled linked list, holding up to B elements in a small array.
+     * The elements occupy the first `count` slots; the other slots are raw storage.
+     * @tparam T The type of data stored in the chunk.
+     * @tparam B The number of elements a chunk holds.
+     */
+    template <class T, int B>
+    class UnrolledChunk
+    {
+    public:
+        static_assert(B >= 2, "An unrolled chunk must hold at least two elements");
+
+        int count;                   /**< The number of elements in the chunk */
+        UnrolledChunk<T, B> *next;   /**< Pointer to the next chunk in the list */
+        UnrolledChunk<T, B> *prev;   /**< Pointer to the previous chunk in the list */
+
+        /**
+         * @brief Constructs an empty chunk.
+         */
+        UnrolledChunk();
+
+        /**
+         * @return Pointer to the first element of the chunk.
+         */
+        T *elements();
+
+        /**
+         * @brief Constructs an element at the end of the chunk, which must not be full.
+         * @tparam Args The types of the arguments.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <class... Args>
+        void append(Args &&...args);
+
+        /**
+         * @brief Moves data into the chunk at a position, shifting the following elements up.
+         * The chunk must not be full.
+         * @param position The position to insert at, from 0 to count.
+         * @param data The data to be moved into the chunk.
+         */
+        void insert(int position, T &&data);
+
+        /**
+         * @brief Destroys the element at a position, shifting the following elements down.
+         * @param position The position of the element to remove.
+         */
+        void erase(int position);
+
+        /**
+         * @brief Moves the elements from a position onwards to the end of another chunk, which must have room for them.
+         * @param other The chunk receiving the elements.
+         * @param from The position of the first element to move.
+         */
+        void moveInto(UnrolledChunk<T, B> *other, int from);
+
+        /**
+         * @brief Destroys every element of the chunk.
+         */
+        void clear();
+
+        /**
+         * @brief Hints the processor to start loading the next chunk, so a scan does not stall when it gets there.
+         */
+        void prefetchNext();
+
+    private:
+        alignas(T) unsigned char storage[sizeof(T) * B]; /**< Raw storage for the elements */
+
+        /**
+         * @brief Move constructs the element at one position from the element at another, and destroys the latter.
+         * @param to The position to move to, which must be unconstructed.
+         * @param from The position to move from.
+         */
+        void relocate(int to, int from);
+    };
+}
+
+#include "structs/unrolledChunk.hpp"
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include <new>
+#include <utility>
+#include "structs/unrolledChunk.h"
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+using namespace List;
+
+template <class T, int B>
+UnrolledChunk<T, B>::UnrolledChunk() : count(0), next(nullptr), prev(nullptr){};
+
+template <class T, int B>
+T *UnrolledChunk<T, B>::elements()
+{
+    return std::launder(reinterpret_cast<T *>(this->storage));
+}
+
+template <class T, int B>
+template <class... Args>
+void UnrolledChunk<T, B>::append(Args &&...args)
+{
+    new (this->elements() + this->count) T(std::forward<Args>(args)...);
+    this->count++;
+}
+
+template <class T, int B>
+void UnrolledChunk<T, B>::insert(int position, T &&data)
+{
+    for (int i = this->count; i > position; i--)
+    {
+        this->relocate(i, i - 1);
+    }
+    new (this->elements() + position) T(std::move(data));
+    this->count++;
+}
+
+template <class T, int B>
+void UnrolledChunk<T, B>::erase(int position)
+{
+    this->elements()[position].~T();
+    for (int i = position + 1; i < this->count; i++)
+    {
+        this->relocate(i - 1, i);
+    }
+    this->count--;
+}
+
+template <class T, int B>
+void UnrolledChunk<T, B>::moveInto(UnrolledChunk<T, B> *other, int from)
+{
+    T *elements = this->elements();
+    for (int i = from; i < this->count; i++)
+    {
+        other->append(std::move(elements[i]));
+        elements[i].~T();
+    }
+    this->count = from;
+}
+
+template <class T, int B>
+void UnrolledChunk<T, B>::clear()
+{
+    T *elements = this->elements();
+    for (int i = 0; i < this->count; i++)
+    {
+        elements[i].~T();
+    }
+    this->count = 0;
+}
+
+template <class T, int B>
+void UnrolledChunk<T, B>::prefetchNext()
+{
+    if (this->next == nullptr)
+    {
+        return;
+    }
+
+    // The first two cache lines of the next chunk: its header and first elements.
+    const char *address = (const char *)this->next;
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+    if (sizeof(UnrolledChunk<T, B>) > 64)
+    {
+        __builtin_prefetch(address + 64);
+    }
+#elif defined(_MSC_VER)
+    _mm_prefetch(address, _MM_HINT_T0);
+    if (sizeof(UnrolledChunk<T, B>) > 64)
+    {
+        _mm_prefetch(address + 64, _MM_HINT_T0);
+    }
+#endif
+}
+
+template <class T, int B>
+void UnrolledChunk<T, B>::relocate(int to, int from)
+{
+    T *elements = this->elements();
+    new (elements + to) T(std::move(elements[from]));
+    elements[from].~T();
+}
\ No newline at end of file
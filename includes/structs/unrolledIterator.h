@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include "structs/unrolledChunk.h"
+
+namespace List
+{
+    /**
+     * @brief Iterator over the elements of an unrolled linked list.
+     * Offers both the hasNext/getData/next interface of Iterator<T> and the standard library forward iterator
+     * interface. Elements of a chunk are read sequentially, and the next chunk is prefetched on entering a chunk.
+     * @tparam T The type of data stored in the list.
+     * @tparam B The number of elements per chunk.
+     * @tparam V T for a mutable iterator, const T for a const iterator.
+     */
+    template <class T, int B = unrolledCapacity<T>(), class V = T>
+    class UnrolledIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;    /**< Chunks are only walked forward */
+        using value_type = typename std::remove_const<V>::type; /**< The type of data stored in the list */
+        using difference_type = std::ptrdiff_t;                 /**< The type of the distance between two iterators */
+        using pointer = V *;                                    /**< Pointer to the data */
+        using reference = V &;                                  /**< Reference to the data */
+
+        /**
+         * @brief Constructs an iterator past the end of every list.
+         */
+        UnrolledIterator();
+
+        /**
+         * @brief Constructs an iterator positioned on an element of a chunk.
+         * @param chunk Pointer to the chunk, or nullptr for the end of the list.
+         * @param index The position of the element in the chunk.
+         */
+        UnrolledIterator(UnrolledChunk<T, B> *chunk, int index = 0);
+
+        /**
+         * @brief Constructs an iterator from a mutable one, so a mutable iterator converts to a const iterator.
+         * @param other The mutable iterator to copy the position from.
+         */
+        UnrolledIterator(const UnrolledIterator<T, B, T> &other);
+
+        /**
+         * @return true if there is a next element, false otherwise.
+         */
+        bool hasNext();
+
+        /**
+         * @return Pointer to the data of the current element, or nullptr at the end of the list.
+         */
+        pointer getData();
+
+        /**
+         * @brief The `next` method advances the iterator to the next element in the list.
+         */
+        void next();
+
+        /**
+         * @return A standard library iterator to the current element, so the rest of the list can be walked
+         * with a range-based for loop or passed to the standard algorithms.
+         */
+        UnrolledIterator<T, B, V> begin();
+
+        /**
+         * @return A standard library iterator past the last element.
+         */
+        UnrolledIterator<T, B, V> end();
+
+        /**
+         * @return Reference to the data of the current element.
+         */
+        reference operator*() const;
+
+        /**
+         * @return Pointer to the data of the current element.
+         */
+        pointer operator->() const;
+
+        /**
+         * @brief Advances the iterator to the next element.
+         * @return Reference to this iterator after advancing.
+         */
+        UnrolledIterator<T, B, V> &operator++();
+
+        /**
+         * @brief Advances the iterator to the next element.
+         * @return A copy of the iterator before advancing.
+         */
+        UnrolledIterator<T, B, V> operator++(int);
+
+        /**
+         * @param other The iterator to compare with.
+         * @return true if both iterators are on the same element, false otherwise.
+         */
+        bool operator==(const UnrolledIterator<T, B, V> &other) const;
+
+        /**
+         * @param other The iterator to compare with.
+         * @return true if the iterators are on different elements, false otherwise.
+         */
+        bool operator!=(const UnrolledIterator<T, B, V> &other) const;
+
+        /**
+         * @return The chunk the iterator is positioned in.
+         */
+        UnrolledChunk<T, B> *getChunk() const;
+
+        /**
+         * @return The position of the current element in its chunk.
+         */
+        int getIndex() const;
+
+    private:
+        UnrolledChunk<T, B> *chunk; /**< The chunk the iterator is positioned in, nullptr at the end */
+        int index;                  /**< The position of the current element in the chunk */
+    };
+}
+
+#include "structs/unrolledIterator.hpp"
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "structs/unrolledIterator.h"
+
+using namespace List;
+
+template <class T, int B, class V>
+UnrolledIterator<T, B, V>::UnrolledIterator() : chunk(nullptr), index(0){};
+
+template <class T, int B, class V>
+UnrolledIterator<T, B, V>::UnrolledIterator(UnrolledChunk<T, B> *chunk, int index) : chunk(chunk), index(index)
+{
+    if (this->chunk != nullptr)
+    {
+        this->chunk->prefetchNext();
+    }
+};
+
+template <class T, int B, class V>
+UnrolledIterator<T, B, V>::UnrolledIterator(const UnrolledIterator<T, B, T> &other)
+    : chunk(other.getChunk()),
+      index(other.getIndex()){};
+
+template <class T, int B, class V>
+bool UnrolledIterator<T, B, V>::hasNext()
+{
+    return this->index + 1 < this->chunk->count || this->chunk->next != nullptr;
+}
+
+template <class T, int B, class V>
+typename UnrolledIterator<T, B, V>::pointer UnrolledIterator<T, B, V>::getData()
+{
+    if (this->chunk == nullptr)
+    {
+        return nullptr;
+    }
+    return this->chunk->elements() + this->index;
+}
+
+template <class T, int B, class V>
+void UnrolledIterator<T, B, V>::next()
+{
+    this->index++;
+    if (this->index == this->chunk->count)
+    {
+        // Chunks are never empty, so the next chunk starts with an element.
+        this->chunk = this->chunk->next;
+        this->index = 0;
+        if (this->chunk != nullptr)
+        {
+            this->chunk->prefetchNext();
+        }
+    }
+}
+
+template <class T, int B, class V>
+UnrolledIterator<T, B, V> UnrolledIterator<T, B, V>::begin()
+{
+    return *this;
+}
+
+template <class T, int B, class V>
+UnrolledIterator<T, B, V> UnrolledIterator<T, B, V>::end()
+{
+    return UnrolledIterator<T, B, V>();
+}
+
+template <class T, int B, class V>
+typename UnrolledIterator<T, B, V>::reference UnrolledIterator<T, B, V>::operator*() const
+{
+    return this->chunk->elements()[this->index];
+}
+
+template <class T, int B, class V>
+typename UnrolledIterator<T, B, V>::pointer UnrolledIterator<T, B, V>::operator->() const
+{
+    return this->chunk->elements() + this->index;
+}
+
+template <class T, int B, class V>
+UnrolledIterator<T, B, V> &UnrolledIterator<T, B, V>::operator++()
+{
+    this->next();
+    return *this;
+}
+
+template <class T, int B, class V>
+UnrolledIterator<T, B, V> UnrolledIterator<T, B, V>::operator++(int)
+{
+    UnrolledIterator<T, B, V> previous = *this;
+    this->next();
+    return previous;
+}
+
+template <class T, int B, class V>
+bool UnrolledIterator<T, B, V>::operator==(const UnrolledIterator<T, B, V> &other) const
+{
+    return this->chunk == other.chunk && this->index == other.index;
+}
+
+template <class T, int B, class V>
+bool UnrolledIterator<T, B, V>::operator!=(const UnrolledIterator<T, B, V> &other) const
+{
+    return !(*this == other);
+}
+
+template <class T, int B, class V>
+UnrolledChunk<T, B> *UnrolledIterator<T, B, V>::getChunk() const
+{
+    return this->chunk;
+}
+
+template <class T, int B, class V>
+int UnrolledIterator<T, B, V>::getIndex() const
+{
+    return this->index;
+}
\ No newline at end of file
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "structs/unrolledChunk.h"
+#include "structs/unrolledIterator.h"
+
+namespace List
+{
+    /**
+     * @brief Template class representing an unrolled linked list: a doubly linked list of chunks,
+     * each holding up to B elements in a small array.
+     * Scans read elements sequentially like an array, indexing walks chunks rather than elements (O(n/B)),
+     * and inserting or deleting in the middle only shifts the elements of one chunk.
+     * Sequential indexing (getData(0), getData(1), ...) resumes from the last chunk found and is O(1) per call.
+     * Pointers to elements are invalidated by inserting or deleting elements before them in their chunk.
+     * @tparam T The type of data stored in the list.
+     * @tparam B The number of elements per chunk.
+     */
+    template <class T, int B = unrolledCapacity<T>()>
+    class UnrolledList
+    {
+    public:
+        using iterator = UnrolledIterator<T, B>;                /**< Standard library iterator */
+        using const_iterator = UnrolledIterator<T, B, const T>; /**< Standard library const iterator */
+
+        /**
+         * @brief Constructs an empty unrolled list.
+         */
+        UnrolledList();
+
+        /**
+         * @brief Copy constructor.
+         * @param other Another UnrolledList object to copy from.
+         */
+        UnrolledList(const UnrolledList<T, B> &other);
+
+        /**
+         * @brief Assignment operator.
+         * @param other Another UnrolledList object to assign from.
+         * @return Reference to this UnrolledList object after assignment.
+         */
+        UnrolledList<T, B> &operator=(const UnrolledList<T, B> &other);
+
+        /**
+         * @brief Move constructor. Takes over the chunks of the other list, leaving it empty.
+         * @param other Another UnrolledList object to move from.
+         */
+        UnrolledList(UnrolledList<T, B> &&other);
+
+        /**
+         * @brief Move assignment operator. Takes over the chunks of the other list, leaving it empty.
+         * @param other Another UnrolledList object to move from.
+         * @return Reference to this UnrolledList object after assignment.
+         */
+        UnrolledList<T, B> &operator=(UnrolledList<T, B> &&other);
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~UnrolledList();
+
+        /**
+         * @brief Resets the unrolled list to an empty state.
+         */
+        void reset();
+
+        /**
+         * @brief Adds a new element with the given data to the end of the unrolled list.
+         * @param data The data to be added to the unrolled list.
+         */
+        void addNode(T &data);
+
+        /**
+         * @brief Adds a new element to the end of the unrolled list, moving the given data into it.
+         * @param data The data to be moved into the unrolled list.
+         */
+        void addNode(T &&data);
+
+        /**
+         * @brief Adds a new element to the end of the unrolled list, constructing it in place.
+         * @tparam Args The types of the arguments.
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <class... Args>
+        void emplaceNode(Args &&...args);
+
+        /**
+         * @brief Inserts a new element with the given data before the specified index.
+         * @param index The index to insert at, from 0 to the size of the list.
+         * @param data The data to be added to the unrolled list.
+         */
+        void insertNode(int index, T &data);
+
+        /**
+         * @brief Inserts a new element before the specified index, moving the given data into it.
+         * @param index The index to insert at, from 0 to the size of the list.
+         * @param data The data to be moved into the unrolled list.
+         */
+        void insertNode(int index, T &&data);
+
+        /**
+         * @brief Deletes the element at the specified index in the unrolled list.
+         * @param index The index of the element to delete.
+         */
+        void deleteNode(int index);
+
+        /**
+         * @brief Deletes the first element in the unrolled list that matches the given data.
+         * @param data The data to match and delete.
+         */
+        void deleteNode(T &data);
+
+        /**
+         * @brief Checks if the unrolled list is empty.
+         * @return true if the unrolled list is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets a pointer to the data stored at the specified index in the unrolled list.
+         * @param index The index of the data to retrieve.
+         * @return Pointer to the data at the specified index.
+         */
+        T *getData(int index);
+
+        /**
+         * @brief Gets a pointer to the first data in the unrolled list that matches the given data.
+         * @param data The data to match.
+         * @return Pointer to the matching data.
+         */
+        T *getData(T &data);
+
+        /**
+         * @brief Gets the number of elements in the unrolled list.
+         * @return The size of the unrolled list.
+         */
+        int getSize();
+
+        /**
+         * @brief Returns an iterator for iterating through the unrolled list.
+         * @return An iterator for the unrolled list.
+         */
+        iterator iterate();
+
+        /**
+         * @brief Returns a standard library iterator to the first element.
+         * @return An iterator to the first element.
+         */
+        iterator begin();
+
+        /**
+         * @brief Returns a standard library iterator past the last element.
+         * @return An iterator past the last element.
+         */
+        iterator end();
+
+        /**
+         * @brief Returns a const standard library iterator to the first element.
+         * @return A const iterator to the first element.
+         */
+        const_iterator begin() const;
+
+        /**
+         * @brief Returns a const standard library iterator past the last element.
+         * @return A const iterator past the last element.
+         */
+        const_iterator end() const;
+
+        /**
+         * @brief Returns a const standard library iterator to the first element.
+         * @return A const iterator to the first element.
+         */
+        const_iterator cbegin() const;
+
+        /**
+         * @brief Returns a const standard library iterator past the last element.
+         * @return A const iterator past the last element.
+         */
+        const_iterator cend() const;
+
+    protected:
+        /**
+         * @brief Pointer to the first chunk in the unrolled list. Chunks in the list are never empty.
+         */
+        UnrolledChunk<T, B> *first;
+
+        /**
+         * @brief Pointer to the last chunk in the unrolled list.
+         */
+        UnrolledChunk<T, B> *last;
+
+        /**
+         * @brief The current size of the unrolled list.
+         */
+        int size;
+
+        /**
+         * @brief The chunk found by the last lookup by index, or nullptr.
+         */
+        UnrolledChunk<T, B> *cursor;
+
+        /**
+         * @brief The index of the first element of the cursor chunk.
+         */
+        int cursorStart;
+
+        /**
+         * @brief Finds the chunk holding the element at an index.
+         * @param index The index of the element, which must be in range. Receives the position in the chunk.
+         * @return The chunk holding the element.
+         */
+        UnrolledChunk<T, B> *locate(int &index);
+
+        /**
+         * @brief Moves data into a chunk at a position, splitting the chunk in two if it is full.
+         * @param chunk The chunk to insert into.
+         * @param position The position in the chunk, from 0 to its count.
+         * @param data The data to be moved into the list.
+         */
+        void insertInto(UnrolledChunk<T, B> *chunk, int position, T &&data);
+
+        /**
+         * @brief Deletes the element at a position of a chunk, merging the chunk with the next one when
+         * both fit in a single chunk, and unlinking it if it ends up empty.
+         * @param chunk The chunk holding the element.
+         * @param position The position of the element in the chunk.
+         */
+        void removeFrom(UnrolledChunk<T, B> *chunk, int position);
+
+        /**
+         * @brief Allocates an empty chunk and links it after another one.
+         * @param previous The chunk to link after, or nullptr to link at the front.
+         * @return Pointer to the new chunk.
+         */
+        UnrolledChunk<T, B> *createChunk(UnrolledChunk<T, B> *previous);
+
+        /**
+         * @brief Unlinks and frees an empty chunk.
+         * @param chunk The chunk to destroy.
+         */
+        void destroyChunk(UnrolledChunk<T, B> *chunk);
+
+        /**
+         * @brief Takes over the chunks of another list, leaving it empty.
+         * @param other The list to move from.
+         */
+        void moveChunks(UnrolledList<T, B> &other);
+    };
+}
+
+#include "structs/unrolledList.hpp"
\ No newline at end of file
@@ -0,0 +1,417 @@
+#include <stdexcept>
+#include <utility>
+#include "structs/unrolledList.h"
+
+using namespace List;
+
+template <class T, int B>
+UnrolledList<T, B>::UnrolledList()
+    : first(nullptr),
+      last(nullptr),
+      size(0),
+      cursor(nullptr),
+      cursorStart(0){};
+
+template <class T, int B>
+UnrolledList<T, B>::UnrolledList(const UnrolledList<T, B> &other) : UnrolledList<T, B>()
+{
+    // Appending packs the copy into full chunks.
+    for (UnrolledChunk<T, B> *chunk = other.first; chunk != nullptr; chunk = chunk->next)
+    {
+        T *elements = chunk->elements();
+        for (int i = 0; i < chunk->count; i++)
+        {
+            this->emplaceNode(elements[i]);
+        }
+    }
+};
+
+template <class T, int B>
+UnrolledList<T, B> &UnrolledList<T, B>::operator=(const UnrolledList<T, B> &other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    this->reset();
+    for (UnrolledChunk<T, B> *chunk = other.first; chunk != nullptr; chunk = chunk->next)
+    {
+        T *elements = chunk->elements();
+        for (int i = 0; i < chunk->count; i++)
+        {
+            this->emplaceNode(elements[i]);
+        }
+    }
+    return *this;
+};
+
+template <class T, int B>
+UnrolledList<T, B>::UnrolledList(UnrolledList<T, B> &&other) : UnrolledList<T, B>()
+{
+    this->moveChunks(other);
+};
+
+template <class T, int B>
+UnrolledList<T, B> &UnrolledList<T, B>::operator=(UnrolledList<T, B> &&other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    this->reset();
+    this->moveChunks(other);
+    return *this;
+};
+
+template <class T, int B>
+UnrolledList<T, B>::~UnrolledList()
+{
+    this->reset();
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::reset()
+{
+    while (this->first != nullptr)
+    {
+        UnrolledChunk<T, B> *temp = this->first;
+        this->first = this->first->next;
+        temp->clear();
+        delete temp;
+    }
+
+    this->last = nullptr;
+    this->size = 0;
+    this->cursor = nullptr;
+    this->cursorStart = 0;
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::addNode(T &data)
+{
+    this->emplaceNode(data);
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::addNode(T &&data)
+{
+    this->emplaceNode(std::move(data));
+}
+
+template <class T, int B>
+template <class... Args>
+void UnrolledList<T, B>::emplaceNode(Args &&...args)
+{
+    // Appending never moves existing elements, so the cursor stays valid.
+    UnrolledChunk<T, B> *chunk = this->last;
+    if (chunk == nullptr || chunk->count == B)
+    {
+        chunk = this->createChunk(this->last);
+    }
+
+    chunk->append(std::forward<Args>(args)...);
+    this->size++;
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::insertNode(int index, T &data)
+{
+    this->insertNode(index, T(data));
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::insertNode(int index, T &&data)
+{
+    if (index < 0 || index > this->size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    if (index == this->size)
+    {
+        this->emplaceNode(std::move(data));
+        return;
+    }
+
+    UnrolledChunk<T, B> *chunk = this->locate(index);
+    this->insertInto(chunk, index, std::move(data));
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::deleteNode(int index)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    if (index < 0 || index >= this->size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    UnrolledChunk<T, B> *chunk = this->locate(index);
+    this->removeFrom(chunk, index);
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::deleteNode(T &data)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    for (UnrolledChunk<T, B> *chunk = this->first; chunk != nullptr; chunk = chunk->next)
+    {
+        chunk->prefetchNext();
+        T *elements = chunk->elements();
+        for (int i = 0; i < chunk->count; i++)
+        {
+            if (elements[i] == data)
+            {
+                this->removeFrom(chunk, i);
+                return;
+            }
+        }
+    }
+
+    throw std::out_of_range("Node not found");
+}
+
+template <class T, int B>
+bool UnrolledList<T, B>::isEmpty()
+{
+    return this->size == 0;
+}
+
+template <class T, int B>
+T *UnrolledList<T, B>::getData(int index)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    if (index < 0 || index >= this->size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    UnrolledChunk<T, B> *chunk = this->locate(index);
+    return chunk->elements() + index;
+};
+
+template <class T, int B>
+T *UnrolledList<T, B>::getData(T &data)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    for (UnrolledChunk<T, B> *chunk = this->first; chunk != nullptr; chunk = chunk->next)
+    {
+        chunk->prefetchNext();
+        T *elements = chunk->elements();
+        for (int i = 0; i < chunk->count; i++)
+        {
+            if (elements[i] == data)
+            {
+                return elements + i;
+            }
+        }
+    }
+
+    throw std::out_of_range("Index out of range");
+};
+
+template <class T, int B>
+int UnrolledList<T, B>::getSize()
+{
+    return this->size;
+}
+
+template <class T, int B>
+typename UnrolledList<T, B>::iterator UnrolledList<T, B>::iterate()
+{
+    return iterator(this->first);
+}
+
+template <class T, int B>
+typename UnrolledList<T, B>::iterator UnrolledList<T, B>::begin()
+{
+    return iterator(this->first);
+}
+
+template <class T, int B>
+typename UnrolledList<T, B>::iterator UnrolledList<T, B>::end()
+{
+    return iterator();
+}
+
+template <class T, int B>
+typename UnrolledList<T, B>::const_iterator UnrolledList<T, B>::begin() const
+{
+    return const_iterator(this->first);
+}
+
+template <class T, int B>
+typename UnrolledList<T, B>::const_iterator UnrolledList<T, B>::end() const
+{
+    return const_iterator();
+}
+
+template <class T, int B>
+typename UnrolledList<T, B>::const_iterator UnrolledList<T, B>::cbegin() const
+{
+    return const_iterator(this->first);
+}
+
+template <class T, int B>
+typename UnrolledList<T, B>::const_iterator UnrolledList<T, B>::cend() const
+{
+    return const_iterator();
+}
+
+template <class T, int B>
+UnrolledChunk<T, B> *UnrolledList<T, B>::locate(int &index)
+{
+    // Start from the closest known chunk: the last chunk, the cursor, or the first chunk.
+    UnrolledChunk<T, B> *chunk = this->first;
+    int start = 0;
+    if (index >= this->size - this->last->count)
+    {
+        chunk = this->last;
+        start = this->size - this->last->count;
+    }
+    else if (this->cursor != nullptr && index >= this->cursorStart)
+    {
+        chunk = this->cursor;
+        start = this->cursorStart;
+    }
+
+    // Skip whole chunks, only reading their counts.
+    while (index >= start + chunk->count)
+    {
+        start += chunk->count;
+        chunk = chunk->next;
+        chunk->prefetchNext();
+    }
+
+    this->cursor = chunk;
+    this->cursorStart = start;
+    index -= start;
+    return chunk;
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::insertInto(UnrolledChunk<T, B> *chunk, int position, T &&data)
+{
+    if (chunk->count == B)
+    {
+        // Split the full chunk, moving its upper half into a new chunk after it.
+        UnrolledChunk<T, B> *half = this->createChunk(chunk);
+        chunk->moveInto(half, B / 2);
+        if (position > B / 2)
+        {
+            chunk = half;
+            position -= B / 2;
+        }
+    }
+
+    chunk->insert(position, std::move(data));
+    this->size++;
+    this->cursor = nullptr;
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::removeFrom(UnrolledChunk<T, B> *chunk, int position)
+{
+    chunk->erase(position);
+    this->size--;
+    this->cursor = nullptr;
+
+    if (chunk->count == 0)
+    {
+        this->destroyChunk(chunk);
+        return;
+    }
+
+    // Keep chunks at least half full by pulling the next chunk in when both fit in one.
+    UnrolledChunk<T, B> *next = chunk->next;
+    if (chunk->count < B / 2 && next != nullptr && chunk->count + next->count <= B)
+    {
+        next->moveInto(chunk, 0);
+        this->destroyChunk(next);
+    }
+}
+
+template <class T, int B>
+UnrolledChunk<T, B> *UnrolledList<T, B>::createChunk(UnrolledChunk<T, B> *previous)
+{
+    UnrolledChunk<T, B> *chunk = new UnrolledChunk<T, B>();
+    chunk->prev = previous;
+    chunk->next = previous == nullptr ? this->first : previous->next;
+
+    if (chunk->next != nullptr)
+    {
+        chunk->next->prev = chunk;
+    }
+    else
+    {
+        this->last = chunk;
+    }
+
+    if (previous != nullptr)
+    {
+        previous->next = chunk;
+    }
+    else
+    {
+        this->first = chunk;
+    }
+    return chunk;
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::destroyChunk(UnrolledChunk<T, B> *chunk)
+{
+    if (chunk->prev != nullptr)
+    {
+        chunk->prev->next = chunk->next;
+    }
+    else
+    {
+        this->first = chunk->next;
+    }
+
+    if (chunk->next != nullptr)
+    {
+        chunk->next->prev = chunk->prev;
+    }
+    else
+    {
+        this->last = chunk->prev;
+    }
+
+    delete chunk;
+}
+
+template <class T, int B>
+void UnrolledList<T, B>::moveChunks(UnrolledList<T, B> &other)
+{
+    this->first = other.first;
+    this->last = other.last;
+    this->size = other.size;
+    this->cursor = other.cursor;
+    this->cursorStart = other.cursorStart;
+
+    other.first = nullptr;
+    other.last = nullptr;
+    other.size = 0;
+    other.cursor = nullptr;
+    other.cursorStart = 0;
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <vector>
+#include "structs/viewIterator.h"
+#include "structs/sortKey.h"
+#include "structs/parallelSort.h"
+
+namespace List
+{
+    /**
+     * @brief Template class representing a non-owning view over elements stored in another container.
+     * Holds one pointer per element, so filling, sorting or filtering a view never copies the elements.
+     * The view is only valid while the referenced elements stay in place; containers whose nodes
+     * do not move (LinkedList<T>, SkipList<T>, ...) keep it valid until an element is deleted.
+     * @tparam T The type of data referenced by the view.
+     */
+    template <class T>
+    class View
+    {
+    public:
+        /**
+         * @brief Constructs an empty view.
+         */
+        View();
+
+        /**
+         * @brief Resets the view to an empty state. The referenced elements are untouched.
+         */
+        void reset();
+
+        /**
+         * @brief Reserves storage for at least the given number of references.
+         * @param capacity The number of references to reserve space for.
+         */
+        void reserve(int capacity);
+
+        /**
+         * @brief Makes the view reference every element of a container, in iteration order.
+         * The container must provide getSize() and iterate().
+         * @tparam C The type of the container to reference.
+         * @param container The container to reference.
+         */
+        template <class C>
+        void assign(C &container);
+
+        /**
+         * @brief Adds a reference to the given data to the end of the view.
+         * Lets a view receive the matches of searchNodes() on any list.
+         * @param data The element to reference.
+         */
+        void addNode(T &data);
+
+        /**
+         * @brief A view cannot reference a temporary.
+         */
+        void addNode(T &&data) = delete;
+
+        /**
+         * @brief Narrows the view using a custom comparison function.
+         * @tparam C The type of the comparison, a function pointer, lambda or function object.
+         * @tparam K The type of the value to compare against.
+         * @param view Another View object where references to matching elements will be added.
+         * @param compare A callable to compare T and K.
+         * @param compareValue The value to compare against K.
+         */
+        template <class C, class K>
+        void searchNodes(View<T> &view, C compare, K compareValue);
+
+        /**
+         * @brief Reorders the references using a custom comparison function. The elements do not move.
+         * @tparam C The type of the comparison, a function pointer, lambda or function object.
+         * @param compare A callable returning true if the first element goes before the second.
+         */
+        template <class C>
+        void sortNodes(C compare);
+
+        /**
+         * @brief Reorders the references using a comparison function known at compile time.
+         * If SortKey<Compare> is specialized, each element's key is computed once and the keys are sorted instead.
+         * @tparam Compare The comparison function.
+         */
+        template <auto Compare>
+        void sortNodes();
+
+        /**
+         * @brief Reorders the references using the default comparison. The elements do not move.
+         */
+        void sortNodes();
+
+        /**
+         * @brief Drops the reference at the specified index from the view.
+         * @param index The index of the reference to drop.
+         */
+        void deleteNode(int index);
+
+        /**
+         * @brief Checks if the view is empty.
+         * @return true if the view is empty, false otherwise.
+         */
+        bool isEmpty();
+
+        /**
+         * @brief Gets a pointer to the element referenced at the specified index in the view.
+         * @param index The index of the element to retrieve.
+         * @return Pointer to the element at the specified index.
+         */
+        T *getData(int index);
+
+        /**
+         * @brief Gets the number of elements referenced by the view.
+         * @return The size of the view.
+         */
+        int getSize();
+
+        /**
+         * @brief Returns an iterator for iterating through the referenced elements.
+         * @return An iterator for the view.
+         */
+        ViewIterator<T> iterate();
+
+        /**
+         * @brief Returns an iterator over a page of the referenced elements, in O(1).
+         * @param offset The index of the first element of the page.
+         * @param limit The largest number of elements in the page.
+         * @return An iterator over the elements from `offset` to `offset + limit`, clamped to the view.
+         */
+        ViewIterator<T> iterate(int offset, int limit);
+
+    protected:
+        /**
+         * @brief Pointers to the referenced elements, in view order.
+         */
+        std::vector<T *> elements;
+    };
+}
+
+#include "structs/view.hpp"
\ No newline at end of file
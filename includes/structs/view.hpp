@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "structs/view.h"
+
+using namespace List;
+
+template <class T>
+View<T>::View() : elements(){};
+
+template <class T>
+void View<T>::reset()
+{
+    this->elements.clear();
+}
+
+template <class T>
+void View<T>::reserve(int capacity)
+{
+    this->elements.reserve(capacity);
+}
+
+template <class T>
+template <class C>
+void View<T>::assign(C &container)
+{
+    this->elements.clear();
+    this->elements.reserve(container.getSize());
+
+    auto iterator = container.iterate();
+    while (iterator.getData() != nullptr)
+    {
+        this->elements.push_back(iterator.getData());
+        iterator.next();
+    }
+}
+
+template <class T>
+void View<T>::addNode(T &data)
+{
+    this->elements.push_back(&data);
+}
+
+template <class T>
+template <class C, class K>
+void View<T>::searchNodes(View<T> &view, C compare, K compareValue)
+{
+    for (T *element : this->elements)
+    {
+        if (compare(*element, compareValue))
+        {
+            view.addNode(*element);
+        }
+    }
+};
+
+template <class T>
+template <class C>
+void View<T>::sortNodes(C compare)
+{
+    // Stable, like the merge sort used by LinkedList<T>.
+    ParallelSort::stableSort(this->elements.begin(), this->elements.end(), [compare](T *a, T *b)
+                             { return compare(*a, *b); });
+};
+
+template <class T>
+template <auto Compare>
+void View<T>::sortNodes()
+{
+    if constexpr (SortKey<Compare>::enabled)
+    {
+        // Compute every key once, sort the keys along with their references, then read the references back.
+        using Key = decltype(SortKey<Compare>::key(*this->elements[0]));
+        std::vector<std::pair<Key, T *>> entries;
+        entries.reserve(this->elements.size());
+        for (T *element : this->elements)
+        {
+            entries.push_back(std::make_pair(SortKey<Compare>::key(*element), element));
+        }
+
+        ParallelSort::stableSort(entries.begin(), entries.end(), [](const std::pair<Key, T *> &a, const std::pair<Key, T *> &b)
+                                 { return a.first < b.first; });
+
+        for (int i = 0; i < (int)entries.size(); i++)
+        {
+            this->elements[i] = entries[i].second;
+        }
+    }
+    else
+    {
+        this->sortNodes([](T &a, T &b)
+                        { return Compare(a, b); });
+    }
+};
+
+template <class T>
+void View<T>::sortNodes()
+{
+    ParallelSort::stableSort(this->elements.begin(), this->elements.end(), [](T *a, T *b)
+                             { return *a < *b; });
+};
+
+template <class T>
+void View<T>::deleteNode(int index)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    if (index < 0 || index >= this->getSize())
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    this->elements.erase(this->elements.begin() + index);
+}
+
+template <class T>
+bool View<T>::isEmpty()
+{
+    return this->elements.empty();
+}
+
+template <class T>
+T *View<T>::getData(int index)
+{
+    if (this->isEmpty())
+    {
+        throw std::out_of_range("List is empty");
+    }
+
+    if (index < 0 || index >= this->getSize())
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    return this->elements[index];
+};
+
+template <class T>
+int View<T>::getSize()
+{
+    return (int)this->elements.size();
+}
+
+template <class T>
+ViewIterator<T> View<T>::iterate()
+{
+    T **first = this->elements.data();
+    return ViewIterator<T>(first, first + this->elements.size());
+}
+
+template <class T>
+ViewIterator<T> View<T>::iterate(int offset, int limit)
+{
+    int size = this->getSize();
+    int first = std::min(std::max(offset, 0), size);
+    int last = first + std::min(std::max(limit, 0), size - first);
+    return ViewIterator<T>(this->elements.data() + first, this->elements.data() + last);
+}
\ No newline at end of file
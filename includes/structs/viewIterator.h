@@ -0,0 +1,42 @@
+#pragma once
+
+namespace List
+{
+    /**
+     * @brief Iterator class for a view.
+     * Mirrors the interface of Iterator<T>, handing out the referenced elements rather than the stored pointers.
+     * @tparam T The type of data referenced by the view.
+     */
+    template <class T>
+    class ViewIterator
+    {
+    public:
+        /**
+         * @brief Constructs an iterator over the range of element pointers [first, last).
+         * @param first Pointer to the first element pointer.
+         * @param last Pointer one past the last element pointer.
+         */
+        ViewIterator(T **first, T **last);
+
+        /**
+         * @return true if there is a next element, false otherwise.
+         */
+        bool hasNext();
+
+        /**
+         * @return Pointer to the current element, or nullptr once the range is exhausted.
+         */
+        T *getData();
+
+        /**
+         * @brief The `next` method advances the iterator to the next element in the view.
+         */
+        void next();
+
+    private:
+        T **current; /**< The element pointer the iterator is positioned on */
+        T **last;    /**< One past the final element pointer of the range */
+    };
+}
+
+#include "structs/viewIterator.hpp"
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "structs/viewIterator.h"
+
+using namespace List;
+
+template <class T>
+ViewIterator<T>::ViewIterator(T **first, T **last) : current(first), last(last){};
+
+template <class T>
+bool ViewIterator<T>::hasNext()
+{
+    return this->current != this->last && this->current + 1 != this->last;
+}
+
+template <class T>
+T *ViewIterator<T>::getData()
+{
+    if (this->current == this->last)
+    {
+        return nullptr;
+    }
+    return *this->current;
+}
+
+template <class T>
+void ViewIterator<T>::next()
+{
+    this->current++;
+}
\ No newline at end of file
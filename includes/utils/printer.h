@@ -11,6 +11,11 @@ namespace Util
     class Printer
     {
     public:
+        /**
+         * @brief Number of rows shown on one page of a list.
+         */
+        static const int PAGE_SIZE = 20;
+
         /**
          * @brief Constructs a Printer with a reference to a client.
          * @param client Reference to the client.
@@ -27,6 +32,20 @@ namespace Util
          */
         void printDivider();
 
+        /**
+         * @brief Gets the number of pages a list takes.
+         * @param itemCount The number of rows of the list.
+         * @return The number of pages, at least 1.
+         */
+        static int getPageCount(int itemCount);
+
+        /**
+         * @brief Prints which page of a list is shown, if the list takes more than one page.
+         * @param page The page shown, from 0.
+         * @param itemCount The number of rows of the list.
+         */
+        void printPageFooter(int page, int itemCount);
+
         /**
          * @brief Clears the console screen.
          */
@@ -8,7 +8,7 @@
 
 using namespace HMS;
 
-Client::Client()
+Client::Client(const std::string &snapshotPath)
     : errorHandler(),
       inputHandler()
 {
@@ -23,11 +23,23 @@ Client::Client()
     errorHandler.registerErrorMessage(Manager::PatientManagerErrorPrefix, Manager::PatientManagerErrorMessage, Manager::PatientManagerErrorMessageSize);
     errorHandler.registerErrorMessage(Manager::TransactionManagerErrorPrefix, Manager::TransactionManagerErrorMessage, Manager::TransactionManagerErrorMessageSize);
     errorHandler.registerErrorMessage(Manager::ReportManagerErrorPrefix, Manager::ReportManagerErrorMessage, Manager::ReportManagerErrorMessageSize);
+
+    // Start from a snapshot when one is given
+    if (!snapshotPath.empty())
+    {
+        ErrorCode err = patientManager->loadSnapshot(snapshotPath);
+        if (err != patientManager->noErrorCode())
+        {
+            errorHandler.addError(err);
+        }
+    }
 }
 
 Client::~Client()
 {
     // Clean up dynamically allocated resources
     delete patientManager;
+    delete transactionManager;
+    delete reportManager;
     delete printer;
 }
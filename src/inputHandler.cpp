@@ -1,4 +1,5 @@
 #include <iostream>
+#include <climits>
 #include <limits>
 #include <stdexcept>
 #include <sstream>
@@ -6,66 +7,175 @@
 #include "handlers/inputHandler.h"
 #include "structs/linkedList.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HMS_DATE_SSE2
+#include <emmintrin.h>
+#endif
+
 using namespace Handler;
 
+static_assert(sizeof(Date) == sizeof(int), "A date is a packed day ordinal");
+static_assert(toOrdinal(1, 1, 1) == 1 && toOrdinal(1, 3, 2024) - toOrdinal(28, 2, 2024) == 2, "Calendar tables are consistent");
+
+Date::Date() : ordinal(0) {};
+
+Date::Date(int day, int month, int year) : ordinal(toOrdinal(day, month, year)) {};
+
+int Date::getDay()
+{
+    int day, month, year;
+    this->split(day, month, year);
+    return day;
+}
+
+int Date::getMonth()
+{
+    int day, month, year;
+    this->split(day, month, year);
+    return month;
+}
+
+int Date::getYear()
+{
+    int day, month, year;
+    this->split(day, month, year);
+    return year;
+}
+
+int Date::getOrdinal()
+{
+    return this->ordinal;
+}
+
+Date Date::fromOrdinal(int ordinal)
+{
+    Date date;
+    date.ordinal = ordinal;
+    return date;
+}
+
 bool Date::operator==(const Date &other)
 {
-    // Check if both dates have the same day, month and year
-    return (this->day == other.day) &&
-           (this->month == other.month) &&
-           (this->year == other.year);
+    return this->ordinal == other.ordinal;
 };
 bool Date::operator!=(const Date &other)
 {
-    return !(*this == other);
+    return this->ordinal != other.ordinal;
 };
 bool Date::operator<(const Date &other)
 {
-    // Compare year first, return true if this year is greater
-    if (this->year > other.year)
-    {
-        return true;
-    }
-    // If years are equal, compare month
-    if (this->year < other.year)
-    {
-        return false;
-    }
-    if (this->month > other.month)
-    {
-        return true;
-    }
-    if (this->month < other.month)
-    {
-        return false;
-    }
-    // If months are equal, compare day
-    return this->day > other.day;
+    // Later dates come first
+    return this->ordinal > other.ordinal;
 };
 bool Date::operator<=(const Date &other)
 {
-    return (*this < other) || (*this == other);
+    return this->ordinal >= other.ordinal;
 };
 bool Date::operator>(const Date &other)
 {
-    return !(*this <= other);
+    return this->ordinal < other.ordinal;
 };
 bool Date::operator>=(const Date &other)
 {
-    return !(*this < other);
+    return this->ordinal <= other.ordinal;
 };
 
+int Date::operator-(const Date &other)
+{
+    return this->ordinal - other.ordinal;
+}
+
+void Date::format(char *buffer)
+{
+    int day, month, year;
+    this->split(day, month, year);
+
+    // Format date as DD/MM/YYYY, with leading zeroes
+    buffer[0] = (char)('0' + day / 10);
+    buffer[1] = (char)('0' + day % 10);
+    buffer[2] = '/';
+    buffer[3] = (char)('0' + month / 10);
+    buffer[4] = (char)('0' + month % 10);
+    buffer[5] = '/';
+    buffer[6] = (char)('0' + year / 1000 % 10);
+    buffer[7] = (char)('0' + year / 100 % 10);
+    buffer[8] = (char)('0' + year / 10 % 10);
+    buffer[9] = (char)('0' + year % 10);
+    buffer[10] = '\0';
+}
+
 std::string Date::getFormattedDate()
 {
-    using std::to_string;
-    // Convert day, month, and year to strings
-    std::string dayStr = to_string(this->day);
-    std::string monthStr = to_string(this->month);
-    std::string yearStr = to_string(this->year);
-    // Format date as DD/MM/YYYY, adding leading zeroes if necessary
-    return (this->day < 10 ? "0" + dayStr : dayStr) + "/" + (this->month < 10 ? "0" + monthStr : monthStr) + "/" + (this->year == 0 ? "0000" : yearStr);
+    // Ten characters fit in the string's inline buffer, so this does not allocate either.
+    char buffer[11];
+    this->format(buffer);
+    return std::string(buffer, 10);
 };
 
+int Date::countInRange(const Date *dates, int count, Date first, Date last)
+{
+    // A date is in range when (date - first) <= (last - first) as unsigned numbers.
+    if (last.ordinal < first.ordinal)
+    {
+        return 0;
+    }
+
+    const int *ordinals = reinterpret_cast<const int *>(dates);
+    unsigned int width = (unsigned int)(last.ordinal - first.ordinal);
+    int matches = 0;
+    int i = 0;
+#ifdef HMS_DATE_SSE2
+    // SSE2 only compares signed numbers, so flip the sign bits to compare unsigned ones.
+    const __m128i sign = _mm_set1_epi32((int)0x80000000u);
+    const __m128i start = _mm_set1_epi32(first.ordinal);
+    const __m128i limit = _mm_xor_si128(_mm_set1_epi32((int)width), sign);
+    __m128i counts = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i offsets = _mm_xor_si128(_mm_sub_epi32(_mm_loadu_si128((const __m128i *)(ordinals + i)), start), sign);
+        // Lanes past the range are all ones (-1); adding them counts the dates outside.
+        counts = _mm_add_epi32(counts, _mm_cmpgt_epi32(offsets, limit));
+    }
+    alignas(16) int lanes[4];
+    _mm_store_si128((__m128i *)lanes, counts);
+    matches = i + lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+    for (; i < count; i++)
+    {
+        matches += (unsigned int)(ordinals[i] - first.ordinal) <= width;
+    }
+    return matches;
+}
+
+void Date::split(int &day, int &month, int &year)
+{
+    if (this->ordinal <= 0)
+    {
+        day = month = year = 0;
+        return;
+    }
+
+    // Estimate the year from the average year length, then correct it by at most one.
+    year = (int)((long long)this->ordinal * 400 / 146097) + 1;
+    while (daysBeforeYear(year) >= this->ordinal)
+    {
+        year--;
+    }
+    while (daysBeforeYear(year + 1) < this->ordinal)
+    {
+        year++;
+    }
+
+    int dayOfYear = this->ordinal - daysBeforeYear(year);
+    const int *daysBefore = DaysBeforeMonth[isLeapYear(year)];
+    month = dayOfYear / 32 + 1;
+    while (dayOfYear > daysBefore[month + 1])
+    {
+        month++;
+    }
+    day = dayOfYear - daysBefore[month];
+}
+
 const std::string Handler::InputErrorMessage[] = {
     "No error occurred",
     "The input string is too few",
@@ -153,16 +263,18 @@ ErrorCode InputHandler::getDate(Date &date)
     std::getline(std::cin, input);
 
     char delimiter;
+    int day, month, year;
     // Use stringstream to analyze the date in the format DD/MM/YYYY
     std::istringstream dateStream(input);
-    if (dateStream >> date.day >> delimiter >> date.month >> delimiter >> date.year)
+    if (dateStream >> day >> delimiter >> month >> delimiter >> year)
     {
         // Check if the analyzed date is valid
-        if (!this->isValidDate(date.day, date.month, date.year))
+        if (!this->isValidDate(day, month, year))
         {
             return getErrorCode(DATE_INVALID);
         }
 
+        date = Date(day, month, year);
         return getErrorCode(NO_INPUT_ERR);
     }
 
@@ -171,29 +283,19 @@ ErrorCode InputHandler::getDate(Date &date)
 
 bool InputHandler::isLeapYear(int year)
 {
-    // Check if the year is a leap year
-    return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+    return Handler::isLeapYear(year);
 };
 
 bool InputHandler::isValidDate(int day, int month, int year)
 {
-    // Check if the year is valid
-    if (year < 1900 || month < 1 || month > 12 || day < 1)
+    // Check if the year is valid; four digit years keep the formatted date DD/MM/YYYY
+    if (year < 1900 || year > 9999 || month < 1 || month > 12 || day < 1)
     {
         return false;
     }
 
-    // Days in each month
-    int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-
-    // Check if the month is February and the year is a leap year
-    if (month == 2 && isLeapYear(year))
-    {
-        return day <= 29;
-    }
-
     // Check if the day is within the valid range for the month
-    return day <= daysInMonth[month - 1];
+    return day <= DaysInMonth[Handler::isLeapYear(year)][month];
 };
 
 void InputHandler::pause()
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <string>
+#include <utility>
 #include "handlers/errorHandler.h"
 #include "handlers/inputHandler.h"
 #include "cores/client.h"
@@ -34,7 +36,7 @@ void generatePatients(Manager::PatientManager *pm)
     t1.setDayOfStay(1);
     t1.setPriority(1);
     p1.addTreatment(t1);
-    pm->addPatient(p1);
+    pm->addPatient(std::move(p1));
 
     HMS::Patient p2(pm->generatePatientId());
     p2.setName("Ibrahim");
@@ -49,7 +51,7 @@ void generatePatients(Manager::PatientManager *pm)
     t2.setDayOfStay(1);
     t2.setPriority(1);
     p2.addTreatment(t2);
-    pm->addPatient(p2);
+    pm->addPatient(std::move(p2));
 
     HMS::Patient p3(pm->generatePatientId());
     p3.setName("Fatimah");
@@ -66,7 +68,7 @@ void generatePatients(Manager::PatientManager *pm)
     p3.addTreatment(t3);
     d3 = {24, 1, 2024};
     p3.addDischargeDate(d3);
-    pm->addPatient(p3);
+    pm->addPatient(std::move(p3));
 
     HMS::Patient p4(pm->generatePatientId());
     p4.setName("Ali");
@@ -83,7 +85,7 @@ void generatePatients(Manager::PatientManager *pm)
     p4.addTreatment(t4);
     d4 = {4, 2, 2024};
     p4.addDischargeDate(d4);
-    pm->addPatient(p4);
+    pm->addPatient(std::move(p4));
 
     HMS::Patient p5(pm->generatePatientId());
     p5.setName("Sara");
@@ -100,7 +102,7 @@ void generatePatients(Manager::PatientManager *pm)
     p5.addTreatment(t5);
     d5 = {12, 2, 2024};
     p5.addDischargeDate(d5);
-    pm->addPatient(p5);
+    pm->addPatient(std::move(p5));
 
     HMS::Patient p6(pm->generatePatientId());
     p6.setName("Zainab");
@@ -115,7 +117,7 @@ void generatePatients(Manager::PatientManager *pm)
     t6.setDayOfStay(2);
     t6.setPriority(3);
     p6.addTreatment(t6);
-    pm->addPatient(p6);
+    pm->addPatient(std::move(p6));
 
     HMS::Patient p7(pm->generatePatientId());
     p7.setName("Hassan");
@@ -130,7 +132,7 @@ void generatePatients(Manager::PatientManager *pm)
     t7.setDayOfStay(1);
     t7.setPriority(1);
     p7.addTreatment(t7);
-    pm->addPatient(p7);
+    pm->addPatient(std::move(p7));
 
     HMS::Patient p8(pm->generatePatientId());
     p8.setName("Fatima");
@@ -147,7 +149,7 @@ void generatePatients(Manager::PatientManager *pm)
     p8.addTreatment(t8);
     d8 = {17, 3, 2024};
     p8.addDischargeDate(d8);
-    pm->addPatient(p8);
+    pm->addPatient(std::move(p8));
 
     HMS::Patient p9(pm->generatePatientId());
     p9.setName("Yusuf");
@@ -162,7 +164,7 @@ void generatePatients(Manager::PatientManager *pm)
     t9.setDayOfStay(2);
     t9.setPriority(3);
     p9.addTreatment(t9);
-    pm->addPatient(p9);
+    pm->addPatient(std::move(p9));
 
     HMS::Patient p10(pm->generatePatientId());
     p10.setName("Maryam");
@@ -177,13 +179,26 @@ void generatePatients(Manager::PatientManager *pm)
     t10.setDayOfStay(1);
     t10.setPriority(1);
     p10.addTreatment(t10);
-    pm->addPatient(p10);
+    pm->addPatient(std::move(p10));
 };
 
-int main()
+int main(int argc, char *argv[])
 {
-    HMS::Client client;
-    generatePatients(client.patientManager);
+    // `--snapshot <file>` starts from the patients saved in a snapshot instead of the sample patients
+    std::string snapshotPath;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string(argv[i]) == "--snapshot")
+        {
+            snapshotPath = argv[i + 1];
+        }
+    }
+
+    HMS::Client client(snapshotPath);
+    if (snapshotPath.empty())
+    {
+        generatePatients(client.patientManager);
+    }
 
     using Handler::InputError;
     using std::cout, std::endl;
@@ -191,15 +206,20 @@ int main()
     // Infinite loop to continuously present the main menu until the user decides to exit
     while (true)
     {
+        // Add patients admitted from other threads before showing any screen
+        client.patientManager->drainAdmissions();
+
         client.printer->printHeader();
 
         cout << "1) Manage Patients" << endl
              << "2) Manage Transaction" << endl
              << "3) Generate Reports" << endl
-             << "4) Exit" << endl;
+             << "4) Save Snapshot" << endl
+             << "5) Load Snapshot" << endl
+             << "6) Exit" << endl;
         cout << "Selection: ";
         int selection;
-        ErrorCode err = client.inputHandler.getInt(selection, 1, 4);
+        ErrorCode err = client.inputHandler.getInt(selection, 1, 6);
         if (err)
         {
             client.errorHandler.addError(err);
@@ -224,6 +244,16 @@ int main()
             client.reportManager->manageReport();
             break;
         }
+        case HMS::OptionsMainMenu::SaveSnapshot:
+        {
+            client.patientManager->promptSaveSnapshot();
+            break;
+        }
+        case HMS::OptionsMainMenu::LoadSnapshot:
+        {
+            client.patientManager->promptLoadSnapshot();
+            break;
+        }
         case HMS::OptionsMainMenu::ExitProgram:
         {
             exit(0);
@@ -1,5 +1,7 @@
+#include <climits>
 #include <iostream>
 #include <string>
+#include <utility>
 #include "cores/patient.h"
 #include "handlers/inputHandler.h"
 
@@ -21,13 +23,23 @@ const std::string HMS::TreatmentTypeLookUp[] = {
 };
 const int HMS::TreatmentTypeSize = sizeof(HMS::TreatmentTypeLookUp) / sizeof(HMS::TreatmentTypeLookUp[0]);
 
+// Node pool shared by the date lists of every patient, so admission/discharge churn reuses nodes
+// instead of going back to the heap.
+List::NodePool<Handler::Date> Patient::datePool;
+
+// Symbol of the default name, interned once.
+static Symbol unknownName()
+{
+    static const Symbol symbol = StringPool::global().intern("Unknown");
+    return symbol;
+}
+
 Patient::Patient(int id)
     : id(id),
-      name("Unknown"),
+      name(unknownName()),
       status(Admitted),
-      treatments(),
-      admissions(),
-      discharges() {};
+      admissions(&datePool),
+      discharges(&datePool) {};
 
 bool Patient::operator==(Patient &other)
 {
@@ -61,12 +73,20 @@ int Patient::getId()
 
 void Patient::setName(std::string name)
 {
-    this->name = name;
+    this->name = StringPool::global().intern(name);
 }
-std::string Patient::getName()
+const std::string &Patient::getName()
+{
+    return StringPool::global().get(this->name);
+}
+Symbol Patient::getNameSymbol()
 {
     return this->name;
 }
+void Patient::setNameSymbol(Symbol name)
+{
+    this->name = name;
+}
 bool Patient::searchName(Patient &patient, std::string name)
 {
     return name == patient.getName();
@@ -91,7 +111,7 @@ bool Patient::searchStatus(Patient &patient, HMS::PatientStatus status)
 
 void Patient::addTreatment(Treatment treatment)
 {
-    this->treatments.addNode(treatment);
+    this->treatments.addNode(std::move(treatment));
 }
 void Patient::deleteTreatment(Treatment treatment)
 {
@@ -119,7 +139,7 @@ Treatment *Patient::getLatestTreatment()
 bool Patient::searchTreatmentType(Patient &patient, std::string treatmentType)
 {
     HMS::Treatment *latestTreatment = patient.getLatestTreatment();
-    if (latestTreatment != nullptr || latestTreatment->isCompleted())
+    if (latestTreatment != nullptr)
     {
         return treatmentType == latestTreatment->getFormattedTreatmentType();
     }
@@ -181,6 +201,43 @@ bool Patient::compareTreatmentPriority(Patient &patient, Patient &otherPatient)
     return latestTreatment->getPriority() > otherLatestTreatment->getPriority();
 }
 
+// Sort keys matching the three comparisons above, so sorting computes each patient's key once
+// instead of looking up both latest treatments in every comparison.
+long long List::SortKey<&Patient::compareTreatmentAppointment>::key(Patient &patient)
+{
+    HMS::Treatment *latestTreatment = patient.getLatestTreatment();
+    if (latestTreatment == nullptr || latestTreatment->isCompleted())
+    {
+        return LLONG_MAX;
+    }
+
+    // Dates order later first, so the key is the negated day ordinal.
+    return -(long long)latestTreatment->getAppointment().getOrdinal();
+}
+
+long long List::SortKey<&Patient::compareTreatmentDayOfStay>::key(Patient &patient)
+{
+    HMS::Treatment *latestTreatment = patient.getLatestTreatment();
+    if (latestTreatment == nullptr || latestTreatment->isCompleted())
+    {
+        return LLONG_MAX;
+    }
+
+    return latestTreatment->getDayOfStay();
+}
+
+long long List::SortKey<&Patient::compareTreatmentPriority>::key(Patient &patient)
+{
+    HMS::Treatment *latestTreatment = patient.getLatestTreatment();
+    if (latestTreatment == nullptr || latestTreatment->isCompleted())
+    {
+        return LLONG_MAX;
+    }
+
+    // Higher priority first.
+    return -(long long)latestTreatment->getPriority();
+}
+
 void Patient::addAdmissionDate(Handler::Date date)
 {
     this->admissions.addNode(date);
@@ -190,7 +247,7 @@ void Patient::addDischargeDate(Handler::Date date)
     this->discharges.addNode(date);
 }
 
-Iterator<HMS::Treatment> Patient::getTreatmentIterator()
+UnrolledIterator<HMS::Treatment, HMS::TreatmentChunkSize> Patient::getTreatmentIterator()
 {
     return this->treatments.iterate();
 }
@@ -203,4 +260,9 @@ Iterator<Handler::Date> Patient::getAdmissionsIterator()
 Iterator<Handler::Date> Patient::getDischargesIterator()
 {
     return this->discharges.iterate();
+}
+
+List::NodePool<Handler::Date> &Patient::getDatePool()
+{
+    return datePool;
 }
\ No newline at end of file
@@ -1,9 +1,15 @@
+#include <algorithm>
+#include <cctype>
 #include <iomanip>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 #include "managers/patientManager.h"
 #include "cores/client.h"
 #include "cores/patient.h"
+#include "cores/patientSnapshot.h"
 #include "utils/printer.h"
-#include "structs/orderedLinkedList.h"
+#include "structs/skipList.h"
 
 using namespace Manager;
 
@@ -14,36 +20,66 @@ const std::string Manager::PatientManagerErrorMessage[] = {
     "Cannot find patient with the Id",
     "Cannot find patient with the name",
     "The patient list is empty",
-    "The treatment list is empty"};
+    "The treatment list is empty",
+    "The search query is not valid",
+    "Cannot write the snapshot file",
+    "Cannot read the snapshot file, or it is not a valid snapshot"};
+const int Manager::AdmissionQueueCapacity = 1024;
+const int Manager::QueryCacheCapacity = 64;
 const int Manager::PatientManagerErrorMessageSize = sizeof(Manager::PatientManagerErrorMessage) / sizeof(Manager::PatientManagerErrorMessage[0]);
 
 PatientManager::PatientManager(HMS::Client &client)
     : client(client),
       patientList(),
-      idIndex(0) {};
+      patientIndex(),
+      patientLookup(),
+      nameIndex(),
+      statusFilters(HMS::PatientStatusSize),
+      treatmentTypeFilters(HMS::TreatmentTypeSize),
+      sortIndex(),
+      triageQueue(),
+      admissionQueue(AdmissionQueueCapacity),
+      idIndex(0),
+      queryCache() {};
 
 void PatientManager::managePatients()
 {
     using Manager::OptionsManagePatients;
     using std::cout, std::endl;
 
-    List::LinkedList<HMS::Patient> currentPatientList = this->patientList;
+    List::View<HMS::Patient> currentPatientList;
+    currentPatientList.assign(this->patientList);
+    int page = 0;
     bool managePatientsLoop = true;
     while (managePatientsLoop)
     {
-        // Print header and current patient list
+        // Pick up patients admitted from other threads
+        if (this->drainAdmissions())
+        {
+            currentPatientList.assign(this->patientList);
+        }
+
+        // Print header and the current page of the patient list
+        int pageCount = this->client.printer->getPageCount(currentPatientList.getSize());
+        page = std::min(page, pageCount - 1);
         this->client.printer->printHeader();
-        this->printPatientList(currentPatientList);
+        this->printPatientList(currentPatientList, page);
+        this->printNextTriagePatient();
 
-        // Display menu options
+        // Display menu options, with paging when the list does not fit on one page
         cout << "1) Add Patient" << endl
              << "2) View Patient" << endl
              << "3) Search Patients" << endl
              << "4) Sort Patients" << endl
-             << "5) Exit" << endl
-             << "Selection: ";
+             << "5) Exit" << endl;
+        if (pageCount > 1)
+        {
+            cout << "6) Next Page" << endl
+                 << "7) Previous Page" << endl;
+        }
+        cout << "Selection: ";
         int selection;
-        ErrorCode err = this->client.inputHandler.getInt(selection, 1, 5);
+        ErrorCode err = this->client.inputHandler.getInt(selection, 1, pageCount > 1 ? 7 : 5);
         if (err != this->client.inputHandler.noErrorCode())
         {
             this->client.errorHandler.addError(err);
@@ -60,9 +96,10 @@ void PatientManager::managePatients()
             this->promptPatientName(newPatient);
             this->promptPatientStatus(newPatient);
 
-            this->patientList.addNode(newPatient);
+            this->addPatient(std::move(newPatient));
 
-            currentPatientList = this->patientList;
+            currentPatientList.assign(this->patientList);
+            page = 0;
 
             break;
         }
@@ -76,7 +113,7 @@ void PatientManager::managePatients()
             }
 
             this->client.printer->printHeader();
-            this->printPatientList(currentPatientList);
+            this->printPatientList(currentPatientList, page);
 
             cout << "Choose a patient by ID: ";
             int id;
@@ -97,7 +134,8 @@ void PatientManager::managePatients()
 
             this->editPatient(*patient);
 
-            currentPatientList = this->patientList;
+            currentPatientList.assign(this->patientList);
+            page = 0;
 
             break;
         }
@@ -111,11 +149,13 @@ void PatientManager::managePatients()
             }
 
             this->manageSearchPatient(currentPatientList);
+            page = 0;
             break;
         }
         case OptionsManagePatients::SortPatient:
         {
             this->manageSortPatient(currentPatientList);
+            page = 0;
             break;
         }
         case OptionsManagePatients::ExitManagePatients:
@@ -123,44 +163,73 @@ void PatientManager::managePatients()
             managePatientsLoop = false;
             break;
         }
+        case OptionsManagePatients::NextPatientPage:
+        {
+            page = std::min(page + 1, pageCount - 1);
+            break;
+        }
+        case OptionsManagePatients::PreviousPatientPage:
+        {
+            page = std::max(page - 1, 0);
+            break;
+        }
         }
     }
 };
 
-void PatientManager::manageSearchPatient(LinkedList<HMS::Patient> &patientList)
+void PatientManager::manageSearchPatient(View<HMS::Patient> &patientList)
 {
     using Manager::OptionsManageSearchPatient;
     using std::cout, std::endl;
 
     ErrorCode err = this->client.inputHandler.noErrorCode();
+    int page = 0;
+    bool turnedPage;
     do
     {
+        turnedPage = false;
+        int pageCount = this->client.printer->getPageCount(this->getPatientSize());
         this->client.printer->printHeader();
-        this->printPatientList();
+        this->printPatientList(page);
 
-        // Display search options
+        // Display search options, with paging when the list does not fit on one page
         cout << "Search patients by " << endl
              << "1) Name" << endl
              << "2) Status" << endl
              << "3) Treatment Type" << endl
-             << "Selection: ";
+             << "4) Name (ignore case)" << endl
+             << "5) Status and Treatment Type" << endl
+             << "6) Query" << endl;
+        if (pageCount > 1)
+        {
+            cout << "7) Next Page" << endl
+                 << "8) Previous Page" << endl;
+        }
+        cout << "Selection: ";
         int selection;
-        err = this->client.inputHandler.getInt(selection, 1, 3);
+        err = this->client.inputHandler.getInt(selection, 1, pageCount > 1 ? 8 : 6);
         if (err != this->client.inputHandler.noErrorCode())
         {
             this->client.errorHandler.addError(err);
             continue;
         }
+        if (selection == OptionsManageSearchPatient::NextSearchPage || selection == OptionsManageSearchPatient::PreviousSearchPage)
+        {
+            page = selection == OptionsManageSearchPatient::NextSearchPage ? std::min(page + 1, pageCount - 1) : std::max(page - 1, 0);
+            turnedPage = true;
+            continue;
+        }
 
         patientList.reset();
         this->client.printer->printHeader();
-        this->printPatientList();
+        this->printPatientList(page);
 
         switch (selection)
         {
         case OptionsManageSearchPatient::SearchByName:
+        case OptionsManageSearchPatient::SearchByNameIgnoreCase:
         {
-            cout << "Patient name to search: ";
+            cout << "Patient name to search (end with * to match a prefix): ";
             std::string name;
             err = this->client.inputHandler.getString(name);
             if (err != this->client.inputHandler.noErrorCode())
@@ -169,20 +238,19 @@ void PatientManager::manageSearchPatient(LinkedList<HMS::Patient> &patientList)
                 continue;
             }
 
-            // Search patients by name
-            this->patientList.searchNodes(patientList, HMS::Patient::searchName, name);
+            // Search patients by name, or by the start of their name
+            bool prefix = !name.empty() && name.back() == '*';
+            if (prefix)
+            {
+                name.pop_back();
+            }
+            this->searchPatientsByName(patientList, name, prefix, selection == OptionsManageSearchPatient::SearchByNameIgnoreCase);
             break;
         }
         case OptionsManageSearchPatient::SearchByStatus:
         {
-            cout << "Patient status to search: " << endl;
-            for (int i = 0; i < HMS::PatientStatusSize; i++)
-            {
-                cout << i + 1 << ") " << HMS::PatientStatusLookUp[i] << endl;
-            }
-            cout << "Selection: ";
-            int selection;
-            err = this->client.inputHandler.getInt(selection, 1, HMS::PatientStatusSize);
+            HMS::PatientStatus status;
+            err = this->promptSearchStatus(status);
             if (err != this->client.inputHandler.noErrorCode())
             {
                 this->client.errorHandler.addError(err);
@@ -190,100 +258,198 @@ void PatientManager::manageSearchPatient(LinkedList<HMS::Patient> &patientList)
             }
 
             // Search patients by status
-            this->patientList.searchNodes(patientList, HMS::Patient::searchStatus, HMS::PatientStatus(selection - 1));
+            this->collectPatients(patientList, this->getStatusFilter(status));
             break;
         }
         case OptionsManageSearchPatient::SearchByTreatmentType:
+        case OptionsManageSearchPatient::SearchByStatusAndTreatmentType:
         {
-            cout << "Patient treatment type to search: " << endl;
-            for (int i = 0; i < HMS::TreatmentTypeSize; i++)
+            HMS::PatientStatus status;
+            if (selection == OptionsManageSearchPatient::SearchByStatusAndTreatmentType)
             {
-                cout << i + 1 << ") " << HMS::TreatmentTypeLookUp[i] << endl;
+                err = this->promptSearchStatus(status);
+                if (err != this->client.inputHandler.noErrorCode())
+                {
+                    this->client.errorHandler.addError(err);
+                    continue;
+                }
             }
-            cout << "Selection: ";
-            int selection;
-            err = this->client.inputHandler.getInt(selection, 1, HMS::TreatmentTypeSize);
+
+            HMS::TreatmentType treatmentType;
+            std::string formattedTreatmentType;
+            err = this->promptSearchTreatmentType(treatmentType, formattedTreatmentType);
             if (err != this->client.inputHandler.noErrorCode())
             {
                 this->client.errorHandler.addError(err);
                 continue;
             }
 
-            HMS::TreatmentType treatmentType = HMS::TreatmentType(selection - 1);
-            // In order to cover both preset treatment type and other treatment type,
-            // we need to convert preset type to string
-            std::string formattedTreatmentType = "";
+            // Search patients by treatment type, intersected with the status if one was chosen
+            View<HMS::Patient> matches;
+            if (selection == OptionsManageSearchPatient::SearchByStatusAndTreatmentType)
+            {
+                RoaringBitmap filter = this->getStatusFilter(status).intersect(this->getTreatmentTypeFilter(treatmentType));
+                this->collectPatients(matches, filter);
+            }
+            else
+            {
+                this->collectPatients(matches, this->getTreatmentTypeFilter(treatmentType));
+            }
+
+            // Other treatment types share one filter, so tell them apart by name
             if (treatmentType == HMS::TreatmentType::Other)
             {
-                cout << "Other treatment type: ";
-                err = this->client.inputHandler.getString(formattedTreatmentType);
-                if (err != this->client.inputHandler.noErrorCode())
-                {
-                    this->client.errorHandler.addError(err);
-                    continue;
-                }
+                matches.searchNodes(patientList, HMS::Patient::searchTreatmentType, formattedTreatmentType);
             }
             else
             {
-                formattedTreatmentType = HMS::TreatmentTypeLookUp[treatmentType];
+                patientList = std::move(matches);
+            }
+            break;
+        }
+        case OptionsManageSearchPatient::SearchByQuery:
+        {
+            cout << "Criteria: name=, name~ (ignore case), status=, type=, priority=, appointment=, stay=" << endl
+                 << "Combine with and, or, not and parentheses, e.g. status=admitted and (priority=2..3 or name=Al*)" << endl
+                 << "Query: ";
+            std::string text;
+            err = this->client.inputHandler.getString(text);
+            if (err != this->client.inputHandler.noErrorCode())
+            {
+                this->client.errorHandler.addError(err);
+                continue;
+            }
+
+            HMS::PatientQuery *query;
+            ErrorCode pmErr = this->getQuery(text, query);
+            if (pmErr != getErrorCode(NO_PATIENT_MANAGER_ERR))
+            {
+                err = pmErr;
+                this->client.errorHandler.addError(err);
+                continue;
             }
 
-            // Search patients by treatment type
-            this->patientList.searchNodes(patientList, HMS::Patient::searchTreatmentType, formattedTreatmentType);
+            // Matches go straight into the view
+            this->queryPatients(*query, [&](HMS::Patient &patient)
+                                { patientList.addNode(patient); });
             break;
         }
         }
 
-    } while (err);
+    } while (err || turnedPage);
+}
+
+ErrorCode PatientManager::promptSearchStatus(HMS::PatientStatus &status)
+{
+    using std::cout, std::endl;
+
+    cout << "Patient status to search: " << endl;
+    for (int i = 0; i < HMS::PatientStatusSize; i++)
+    {
+        cout << i + 1 << ") " << HMS::PatientStatusLookUp[i] << endl;
+    }
+    cout << "Selection: ";
+    int selection;
+    ErrorCode err = this->client.inputHandler.getInt(selection, 1, HMS::PatientStatusSize);
+    if (err != this->client.inputHandler.noErrorCode())
+    {
+        return err;
+    }
+
+    status = HMS::PatientStatus(selection - 1);
+    return err;
+}
+
+ErrorCode PatientManager::promptSearchTreatmentType(HMS::TreatmentType &treatmentType, std::string &formattedTreatmentType)
+{
+    using std::cout, std::endl;
+
+    cout << "Patient treatment type to search: " << endl;
+    for (int i = 0; i < HMS::TreatmentTypeSize; i++)
+    {
+        cout << i + 1 << ") " << HMS::TreatmentTypeLookUp[i] << endl;
+    }
+    cout << "Selection: ";
+    int selection;
+    ErrorCode err = this->client.inputHandler.getInt(selection, 1, HMS::TreatmentTypeSize);
+    if (err != this->client.inputHandler.noErrorCode())
+    {
+        return err;
+    }
+
+    treatmentType = HMS::TreatmentType(selection - 1);
+    // In order to cover both preset treatment type and other treatment type,
+    // we need to convert preset type to string
+    formattedTreatmentType = "";
+    if (treatmentType == HMS::TreatmentType::Other)
+    {
+        cout << "Other treatment type: ";
+        return this->client.inputHandler.getString(formattedTreatmentType);
+    }
+
+    formattedTreatmentType = HMS::TreatmentTypeLookUp[treatmentType];
+    return err;
 }
 
-void PatientManager::manageSortPatient(LinkedList<HMS::Patient> &patientList)
+void PatientManager::manageSortPatient(View<HMS::Patient> &patientList)
 {
     using Manager::OptionManageSortPatient;
     using std::cout, std::endl;
 
     ErrorCode err = this->client.inputHandler.noErrorCode();
+    int page = 0;
+    bool turnedPage;
     do
     {
+        turnedPage = false;
+        int pageCount = this->client.printer->getPageCount(patientList.getSize());
         this->client.printer->printHeader();
-        this->printPatientList(patientList);
+        this->printPatientList(patientList, page);
 
-        // Display sort options
+        // Display sort options, with paging when the list does not fit on one page
         cout << "Sort patients by " << endl
              << "1) Appointment Dates" << endl
              << "2) Length of Stay" << endl
-             << "3) Priority" << endl
-             << "Selection: ";
+             << "3) Priority" << endl;
+        if (pageCount > 1)
+        {
+            cout << "4) Next Page" << endl
+                 << "5) Previous Page" << endl;
+        }
+        cout << "Selection: ";
         int selection;
-        err = this->client.inputHandler.getInt(selection, 1, 3);
+        err = this->client.inputHandler.getInt(selection, 1, pageCount > 1 ? 5 : 3);
         if (err != this->client.inputHandler.noErrorCode())
         {
             this->client.errorHandler.addError(err);
             continue;
         }
-
-        this->client.printer->printHeader();
-        this->printPatientList();
+        if (selection == OptionManageSortPatient::NextSortPage || selection == OptionManageSortPatient::PreviousSortPage)
+        {
+            page = selection == OptionManageSortPatient::NextSortPage ? std::min(page + 1, pageCount - 1) : std::max(page - 1, 0);
+            turnedPage = true;
+            continue;
+        }
 
         switch (selection)
         {
         case OptionManageSortPatient::SortByAppointment:
         {
-            patientList.sortNodes(HMS::Patient::compareTreatmentAppointment);
+            this->sortPatients(patientList, HMS::PatientOrder::OrderByAppointment);
             break;
         }
         case OptionManageSortPatient::SortByLengthOfStay:
         {
-            patientList.sortNodes(HMS::Patient::compareTreatmentDayOfStay);
+            this->sortPatients(patientList, HMS::PatientOrder::OrderByDayOfStay);
             break;
         }
         case OptionManageSortPatient::SortByPriority:
         {
-            patientList.sortNodes(HMS::Patient::compareTreatmentPriority);
+            this->sortPatients(patientList, HMS::PatientOrder::OrderByPriority);
             break;
         }
         }
-    } while (err);
+    } while (err || turnedPage);
 }
 
 void PatientManager::editPatient(HMS::Patient &patient)
@@ -316,12 +482,15 @@ void PatientManager::editPatient(HMS::Patient &patient)
         {
         case OptionsEditPatient::EditName:
         {
+            this->nameIndex.remove(nameKey(patient.getName()), &patient);
             this->promptPatientName(patient);
+            this->nameIndex.insert(nameKey(patient.getName()), &patient);
             break;
         }
         case OptionsEditPatient::EditStatus:
         {
             this->promptPatientStatus(patient);
+            this->refreshPatient(patient);
             break;
         }
         case OptionsEditPatient::EditTreatment:
@@ -331,6 +500,12 @@ void PatientManager::editPatient(HMS::Patient &patient)
         }
         case OptionsEditPatient::DeletePatient:
         {
+            this->triageQueue.remove(patient.getId());
+            this->patientIndex.remove(patient.getId());
+            this->patientLookup.remove(patient.getId());
+            this->nameIndex.remove(nameKey(patient.getName()), &patient);
+            this->clearFilters(patient.getId());
+            this->sortIndex.remove(patient.getId());
             this->patientList.deleteNode(patient);
         }
         case OptionsEditPatient::ExitEditPatient:
@@ -371,6 +546,7 @@ void PatientManager::manageTreatments(HMS::Patient &patient)
         case OptionsManageTreatment::AddTreatment:
         {
             this->promptPatientTreatment(patient);
+            this->refreshPatient(patient);
             break;
         }
         case OptionsManageTreatment::ViewTreatment:
@@ -438,26 +614,31 @@ void PatientManager::editTreatment(HMS::Treatment &treatment, HMS::Patient &pati
         case OptionsEditTreatment::EditTreatmentType:
         {
             this->promptTreatmentType(treatment);
+            this->refreshPatient(patient);
             break;
         }
         case OptionsEditTreatment::EditAppointment:
         {
             this->promptTreatmentAppointment(treatment);
+            this->refreshPatient(patient);
             break;
         }
         case OptionsEditTreatment::EditDayOfStay:
         {
             this->promptTreatmentDayOfStay(treatment);
+            this->refreshPatient(patient);
             break;
         }
         case OptionsEditTreatment::EditPriority:
         {
             this->promptTreatmentPriority(treatment);
+            this->refreshPatient(patient);
             break;
         }
         case OptionsEditTreatment::DeleteTreatment:
         {
             patient.deleteTreatment(treatment);
+            this->refreshPatient(patient);
         }
         case OptionsEditTreatment::ExitEditTreatment:
         {
@@ -468,14 +649,35 @@ void PatientManager::editTreatment(HMS::Treatment &treatment, HMS::Patient &pati
     }
 };
 
-void PatientManager::printPatientList()
+void PatientManager::printPatientList(int page)
 {
-    this->printPatientList(this->patientList);
+    using std::cout, std::endl;
+
+    cout << "Patient List:" << endl;
+    if (this->patientList.isEmpty())
+    {
+        cout << " - Patient list is empty - " << endl;
+    }
+    else
+    {
+        this->printPatientListHeader();
+        Iterator<HMS::Patient> iterator = this->patientList.iterate();
+        for (int i = 0; i < (page + 1) * Util::Printer::PAGE_SIZE && iterator.getData() != nullptr; i++)
+        {
+            if (i >= page * Util::Printer::PAGE_SIZE)
+            {
+                this->printPatientRow(*iterator.getData());
+            }
+            iterator.next();
+        }
+        this->client.printer->printPageFooter(page, this->patientList.getSize());
+    }
+    this->client.printer->printDivider();
 };
 
-void PatientManager::printPatientList(LinkedList<HMS::Patient> patientList)
+void PatientManager::printPatientList(View<HMS::Patient> &patientList, int page)
 {
-    using std::cout, std::endl, std::setw, std::left;
+    using std::cout, std::endl;
 
     cout << "Patient List:" << endl;
     if (patientList.isEmpty())
@@ -484,48 +686,77 @@ void PatientManager::printPatientList(LinkedList<HMS::Patient> patientList)
     }
     else
     {
-        cout << setw(5) << left << "|ID"
-             << setw(20) << left << "|Name"
-             << setw(12) << left << "|Status"
-             << setw(18) << left << "|Ongoing Treatment"
-             << setw(12) << left << "|Appointment"
-             << setw(15) << left << "|Length Of Stay"
-             << setw(9) << left << "|Priority|"
-             << endl;
-        Iterator<HMS::Patient> iterator = patientList.iterate();
+        this->printPatientListHeader();
+        ViewIterator<HMS::Patient> iterator = patientList.iterate(page * Util::Printer::PAGE_SIZE, Util::Printer::PAGE_SIZE);
         while (iterator.getData() != nullptr)
         {
-            HMS::Patient *patient = iterator.getData();
-            HMS::Treatment *latestTreatment = patient->getLatestTreatment();
-            cout << "|" << setw(4) << patient->getId() << "|"
-                 << setw(19) << patient->getName().substr(0, 19) << "|"
-                 << setw(11) << HMS::PatientStatusLookUp[patient->getStatus()] << "|";
-
-            if (latestTreatment == nullptr || latestTreatment->isCompleted())
-            {
-                cout << setw(17) << "None" << "|"
-                     << setw(11) << "" << "|"
-                     << setw(14) << "" << "|"
-                     << setw(8) << "" << "|"
-                     << endl;
-            }
-            else
-            {
-                cout << setw(17) << latestTreatment->getFormattedTreatmentType() << "|"
-                     << setw(11) << latestTreatment->getAppointment().getFormattedDate() << "|"
-                     << setw(14) << latestTreatment->getDayOfStay() << "|"
-                     << setw(8) << latestTreatment->getPriority() << "|"
-                     << endl;
-            }
-
+            this->printPatientRow(*iterator.getData());
             iterator.next();
         }
+        this->client.printer->printPageFooter(page, patientList.getSize());
+    }
+    this->client.printer->printDivider();
+};
+
+void PatientManager::printNextTriagePatient()
+{
+    using std::cout, std::endl;
+
+    HMS::Patient *patient = this->getNextTriagePatient();
+    if (patient == nullptr)
+    {
+        return;
     }
+
+    cout << "Next Patient by Priority: " << patient->getName()
+         << " (ID " << patient->getId()
+         << ", Priority " << patient->getLatestTreatment()->getPriority() << ")" << endl;
     this->client.printer->printDivider();
+}
+
+void PatientManager::printPatientListHeader()
+{
+    using std::cout, std::endl, std::setw, std::left;
+
+    cout << setw(5) << left << "|ID"
+         << setw(20) << left << "|Name"
+         << setw(12) << left << "|Status"
+         << setw(18) << left << "|Ongoing Treatment"
+         << setw(12) << left << "|Appointment"
+         << setw(15) << left << "|Length Of Stay"
+         << setw(9) << left << "|Priority|"
+         << endl;
+};
+
+void PatientManager::printPatientRow(HMS::Patient &patient)
+{
+    using std::cout, std::endl, std::setw;
+
+    HMS::Treatment *latestTreatment = patient.getLatestTreatment();
+    cout << "|" << setw(4) << patient.getId() << "|"
+         << setw(19) << patient.getName().substr(0, 19) << "|"
+         << setw(11) << HMS::PatientStatusLookUp[patient.getStatus()] << "|";
+
+    if (latestTreatment == nullptr || latestTreatment->isCompleted())
+    {
+        cout << setw(17) << "None" << "|"
+             << setw(11) << "" << "|"
+             << setw(14) << "" << "|"
+             << setw(8) << "" << "|"
+             << endl;
+    }
+    else
+    {
+        cout << setw(17) << latestTreatment->getFormattedTreatmentType() << "|"
+             << setw(11) << latestTreatment->getAppointment().getFormattedDate() << "|"
+             << setw(14) << latestTreatment->getDayOfStay() << "|"
+             << setw(8) << latestTreatment->getPriority() << "|"
+             << endl;
+    }
 };
 
 // This function would only print the latest treatment
-void PatientManager::printPatientDetails(HMS::Patient patient)
+void PatientManager::printPatientDetails(HMS::Patient &patient)
 {
     using std::cout, std::endl;
 
@@ -553,7 +784,7 @@ void PatientManager::printPatientDetails(HMS::Patient patient)
 };
 
 // Overload so this function will print whatever treatment that is passed in
-void PatientManager::printPatientDetails(HMS::Patient patient, HMS::Treatment latestTreatment)
+void PatientManager::printPatientDetails(HMS::Patient &patient, HMS::Treatment &latestTreatment)
 {
     using std::cout, std::endl;
 
@@ -571,7 +802,7 @@ void PatientManager::printPatientDetails(HMS::Patient patient, HMS::Treatment la
     this->client.printer->printDivider();
 };
 
-void PatientManager::printTreatmentList(HMS::Patient patient)
+void PatientManager::printTreatmentList(HMS::Patient &patient)
 {
     using std::cout, std::endl, std::setw, std::left;
 
@@ -589,18 +820,15 @@ void PatientManager::printTreatmentList(HMS::Patient patient)
              << setw(10) << left << "|Priority"
              << endl;
 
-        Iterator<HMS::Treatment> iterator = patient.getTreatmentIterator();
         int index = 0;
-        while (iterator.getData() != nullptr)
+        for (HMS::Treatment &treatment : patient.getTreatmentIterator())
         {
-            HMS::Treatment *treatment = iterator.getData();
             cout << "|" << setw(5) << ++index << "|"
-                 << setw(19) << treatment->getFormattedTreatmentType() << "|"
-                 << setw(12) << treatment->getAppointment().getFormattedDate() << "|"
-                 << setw(12) << treatment->getDayOfStay() << "|"
-                 << setw(9) << treatment->getPriority()
+                 << setw(19) << treatment.getFormattedTreatmentType() << "|"
+                 << setw(12) << treatment.getAppointment().getFormattedDate() << "|"
+                 << setw(12) << treatment.getDayOfStay() << "|"
+                 << setw(9) << treatment.getPriority()
                  << endl;
-            iterator.next();
         }
     }
     this->client.printer->printDivider();
@@ -619,6 +847,210 @@ void PatientManager::printTreatmentDetails(HMS::Treatment treatment)
     this->client.printer->printDivider();
 }
 
+void PatientManager::promptSaveSnapshot()
+{
+    using std::cout, std::endl;
+
+    this->client.printer->printHeader();
+    cout << "Snapshot File: ";
+    std::string path;
+    ErrorCode err = this->client.inputHandler.getString(path);
+    if (err != this->client.inputHandler.noErrorCode())
+    {
+        this->client.errorHandler.addError(err);
+        return;
+    }
+
+    err = this->saveSnapshot(path);
+    if (err != this->noErrorCode())
+    {
+        this->client.errorHandler.addError(err);
+        return;
+    }
+
+    cout << "Saved " << this->getPatientSize() << " patients to " << path << endl;
+    this->client.printer->printDivider();
+    cout << "Press 'Enter' to continue..." << endl;
+    this->client.printer->printDivider();
+    this->client.inputHandler.pause();
+}
+
+void PatientManager::promptLoadSnapshot()
+{
+    using std::cout, std::endl;
+
+    this->client.printer->printHeader();
+    cout << "Snapshot File: ";
+    std::string path;
+    ErrorCode err = this->client.inputHandler.getString(path);
+    if (err != this->client.inputHandler.noErrorCode())
+    {
+        this->client.errorHandler.addError(err);
+        return;
+    }
+
+    err = this->loadSnapshot(path);
+    if (err != this->noErrorCode())
+    {
+        this->client.errorHandler.addError(err);
+        return;
+    }
+
+    cout << "Loaded " << this->getPatientSize() << " patients from " << path << endl;
+    this->client.printer->printDivider();
+    cout << "Press 'Enter' to continue..." << endl;
+    this->client.printer->printDivider();
+    this->client.inputHandler.pause();
+}
+
+ErrorCode PatientManager::saveSnapshot(const std::string &path)
+{
+    HMS::PatientSnapshotWriter writer;
+    for (HMS::Patient &patient : this->patientList)
+    {
+        writer.addPatient(patient);
+    }
+
+    if (!writer.save(path, this->idIndex))
+    {
+        return getErrorCode(SNAPSHOT_NOT_SAVED);
+    }
+    return getErrorCode(NO_PATIENT_MANAGER_ERR);
+}
+
+ErrorCode PatientManager::loadSnapshot(const std::string &path)
+{
+    HMS::PatientSnapshot snapshot;
+    if (!snapshot.open(path))
+    {
+        return getErrorCode(SNAPSHOT_NOT_LOADED);
+    }
+
+    // Intern each distinct string once, before anything is cleared.
+    const HMS::SnapshotHeader &header = snapshot.getHeader();
+    std::vector<List::Symbol> symbols(header.stringCount);
+    try
+    {
+        for (uint32_t i = 0; i < header.stringCount; i++)
+        {
+            symbols[i] = List::StringPool::global().intern(snapshot.getString(i));
+        }
+    }
+    catch (const std::out_of_range &)
+    {
+        return getErrorCode(SNAPSHOT_NOT_LOADED);
+    }
+
+    // Raise the ID counter first, so an ID generated on another thread from now on is new to both sets of patients.
+    int current = this->idIndex;
+    while (current < header.idIndex && !this->idIndex.compare_exchange_weak(current, header.idIndex))
+    {
+    }
+
+    // Admissions queued before the load are replaced with the rest of the patients, rather than added on top of
+    // the snapshot where their IDs may already be taken.
+    this->drainAdmissions();
+    this->clearPatients();
+
+    // The records are in ID order, so the patients are appended without searching the list. Lists put new data
+    // before the elements it equals, so treatments and dates are added back to front to keep the order of ties.
+    const HMS::SnapshotPatient *records = snapshot.getPatients();
+    const HMS::SnapshotTreatment *treatments = snapshot.getTreatments();
+    const int32_t *dates = snapshot.getDates();
+    int count = (int)header.patientCount;
+    auto makePatient = [&](int index)
+    {
+        const HMS::SnapshotPatient &record = records[index];
+        HMS::Patient patient(record.id);
+        patient.setNameSymbol(symbols[record.name]);
+        patient.setStatus((HMS::PatientStatus)record.status);
+        for (uint32_t i = record.treatmentCount; i-- > 0;)
+        {
+            const HMS::SnapshotTreatment &treatmentRecord = treatments[record.firstTreatment + i];
+            HMS::Treatment treatment;
+            treatment.setTreatmentType((HMS::TreatmentType)treatmentRecord.type);
+            treatment.setOtherTreatmentTypeSymbol(symbols[treatmentRecord.otherType]);
+            treatment.setAppointment(Handler::Date::fromOrdinal(treatmentRecord.appointment));
+            treatment.setDayOfStay(treatmentRecord.dayOfStay);
+            treatment.setPriority(treatmentRecord.priority);
+            if (treatmentRecord.completed)
+            {
+                treatment.setCompleted();
+            }
+            patient.addTreatment(std::move(treatment));
+        }
+        const int32_t *admissions = dates + record.firstDate;
+        for (uint32_t i = record.admissionCount; i-- > 0;)
+        {
+            patient.addAdmissionDate(Handler::Date::fromOrdinal(admissions[i]));
+        }
+        const int32_t *discharges = admissions + record.admissionCount;
+        for (uint32_t i = record.dischargeCount; i-- > 0;)
+        {
+            patient.addDischargeDate(Handler::Date::fromOrdinal(discharges[i]));
+        }
+        return patient;
+    };
+
+    // Index each patient as soon as it is stored, while it is still in cache. The ordered indexes and the
+    // triage queue are built afterwards, from arrays, rather than one patient at a time.
+    std::vector<int> ids(count);
+    std::vector<HMS::Patient *> stored(count);
+    std::vector<int> triageIds;
+    std::vector<int> triagePriorities;
+    auto indexPatient = [&](HMS::Patient &patient, int index)
+    {
+        ids[index] = patient.getId();
+        stored[index] = &patient;
+        this->statusFilters[patient.getStatus()].add(patient.getId());
+        HMS::Treatment *latestTreatment = patient.getLatestTreatment();
+        if (latestTreatment != nullptr)
+        {
+            this->treatmentTypeFilters[latestTreatment->getTreatmentType()].add(patient.getId());
+        }
+        HMS::Treatment *triageTreatment = this->getTriageTreatment(patient);
+        if (triageTreatment != nullptr)
+        {
+            triageIds.push_back(patient.getId());
+            triagePriorities.push_back(triageTreatment->getPriority());
+        }
+    };
+    this->patientList.appendNodes(count, makePatient, indexPatient);
+
+    this->patientIndex.bulkLoad(ids.data(), stored.data(), count);
+    this->patientLookup.insert(ids.data(), stored.data(), count);
+    this->sortIndex.bulkLoad(stored.data(), count);
+    this->triageQueue.bulkLoad(triageIds.data(), triagePriorities.data(), (int)triageIds.size());
+
+    // Patients sharing a name are grouped with a counting sort on the name's string, keeping ID order, so the
+    // trie is walked once per distinct name instead of once per patient.
+    std::vector<int> nameStarts(header.stringCount + 1);
+    for (int i = 0; i < count; i++)
+    {
+        nameStarts[records[i].name + 1]++;
+    }
+    for (uint32_t name = 0; name < header.stringCount; name++)
+    {
+        nameStarts[name + 1] += nameStarts[name];
+    }
+    std::vector<int> nameEnds(nameStarts.begin(), nameStarts.end() - 1);
+    std::vector<HMS::Patient *> byName(count);
+    for (int i = 0; i < count; i++)
+    {
+        byName[nameEnds[records[i].name]++] = stored[i];
+    }
+    for (uint32_t name = 0; name < header.stringCount; name++)
+    {
+        int start = nameStarts[name];
+        if (nameEnds[name] > start)
+        {
+            this->nameIndex.insert(nameKey(byName[start]->getName()), &byName[start], nameEnds[name] - start);
+        }
+    }
+
+    return getErrorCode(NO_PATIENT_MANAGER_ERR);
+}
+
 int PatientManager::getIdIndex()
 {
     return this->idIndex;
@@ -627,6 +1059,39 @@ int PatientManager::getIdIndex()
 void PatientManager::addPatient(HMS::Patient &patient)
 {
     this->patientList.addNode(patient);
+
+    // Index the copy stored in the list, skip list nodes never move.
+    HMS::Patient *stored = this->patientList.getData(patient);
+    this->patientIndex.insert(patient.getId(), stored);
+    this->patientLookup.insert(patient.getId(), stored);
+    this->nameIndex.insert(nameKey(stored->getName()), stored);
+    this->refreshPatient(*stored);
+}
+
+void PatientManager::addPatient(HMS::Patient &&patient)
+{
+    int id = patient.getId();
+    this->patientList.addNode(std::move(patient));
+
+    // The moved-from patient no longer holds the record, so look the stored one up by its id.
+    HMS::Patient key(id);
+    HMS::Patient *stored = this->patientList.getData(key);
+    this->patientIndex.insert(id, stored);
+    this->patientLookup.insert(id, stored);
+    this->nameIndex.insert(nameKey(stored->getName()), stored);
+    this->refreshPatient(*stored);
+}
+
+bool PatientManager::submitAdmission(HMS::Patient &&patient)
+{
+    return this->admissionQueue.tryEnqueue(std::move(patient));
+}
+
+int PatientManager::drainAdmissions(int maxCount)
+{
+    return this->admissionQueue.drain([this](HMS::Patient &&patient)
+                                      { this->addPatient(std::move(patient)); },
+                                      maxCount);
 }
 
 int PatientManager::getPatientSize()
@@ -640,24 +1105,20 @@ HMS::Patient *PatientManager::getPatient(int index)
 };
 HMS::Patient *PatientManager::getPatient(HMS::Patient patient)
 {
-    return this->patientList.getData(patient);
+    HMS::Patient **found = this->patientLookup.find(patient.getId());
+    return found == nullptr ? nullptr : *found;
 };
 
 ErrorCode PatientManager::getPatientById(HMS::Patient *&patient, int id)
 {
-    Iterator<HMS::Patient> iterator = this->patientList.iterate();
-    while (iterator.getData() != nullptr)
+    HMS::Patient **found = this->patientLookup.find(id);
+    if (found == nullptr)
     {
-        HMS::Patient *currentPatient = iterator.getData();
-        if (currentPatient->getId() == id)
-        {
-            patient = currentPatient;
-            return getErrorCode(NO_PATIENT_MANAGER_ERR);
-        }
-        iterator.next();
+        return getErrorCode(PATIENT_ID_NOT_FOUND);
     }
 
-    return getErrorCode(PATIENT_ID_NOT_FOUND);
+    patient = *found;
+    return getErrorCode(NO_PATIENT_MANAGER_ERR);
 }
 
 Iterator<HMS::Patient> PatientManager::getPatientListIterator()
@@ -665,6 +1126,241 @@ Iterator<HMS::Patient> PatientManager::getPatientListIterator()
     return this->patientList.iterate();
 }
 
+BPlusTreeIterator<int, HMS::Patient *> PatientManager::getPatientRangeIterator(int firstId, int lastId)
+{
+    return this->patientIndex.iterate(firstId, lastId);
+}
+
+ErrorCode PatientManager::getQuery(const std::string &text, HMS::PatientQuery *&query)
+{
+    query = this->queryCache.find(text);
+    if (query != nullptr)
+    {
+        return getErrorCode(NO_PATIENT_MANAGER_ERR);
+    }
+
+    HMS::PatientQuery parsed;
+    if (!HMS::PatientQuery::parse(text, parsed))
+    {
+        return getErrorCode(INVALID_QUERY);
+    }
+    parsed.compile();
+
+    // Queries are typed in by hand, so a full cache is simply emptied.
+    if (this->queryCache.getSize() >= QueryCacheCapacity)
+    {
+        this->queryCache.reset();
+    }
+    this->queryCache.insert(text, std::move(parsed));
+    query = this->queryCache.find(text);
+    return getErrorCode(NO_PATIENT_MANAGER_ERR);
+}
+
+int PatientManager::searchPatientsByName(View<HMS::Patient> &patients, std::string name, bool prefix, bool ignoreCase)
+{
+    // The index is case insensitive; a case sensitive search filters its matches, comparing interned
+    // symbols for whole names.
+    List::Symbol symbol = List::StringPool::EMPTY;
+    bool interned = List::StringPool::global().find(name, symbol);
+    int count = 0;
+    auto collect = [&](HMS::Patient *patient)
+    {
+        bool matches = prefix ? patient->getName().compare(0, name.size(), name) == 0
+                              : interned && patient->getNameSymbol() == symbol;
+        if (ignoreCase || matches)
+        {
+            patients.addNode(*patient);
+            count++;
+        }
+    };
+
+    if (prefix)
+    {
+        this->nameIndex.findPrefix(nameKey(name), collect);
+    }
+    else
+    {
+        this->nameIndex.find(nameKey(name), collect);
+    }
+
+    // The index gives name order, lists are shown in ID order.
+    patients.sortNodes();
+    return count;
+}
+
+std::string PatientManager::nameKey(std::string name)
+{
+    for (char &character : name)
+    {
+        character = (char)std::tolower((unsigned char)character);
+    }
+    return name;
+}
+
+void PatientManager::refreshPatient(HMS::Patient &patient)
+{
+    this->updateTriage(patient);
+    this->updateFilters(patient);
+    this->sortIndex.update(patient);
+}
+
+BPlusTreeIterator<HMS::PatientOrderKey, HMS::Patient *> PatientManager::getSortedPatientIterator(HMS::PatientOrder order)
+{
+    return this->sortIndex.iterate(order);
+}
+
+void PatientManager::sortPatients(View<HMS::Patient> &patients, HMS::PatientOrder order)
+{
+    // A view holds each patient at most once, so one as large as the list holds all of them. The sort is
+    // stable, so ties keep the view's order; the index breaks them by ID, which matches while the view is in ID order.
+    bool inIdOrder = patients.getSize() == this->getPatientSize();
+    for (int i = 1; inIdOrder && i < patients.getSize(); i++)
+    {
+        inIdOrder = patients.getData(i - 1)->getId() < patients.getData(i)->getId();
+    }
+    if (inIdOrder)
+    {
+        patients.reset();
+        patients.reserve(this->getPatientSize());
+        BPlusTreeIterator<HMS::PatientOrderKey, HMS::Patient *> iterator = this->sortIndex.iterate(order);
+        while (iterator.getData() != nullptr)
+        {
+            patients.addNode(**iterator.getData());
+            iterator.next();
+        }
+        return;
+    }
+
+    switch (order)
+    {
+    case HMS::PatientOrder::OrderByAppointment:
+    {
+        patients.sortNodes<HMS::Patient::compareTreatmentAppointment>();
+        break;
+    }
+    case HMS::PatientOrder::OrderByDayOfStay:
+    {
+        patients.sortNodes<HMS::Patient::compareTreatmentDayOfStay>();
+        break;
+    }
+    case HMS::PatientOrder::OrderByPriority:
+    {
+        patients.sortNodes<HMS::Patient::compareTreatmentPriority>();
+        break;
+    }
+    }
+}
+
+void PatientManager::updateFilters(HMS::Patient &patient)
+{
+    this->clearFilters(patient.getId());
+
+    this->statusFilters[patient.getStatus()].add(patient.getId());
+    HMS::Treatment *latestTreatment = patient.getLatestTreatment();
+    if (latestTreatment != nullptr)
+    {
+        this->treatmentTypeFilters[latestTreatment->getTreatmentType()].add(patient.getId());
+    }
+}
+
+void PatientManager::clearPatients()
+{
+    this->patientList.reset();
+    this->patientIndex.reset();
+    this->patientLookup.reset();
+    this->nameIndex.reset();
+    for (RoaringBitmap &filter : this->statusFilters)
+    {
+        filter.reset();
+    }
+    for (RoaringBitmap &filter : this->treatmentTypeFilters)
+    {
+        filter.reset();
+    }
+    this->sortIndex.reset();
+    this->triageQueue.reset();
+}
+
+void PatientManager::clearFilters(int id)
+{
+    // A patient is in one filter of each kind at most, and clearing a bit that is not set is cheap.
+    for (RoaringBitmap &filter : this->statusFilters)
+    {
+        filter.remove(id);
+    }
+    for (RoaringBitmap &filter : this->treatmentTypeFilters)
+    {
+        filter.remove(id);
+    }
+}
+
+RoaringBitmap &PatientManager::getStatusFilter(HMS::PatientStatus status)
+{
+    return this->statusFilters[status];
+}
+
+RoaringBitmap &PatientManager::getTreatmentTypeFilter(HMS::TreatmentType treatmentType)
+{
+    return this->treatmentTypeFilters[treatmentType];
+}
+
+int PatientManager::getPatientCount(HMS::PatientStatus status)
+{
+    return this->statusFilters[status].getSize();
+}
+
+int PatientManager::getPatientCount(HMS::TreatmentType treatmentType)
+{
+    return this->treatmentTypeFilters[treatmentType].getSize();
+}
+
+int PatientManager::getPatientCount(HMS::PatientStatus status, HMS::TreatmentType treatmentType)
+{
+    return this->statusFilters[status].intersectionSize(this->treatmentTypeFilters[treatmentType]);
+}
+
+int PatientManager::collectPatients(View<HMS::Patient> &patients, RoaringBitmap &filter)
+{
+    patients.reserve(patients.getSize() + filter.getSize());
+    filter.forEach([&](uint32_t id)
+                   { patients.addNode(**this->patientLookup.find((int)id)); });
+    return filter.getSize();
+}
+
+void PatientManager::updateTriage(HMS::Patient &patient)
+{
+    HMS::Treatment *treatment = this->getTriageTreatment(patient);
+    if (treatment == nullptr)
+    {
+        this->triageQueue.remove(patient.getId());
+        return;
+    }
+
+    this->triageQueue.update(patient.getId(), treatment->getPriority());
+}
+
+HMS::Treatment *PatientManager::getTriageTreatment(HMS::Patient &patient)
+{
+    // Only admitted patients whose latest treatment is still ongoing are waiting to be treated.
+    HMS::Treatment *latestTreatment = patient.getLatestTreatment();
+    if (patient.getStatus() != HMS::PatientStatus::Admitted || latestTreatment == nullptr || latestTreatment->isCompleted())
+    {
+        return nullptr;
+    }
+    return latestTreatment;
+}
+
+HMS::Patient *PatientManager::getNextTriagePatient()
+{
+    if (this->triageQueue.isEmpty())
+    {
+        return nullptr;
+    }
+
+    HMS::Patient **found = this->patientLookup.find(*this->triageQueue.peek());
+    return found == nullptr ? nullptr : *found;
+}
+
 int PatientManager::generatePatientId()
 {
     return ++this->idIndex;
@@ -0,0 +1,479 @@
+#include <cctype>
+#include <utility>
+#include "cores/patientQuery.h"
+
+using namespace HMS;
+
+namespace
+{
+    // Compares two characters, optionally ignoring the case of ASCII letters.
+    bool sameCharacter(char a, char b, bool ignoreCase)
+    {
+        return ignoreCase ? std::tolower((unsigned char)a) == std::tolower((unsigned char)b) : a == b;
+    }
+
+    // Checks if a name starts with a prefix, or equals it when `whole` is set.
+    bool matchName(const std::string &name, const std::string &text, bool whole, bool ignoreCase)
+    {
+        if (name.size() < text.size() || (whole && name.size() != text.size()))
+        {
+            return false;
+        }
+        for (size_t i = 0; i < text.size(); i++)
+        {
+            if (!sameCharacter(name[i], text[i], ignoreCase))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Recursive descent parser of the query text:
+    //   expression := term { "or" term }
+    //   term       := factor { "and" factor }
+    //   factor     := "not" factor | "(" expression ")" | field ("=" | "~") value
+    class QueryParser
+    {
+    public:
+        QueryParser(const std::string &text) : text(text), position(0){};
+
+        bool parse(PatientQuery &query)
+        {
+            if (!this->parseExpression(query))
+            {
+                return false;
+            }
+            this->skipSpaces();
+            return this->position == this->text.size();
+        }
+
+    private:
+        const std::string &text;
+        size_t position;
+
+        void skipSpaces()
+        {
+            while (this->position < this->text.size() && std::isspace((unsigned char)this->text[this->position]))
+            {
+                this->position++;
+            }
+        }
+
+        // Consumes a symbol or a keyword; keywords must not run into the next word.
+        bool accept(const std::string &token)
+        {
+            this->skipSpaces();
+            if (!matchName(this->text.substr(this->position), token, false, true))
+            {
+                return false;
+            }
+            size_t end = this->position + token.size();
+            if (std::isalpha((unsigned char)token[0]) && end < this->text.size() && std::isalnum((unsigned char)this->text[end]))
+            {
+                return false;
+            }
+            this->position = end;
+            return true;
+        }
+
+        bool parseExpression(PatientQuery &query)
+        {
+            if (!this->parseTerm(query))
+            {
+                return false;
+            }
+            while (this->accept("or"))
+            {
+                PatientQuery right;
+                if (!this->parseTerm(right))
+                {
+                    return false;
+                }
+                query = query || right;
+            }
+            return true;
+        }
+
+        bool parseTerm(PatientQuery &query)
+        {
+            if (!this->parseFactor(query))
+            {
+                return false;
+            }
+            while (this->accept("and"))
+            {
+                PatientQuery right;
+                if (!this->parseFactor(right))
+                {
+                    return false;
+                }
+                query = query && right;
+            }
+            return true;
+        }
+
+        bool parseFactor(PatientQuery &query)
+        {
+            if (this->accept("not"))
+            {
+                if (!this->parseFactor(query))
+                {
+                    return false;
+                }
+                query = !query;
+                return true;
+            }
+            if (this->accept("("))
+            {
+                return this->parseExpression(query) && this->accept(")");
+            }
+            return this->parseCriterion(query);
+        }
+
+        bool parseCriterion(PatientQuery &query)
+        {
+            this->skipSpaces();
+            size_t start = this->position;
+            while (this->position < this->text.size() && std::isalpha((unsigned char)this->text[this->position]))
+            {
+                this->position++;
+            }
+            std::string field = this->text.substr(start, this->position - start);
+            for (char &c : field)
+            {
+                c = std::tolower((unsigned char)c);
+            }
+
+            bool ignoreCase = this->accept("~");
+            if (!ignoreCase && !this->accept("="))
+            {
+                return false;
+            }
+            std::string value;
+            if (!this->parseValue(value))
+            {
+                return false;
+            }
+
+            if (field == "name")
+            {
+                bool prefix = value.back() == '*';
+                if (prefix)
+                {
+                    value.pop_back();
+                }
+                query = PatientQuery::name(value, prefix, ignoreCase);
+                return true;
+            }
+            if (ignoreCase)
+            {
+                return false;
+            }
+            if (field == "status")
+            {
+                for (int i = 0; i < PatientStatusSize; i++)
+                {
+                    if (matchName(value, PatientStatusLookUp[i], true, true))
+                    {
+                        query = PatientQuery::status(PatientStatus(i));
+                        return true;
+                    }
+                }
+                return false;
+            }
+            if (field == "type")
+            {
+                for (int i = 0; i < TreatmentTypeSize; i++)
+                {
+                    if (matchName(value, TreatmentTypeLookUp[i], true, true))
+                    {
+                        query = PatientQuery::treatmentType(TreatmentType(i));
+                        return true;
+                    }
+                }
+                query = PatientQuery::treatmentType(TreatmentType::Other, value);
+                return true;
+            }
+
+            std::string first = value;
+            std::string last = value;
+            size_t separator = value.find("..");
+            if (separator != std::string::npos)
+            {
+                first = value.substr(0, separator);
+                last = value.substr(separator + 2);
+            }
+            if (field == "appointment")
+            {
+                Handler::Date firstDate, lastDate;
+                if (!parseDate(first, firstDate) || !parseDate(last, lastDate))
+                {
+                    return false;
+                }
+                query = PatientQuery::appointment(firstDate, lastDate);
+                return true;
+            }
+            int min, max;
+            if (!parseNumber(first, min) || !parseNumber(last, max))
+            {
+                return false;
+            }
+            if (field == "priority")
+            {
+                query = PatientQuery::priority(min, max);
+                return true;
+            }
+            if (field == "stay")
+            {
+                query = PatientQuery::dayOfStay(min, max);
+                return true;
+            }
+            return false;
+        }
+
+        // A value is quoted, or runs up to a space or a parenthesis.
+        bool parseValue(std::string &value)
+        {
+            this->skipSpaces();
+            if (this->position < this->text.size() && this->text[this->position] == '"')
+            {
+                size_t end = this->text.find('"', this->position + 1);
+                if (end == std::string::npos)
+                {
+                    return false;
+                }
+                value = this->text.substr(this->position + 1, end - this->position - 1);
+                this->position = end + 1;
+                return !value.empty();
+            }
+
+            size_t start = this->position;
+            while (this->position < this->text.size() && !std::isspace((unsigned char)this->text[this->position]) &&
+                   this->text[this->position] != '(' && this->text[this->position] != ')')
+            {
+                this->position++;
+            }
+            value = this->text.substr(start, this->position - start);
+            return !value.empty();
+        }
+
+        static bool parseNumber(const std::string &text, int &number)
+        {
+            if (text.empty() || text.size() > 9)
+            {
+                return false;
+            }
+            number = 0;
+            for (char c : text)
+            {
+                if (!std::isdigit((unsigned char)c))
+                {
+                    return false;
+                }
+                number = number * 10 + (c - '0');
+            }
+            return true;
+        }
+
+        // Dates are DD/MM/YYYY, with the same bounds as InputHandler::isValidDate.
+        static bool parseDate(const std::string &text, Handler::Date &date)
+        {
+            int day, month, year;
+            if (text.size() != 10 || text[2] != '/' || text[5] != '/' ||
+                !parseNumber(text.substr(0, 2), day) || !parseNumber(text.substr(3, 2), month) || !parseNumber(text.substr(6, 4), year))
+            {
+                return false;
+            }
+            if (year < 1900 || month < 1 || month > 12 || day < 1 || day > Handler::DaysInMonth[Handler::isLeapYear(year)][month])
+            {
+                return false;
+            }
+            date = Handler::Date(day, month, year);
+            return true;
+        }
+    };
+}
+
+PatientQuery::PatientQuery() : PatientQuery(Node{All, -1, -1, 0, 0, false, ""}){};
+
+PatientQuery::PatientQuery(Node node) : nodes(), tests(), entry(ACCEPT), compiled(false), resolved(true), poolSize(0)
+{
+    this->nodes.push_back(std::move(node));
+}
+
+PatientQuery PatientQuery::name(std::string name, bool prefix, bool ignoreCase)
+{
+    return PatientQuery(Node{prefix ? NamePrefix : Name, -1, -1, 0, 0, ignoreCase, std::move(name)});
+}
+
+PatientQuery PatientQuery::status(PatientStatus status)
+{
+    return PatientQuery(Node{Status, -1, -1, status, status, false, ""});
+}
+
+PatientQuery PatientQuery::treatmentType(TreatmentType treatmentType, std::string otherType)
+{
+    if (treatmentType != TreatmentType::Other)
+    {
+        otherType.clear();
+    }
+    return PatientQuery(Node{Type, -1, -1, treatmentType, treatmentType, false, std::move(otherType)});
+}
+
+PatientQuery PatientQuery::priority(int min, int max)
+{
+    return PatientQuery(Node{Priority, -1, -1, min, max, false, ""});
+}
+
+PatientQuery PatientQuery::appointment(Handler::Date first, Handler::Date last)
+{
+    return PatientQuery(Node{Appointment, -1, -1, first.getOrdinal(), last.getOrdinal(), false, ""});
+}
+
+PatientQuery PatientQuery::dayOfStay(int min, int max)
+{
+    return PatientQuery(Node{DayOfStay, -1, -1, min, max, false, ""});
+}
+
+bool PatientQuery::parse(const std::string &text, PatientQuery &query)
+{
+    QueryParser parser(text);
+    PatientQuery parsed;
+    if (!parser.parse(parsed))
+    {
+        return false;
+    }
+    query = std::move(parsed);
+    return true;
+}
+
+PatientQuery PatientQuery::operator&&(const PatientQuery &other) const
+{
+    return this->combine(And, other);
+}
+
+PatientQuery PatientQuery::operator||(const PatientQuery &other) const
+{
+    return this->combine(Or, other);
+}
+
+PatientQuery PatientQuery::operator!() const
+{
+    PatientQuery query = *this;
+    query.nodes.push_back(Node{Not, (int)this->nodes.size() - 1, -1, 0, 0, false, ""});
+    query.compiled = false;
+    return query;
+}
+
+PatientQuery PatientQuery::combine(Kind kind, const PatientQuery &other) const
+{
+    // Append the other tree after this one, shifting its child indices, then add the new root.
+    PatientQuery query = *this;
+    int offset = this->nodes.size();
+    for (const Node &node : other.nodes)
+    {
+        query.nodes.push_back(node);
+        Node &added = query.nodes.back();
+        added.left = added.left < 0 ? -1 : added.left + offset;
+        added.right = added.right < 0 ? -1 : added.right + offset;
+    }
+    query.nodes.push_back(Node{kind, offset - 1, (int)query.nodes.size() - 1, 0, 0, false, ""});
+    query.compiled = false;
+    return query;
+}
+
+void PatientQuery::compile()
+{
+    // Interned strings never change, so only a name that was missing can resolve differently now.
+    int poolSize = List::StringPool::global().getSize();
+    if (this->compiled && (this->resolved || this->poolSize == poolSize))
+    {
+        return;
+    }
+
+    this->tests.clear();
+    this->resolved = true;
+    this->poolSize = poolSize;
+    this->entry = this->compileNode(this->nodes.size() - 1, ACCEPT, REJECT);
+    this->compiled = true;
+}
+
+int PatientQuery::compileNode(int index, int onTrue, int onFalse)
+{
+    const Node &node = this->nodes[index];
+    switch (node.kind)
+    {
+    case All:
+        return onTrue;
+    case And:
+        // The left side failing rejects without testing the right side.
+        return this->compileNode(node.left, this->compileNode(node.right, onTrue, onFalse), onFalse);
+    case Or:
+        // The left side passing accepts without testing the right side.
+        return this->compileNode(node.left, onTrue, this->compileNode(node.right, onTrue, onFalse));
+    case Not:
+        return this->compileNode(node.left, onFalse, onTrue);
+    default:
+        break;
+    }
+
+    Test test{node.kind, node.min, node.max, node.ignoreCase, List::StringPool::EMPTY, index, onTrue, onFalse};
+    bool exactText = (node.kind == Name && !node.ignoreCase) || (node.kind == Type && !node.text.empty());
+    if (exactText && !List::StringPool::global().find(node.text, test.symbol))
+    {
+        // Text that was never interned is held by no patient or treatment.
+        this->resolved = false;
+        return onFalse;
+    }
+    this->tests.push_back(test);
+    return this->tests.size() - 1;
+}
+
+bool PatientQuery::matches(Patient &patient)
+{
+    if (!this->compiled)
+    {
+        this->compile();
+    }
+
+    Treatment *latestTreatment = patient.getLatestTreatment();
+    int next = this->entry;
+    while (next >= 0)
+    {
+        const Test &test = this->tests[next];
+        next = evaluate(test, this->nodes[test.node], patient, latestTreatment) ? test.onTrue : test.onFalse;
+    }
+    return next == ACCEPT;
+}
+
+bool PatientQuery::evaluate(const Test &test, const Node &node, Patient &patient, Treatment *latestTreatment)
+{
+    switch (test.kind)
+    {
+    case Name:
+        return test.ignoreCase ? matchName(patient.getName(), node.text, true, true) : patient.getNameSymbol() == test.symbol;
+    case NamePrefix:
+        return matchName(patient.getName(), node.text, false, test.ignoreCase);
+    case Status:
+        return patient.getStatus() == test.min;
+    case Type:
+        return latestTreatment != nullptr && latestTreatment->getTreatmentType() == test.min &&
+               (node.text.empty() || latestTreatment->getOtherTreatmentTypeSymbol() == test.symbol);
+    case Priority:
+        return latestTreatment != nullptr && latestTreatment->getPriority() >= test.min && latestTreatment->getPriority() <= test.max;
+    case Appointment:
+    {
+        if (latestTreatment == nullptr)
+        {
+            return false;
+        }
+        int ordinal = latestTreatment->getAppointment().getOrdinal();
+        return ordinal >= test.min && ordinal <= test.max;
+    }
+    case DayOfStay:
+        return latestTreatment != nullptr && latestTreatment->getDayOfStay() >= test.min && latestTreatment->getDayOfStay() <= test.max;
+    default:
+        return true;
+    }
+}
\ No newline at end of file
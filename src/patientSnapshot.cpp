@@ -0,0 +1,337 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "cores/patientSnapshot.h"
+#include "handlers/inputHandler.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace HMS;
+
+// Magic at the start of every snapshot file.
+static const char SnapshotMagic[8] = {'H', 'M', 'S', 'S', 'N', 'A', 'P', '\0'};
+
+// Largest valid day ordinal, 31/12/9999.
+static const int MaxOrdinal = Handler::daysBeforeYear(10000);
+
+PatientSnapshot::PatientSnapshot()
+    : data(nullptr),
+      size(0),
+      mapped(false),
+      buffer() {};
+
+PatientSnapshot::~PatientSnapshot()
+{
+    this->close();
+}
+
+bool PatientSnapshot::open(const std::string &path)
+{
+    this->close();
+
+#ifndef _WIN32
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+
+    struct stat status;
+    if (fstat(file, &status) != 0 || status.st_size < (off_t)sizeof(SnapshotHeader))
+    {
+        ::close(file);
+        return false;
+    }
+
+    // The mapping keeps the file readable after the descriptor is closed.
+    void *mapping = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+    this->data = (const char *)mapping;
+    this->size = (size_t)status.st_size;
+    this->mapped = true;
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::streamoff length = file.tellg();
+    if (length < (std::streamoff)sizeof(SnapshotHeader))
+    {
+        return false;
+    }
+
+    this->buffer.resize(((size_t)length + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    file.seekg(0);
+    if (!file.read((char *)this->buffer.data(), length))
+    {
+        this->buffer.clear();
+        return false;
+    }
+    this->data = (const char *)this->buffer.data();
+    this->size = (size_t)length;
+#endif
+
+    if (!this->validate())
+    {
+        this->close();
+        return false;
+    }
+    return true;
+}
+
+void PatientSnapshot::close()
+{
+#ifndef _WIN32
+    if (this->mapped)
+    {
+        munmap((void *)this->data, this->size);
+    }
+#endif
+    this->buffer.clear();
+    this->buffer.shrink_to_fit();
+    this->data = nullptr;
+    this->size = 0;
+    this->mapped = false;
+}
+
+const SnapshotHeader &PatientSnapshot::getHeader()
+{
+    return *(const SnapshotHeader *)this->data;
+}
+
+const SnapshotPatient *PatientSnapshot::getPatients()
+{
+    return (const SnapshotPatient *)(this->data + this->getHeader().patientsOffset);
+}
+
+const SnapshotTreatment *PatientSnapshot::getTreatments()
+{
+    return (const SnapshotTreatment *)(this->data + this->getHeader().treatmentsOffset);
+}
+
+const int32_t *PatientSnapshot::getDates()
+{
+    return (const int32_t *)(this->data + this->getHeader().datesOffset);
+}
+
+std::string_view PatientSnapshot::getString(uint32_t index)
+{
+    const SnapshotHeader &header = this->getHeader();
+    const SnapshotString &string = ((const SnapshotString *)(this->data + header.stringsOffset))[index];
+    return std::string_view(this->data + header.stringDataOffset + string.offset, string.length);
+}
+
+bool PatientSnapshot::validate()
+{
+    const SnapshotHeader &header = this->getHeader();
+    if (std::memcmp(header.magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0 || header.version != SnapshotVersion ||
+        header.byteOrder != SnapshotByteOrder || header.fileSize != this->size || header.stringCount == 0)
+    {
+        return false;
+    }
+
+    if (!this->validSection(header.patientsOffset, header.patientCount, sizeof(SnapshotPatient)) ||
+        !this->validSection(header.treatmentsOffset, header.treatmentCount, sizeof(SnapshotTreatment)) ||
+        !this->validSection(header.datesOffset, header.dateCount, sizeof(int32_t)) ||
+        !this->validSection(header.stringsOffset, header.stringCount, sizeof(SnapshotString)) ||
+        !this->validSection(header.stringDataOffset, header.stringBytes, 1))
+    {
+        return false;
+    }
+
+    // Every index and value is checked here once, so loading can trust the records.
+    const SnapshotString *strings = (const SnapshotString *)(this->data + header.stringsOffset);
+    for (uint32_t i = 0; i < header.stringCount; i++)
+    {
+        if (strings[i].offset > header.stringBytes || strings[i].length > header.stringBytes - strings[i].offset)
+        {
+            return false;
+        }
+    }
+
+    const SnapshotTreatment *treatments = this->getTreatments();
+    for (uint32_t i = 0; i < header.treatmentCount; i++)
+    {
+        const SnapshotTreatment &treatment = treatments[i];
+        if (treatment.type >= TreatmentTypeSize || treatment.completed > 1 || treatment.otherType >= header.stringCount ||
+            treatment.appointment < 0 || treatment.appointment > MaxOrdinal)
+        {
+            return false;
+        }
+    }
+
+    const int32_t *dates = this->getDates();
+    for (uint32_t i = 0; i < header.dateCount; i++)
+    {
+        if (dates[i] < 0 || dates[i] > MaxOrdinal)
+        {
+            return false;
+        }
+    }
+
+    const SnapshotPatient *patients = this->getPatients();
+    int32_t previousId = 0;
+    for (uint32_t i = 0; i < header.patientCount; i++)
+    {
+        const SnapshotPatient &patient = patients[i];
+        uint64_t dateCount = (uint64_t)patient.admissionCount + patient.dischargeCount;
+        if (patient.id <= previousId || patient.name >= header.stringCount || patient.status >= PatientStatusSize ||
+            patient.firstTreatment > header.treatmentCount || patient.treatmentCount > header.treatmentCount - patient.firstTreatment ||
+            patient.firstDate > header.dateCount || dateCount > header.dateCount - patient.firstDate)
+        {
+            return false;
+        }
+        previousId = patient.id;
+    }
+
+    return header.idIndex >= previousId;
+}
+
+bool PatientSnapshot::validSection(uint64_t offset, uint64_t count, uint64_t recordSize)
+{
+    return offset >= sizeof(SnapshotHeader) && offset % sizeof(uint64_t) == 0 && offset <= this->size &&
+           count <= (this->size - offset) / recordSize;
+}
+
+PatientSnapshotWriter::PatientSnapshotWriter()
+    : patients(),
+      treatments(),
+      dates(),
+      strings(),
+      stringData(),
+      stringIndexes()
+{
+    // The empty string is always the first, so an unset other treatment type needs no entry of its own.
+    this->addString(List::StringPool::EMPTY);
+};
+
+void PatientSnapshotWriter::addPatient(Patient &patient)
+{
+    SnapshotPatient record = {};
+    record.id = patient.getId();
+    record.name = this->addString(patient.getNameSymbol());
+    record.status = (uint8_t)patient.getStatus();
+
+    record.firstTreatment = (uint32_t)this->treatments.size();
+    for (Treatment &treatment : patient.getTreatmentIterator())
+    {
+        SnapshotTreatment treatmentRecord = {};
+        treatmentRecord.appointment = treatment.getAppointment().getOrdinal();
+        treatmentRecord.dayOfStay = treatment.getDayOfStay();
+        treatmentRecord.priority = treatment.getPriority();
+        treatmentRecord.otherType = this->addString(treatment.getOtherTreatmentTypeSymbol());
+        treatmentRecord.type = (uint8_t)treatment.getTreatmentType();
+        treatmentRecord.completed = treatment.isCompleted() ? 1 : 0;
+        this->treatments.push_back(treatmentRecord);
+    }
+    record.treatmentCount = (uint32_t)this->treatments.size() - record.firstTreatment;
+
+    record.firstDate = (uint32_t)this->dates.size();
+    for (Handler::Date &admission : patient.getAdmissionsIterator())
+    {
+        this->dates.push_back(admission.getOrdinal());
+    }
+    record.admissionCount = (uint32_t)this->dates.size() - record.firstDate;
+    for (Handler::Date &discharge : patient.getDischargesIterator())
+    {
+        this->dates.push_back(discharge.getOrdinal());
+    }
+    record.dischargeCount = (uint32_t)this->dates.size() - record.firstDate - record.admissionCount;
+
+    this->patients.push_back(record);
+}
+
+bool PatientSnapshotWriter::save(const std::string &path, int idIndex)
+{
+    // Lay the sections out one after the other, each padded to 8 bytes.
+    auto align = [](uint64_t offset)
+    { return (offset + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t); };
+
+    SnapshotHeader header = {};
+    std::memcpy(header.magic, SnapshotMagic, sizeof(SnapshotMagic));
+    header.version = SnapshotVersion;
+    header.byteOrder = SnapshotByteOrder;
+    header.idIndex = idIndex;
+    header.patientCount = (uint32_t)this->patients.size();
+    header.treatmentCount = (uint32_t)this->treatments.size();
+    header.dateCount = (uint32_t)this->dates.size();
+    header.stringCount = (uint32_t)this->strings.size();
+    header.stringBytes = this->stringData.size();
+    header.patientsOffset = align(sizeof(SnapshotHeader));
+    header.treatmentsOffset = align(header.patientsOffset + this->patients.size() * sizeof(SnapshotPatient));
+    header.datesOffset = align(header.treatmentsOffset + this->treatments.size() * sizeof(SnapshotTreatment));
+    header.stringsOffset = align(header.datesOffset + this->dates.size() * sizeof(int32_t));
+    header.stringDataOffset = align(header.stringsOffset + this->strings.size() * sizeof(SnapshotString));
+    header.fileSize = header.stringDataOffset + header.stringBytes;
+
+    std::string temporaryPath = path + ".tmp";
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    uint64_t written = 0;
+    auto writeSection = [&](uint64_t offset, const void *section, uint64_t length)
+    {
+        static const char padding[sizeof(uint64_t)] = {};
+        file.write(padding, (std::streamsize)(offset - written));
+        file.write((const char *)section, (std::streamsize)length);
+        written = offset + length;
+    };
+    writeSection(0, &header, sizeof(SnapshotHeader));
+    writeSection(header.patientsOffset, this->patients.data(), this->patients.size() * sizeof(SnapshotPatient));
+    writeSection(header.treatmentsOffset, this->treatments.data(), this->treatments.size() * sizeof(SnapshotTreatment));
+    writeSection(header.datesOffset, this->dates.data(), this->dates.size() * sizeof(int32_t));
+    writeSection(header.stringsOffset, this->strings.data(), this->strings.size() * sizeof(SnapshotString));
+    writeSection(header.stringDataOffset, this->stringData.data(), this->stringData.size());
+
+    file.close();
+    if (!file)
+    {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+
+#ifdef _WIN32
+    // Renaming does not replace an existing file on Windows.
+    std::remove(path.c_str());
+#endif
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+uint32_t PatientSnapshotWriter::addString(List::Symbol symbol)
+{
+    uint32_t *found = this->stringIndexes.find(symbol);
+    if (found != nullptr)
+    {
+        return *found;
+    }
+
+    const std::string &value = List::StringPool::global().get(symbol);
+    SnapshotString string = {};
+    string.offset = this->stringData.size();
+    string.length = (uint32_t)value.size();
+    this->stringData += value;
+
+    uint32_t index = (uint32_t)this->strings.size();
+    this->strings.push_back(string);
+    this->stringIndexes.insert(symbol, index);
+    return index;
+}
\ No newline at end of file
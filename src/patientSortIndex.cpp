@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include "cores/patientSortIndex.h"
+
+using namespace HMS;
+
+namespace
+{
+    /**
+     * @brief Stably sorts rows by their keys with a least significant digit radix sort, 16 bits at a time.
+     * Rows keyed LLONG_MAX, patients without an ongoing treatment, are moved last first. The other keys are
+     * sorted by their distance from the smallest, so only the digits their range spans cost a pass.
+     * @param keys The key of each row.
+     * @param rows The rows to sort, in place.
+     */
+    void sortRows(const std::vector<long long> &keys, std::vector<int> &rows)
+    {
+        const int digitBits = 16;
+        const int digitCount = 1 << digitBits;
+        auto last = std::stable_partition(rows.begin(), rows.end(), [&keys](int row)
+                                          { return keys[row] != LLONG_MAX; });
+        int count = (int)(last - rows.begin());
+        if (count < 2)
+        {
+            return;
+        }
+
+        long long smallest = LLONG_MAX;
+        long long largest = LLONG_MIN;
+        for (int i = 0; i < count; i++)
+        {
+            smallest = std::min(smallest, keys[rows[i]]);
+            largest = std::max(largest, keys[rows[i]]);
+        }
+        unsigned long long range = (unsigned long long)largest - (unsigned long long)smallest;
+
+        std::vector<int> pending(rows.begin(), last);
+        std::vector<int> sorted(count);
+        std::vector<int> counts(digitCount);
+        for (int shift = 0; shift < 64 && (range >> shift) != 0; shift += digitBits)
+        {
+            auto digit = [&](int row)
+            { return (int)((((unsigned long long)keys[row] - (unsigned long long)smallest) >> shift) & (digitCount - 1)); };
+
+            std::fill(counts.begin(), counts.end(), 0);
+            for (int row : pending)
+            {
+                counts[digit(row)]++;
+            }
+
+            int offset = 0;
+            for (int &bucket : counts)
+            {
+                int start = offset;
+                offset += bucket;
+                bucket = start;
+            }
+            for (int row : pending)
+            {
+                sorted[counts[digit(row)]++] = row;
+            }
+            pending.swap(sorted);
+        }
+        std::copy(pending.begin(), pending.end(), rows.begin());
+    }
+}
+
+PatientSortIndex::PatientSortIndex() : orders(), entries(){};
+
+void PatientSortIndex::reset()
+{
+    for (int order = 0; order < PatientOrderSize; order++)
+    {
+        this->orders[order].reset();
+    }
+    this->entries.reset();
+}
+
+void PatientSortIndex::update(Patient &patient)
+{
+    int id = patient.getId();
+    Entry *entry = this->entries.find(id);
+    Entry updated;
+    for (int order = 0; order < PatientOrderSize; order++)
+    {
+        updated.keys[order] = key(patient, PatientOrder(order));
+        if (entry != nullptr && entry->keys[order] == updated.keys[order])
+        {
+            continue;
+        }
+
+        if (entry != nullptr)
+        {
+            this->orders[order].remove({entry->keys[order], id});
+        }
+        this->orders[order].insert({updated.keys[order], id}, &patient);
+    }
+    this->entries.insert(id, updated);
+}
+
+bool PatientSortIndex::remove(int id)
+{
+    Entry *entry = this->entries.find(id);
+    if (entry == nullptr)
+    {
+        return false;
+    }
+
+    for (int order = 0; order < PatientOrderSize; order++)
+    {
+        this->orders[order].remove({entry->keys[order], id});
+    }
+    this->entries.remove(id);
+    return true;
+}
+
+void PatientSortIndex::bulkLoad(Patient *patients[], int count)
+{
+    this->reset();
+    std::vector<int> ids(count);
+    std::vector<Entry> patientEntries(count);
+    std::vector<long long> keys[PatientOrderSize];
+    for (int order = 0; order < PatientOrderSize; order++)
+    {
+        keys[order].resize(count);
+    }
+    for (int i = 0; i < count; i++)
+    {
+        for (int order = 0; order < PatientOrderSize; order++)
+        {
+            patientEntries[i].keys[order] = key(*patients[i], PatientOrder(order));
+            keys[order][i] = patientEntries[i].keys[order];
+        }
+        ids[i] = patients[i]->getId();
+    }
+    this->entries.bulkLoad(ids.data(), patientEntries.data(), count);
+
+    // The patients are in ID order, so a stable sort by key gives the order of the keys with their IDs.
+    std::vector<int> rows(count);
+    std::vector<PatientOrderKey> orderKeys(count);
+    std::vector<Patient *> values(count);
+    for (int order = 0; order < PatientOrderSize; order++)
+    {
+        std::iota(rows.begin(), rows.end(), 0);
+        sortRows(keys[order], rows);
+        for (int i = 0; i < count; i++)
+        {
+            orderKeys[i] = {keys[order][rows[i]], ids[rows[i]]};
+            values[i] = patients[rows[i]];
+        }
+        this->orders[order].bulkLoad(orderKeys.data(), values.data(), count);
+    }
+}
+
+int PatientSortIndex::getSize()
+{
+    return this->entries.getSize();
+}
+
+BPlusTreeIterator<PatientOrderKey, Patient *> PatientSortIndex::iterate(PatientOrder order)
+{
+    return this->orders[order].iterate();
+}
+
+long long PatientSortIndex::key(Patient &patient, PatientOrder order)
+{
+    // The keys of the sort functions, so the index and a sort of the list agree.
+    switch (order)
+    {
+    case OrderByAppointment:
+        return List::SortKey<&Patient::compareTreatmentAppointment>::key(patient);
+    case OrderByDayOfStay:
+        return List::SortKey<&Patient::compareTreatmentDayOfStay>::key(patient);
+    default:
+        return List::SortKey<&Patient::compareTreatmentPriority>::key(patient);
+    }
+}
\ No newline at end of file
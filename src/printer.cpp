@@ -41,6 +41,20 @@ void Printer::printDivider()
     cout << "======================================" << endl;
 };
 
+int Printer::getPageCount(int itemCount)
+{
+    return itemCount > PAGE_SIZE ? (itemCount + PAGE_SIZE - 1) / PAGE_SIZE : 1;
+};
+
+void Printer::printPageFooter(int page, int itemCount)
+{
+    int pageCount = getPageCount(itemCount);
+    if (pageCount > 1)
+    {
+        cout << "Page " << page + 1 << " of " << pageCount << " (" << itemCount << " in total)" << endl;
+    }
+};
+
 void Printer::clearConsole()
 {
 #if defined _WIN32
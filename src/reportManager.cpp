@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <iomanip>
 #include "managers/reportManager.h"
 #include "cores/client.h"
 #include "utils/printer.h"
+#include "structs/arrayList.h"
+#include "structs/view.h"
 
 using namespace Manager;
 
@@ -20,6 +23,17 @@ const int Manager::ReportManagerErrorMessageSize = sizeof(Manager::ReportManager
 
 ReportManager::ReportManager(HMS::Client &client) : client(client) {};
 
+void ReportManager::printMorePatients(int patientCount)
+{
+    using std::cout, std::endl;
+
+    if (patientCount > Util::Printer::PAGE_SIZE)
+    {
+        cout << "... and " << patientCount - Util::Printer::PAGE_SIZE
+             << " more, refine with Search Patients under Manage Patients" << endl;
+    }
+}
+
 void ReportManager::manageReport()
 {
     using Manager::OptionsManageReport;
@@ -55,25 +69,11 @@ void ReportManager::manageReport()
             cout << "Total Patient: " << patientSize << endl;
             this->client.printer->printDivider();
 
-            Iterator<HMS::Patient> iterator = this->client.patientManager->getPatientListIterator();
-
-            LinkedList<HMS::Patient> admittedPatients;
-            LinkedList<HMS::Patient> dischargedPatients;
-
-            while (iterator.getData() != nullptr)
-            {
-                HMS::Patient *patient = iterator.getData();
-                if (patient->getStatus() == HMS::PatientStatus::Admitted)
-                {
-                    admittedPatients.addNode(*patient);
-                }
-                else
-                {
-                    dischargedPatients.addNode(*patient);
-                }
-
-                iterator.next();
-            }
+            // Reference the patients rather than copying their records, reading them off the status filters.
+            View<HMS::Patient> admittedPatients;
+            View<HMS::Patient> dischargedPatients;
+            this->client.patientManager->collectPatients(admittedPatients, this->client.patientManager->getStatusFilter(HMS::PatientStatus::Admitted));
+            this->client.patientManager->collectPatients(dischargedPatients, this->client.patientManager->getStatusFilter(HMS::PatientStatus::Discharged));
 
             // Print admitted patients
             cout << "Admitted Patient: (" << admittedPatients.getSize() << ")" << endl;
@@ -86,15 +86,16 @@ void ReportManager::manageReport()
                 cout << setw(5) << left << "|ID"
                      << setw(20) << left << "|Name" << "|"
                      << endl;
-                iterator = admittedPatients.iterate();
-                while (iterator.getData() != nullptr)
+                ViewIterator<HMS::Patient> admittedIterator = admittedPatients.iterate(0, Util::Printer::PAGE_SIZE);
+                while (admittedIterator.getData() != nullptr)
                 {
-                    HMS::Patient *patient = iterator.getData();
+                    HMS::Patient *patient = admittedIterator.getData();
                     cout << "|" << setw(4) << patient->getId() << "|"
                          << setw(19) << patient->getName().substr(0, 19) << "|"
                          << endl;
-                    iterator.next();
+                    admittedIterator.next();
                 }
+                this->printMorePatients(admittedPatients.getSize());
             }
 
             this->client.printer->printDivider();
@@ -110,15 +111,16 @@ void ReportManager::manageReport()
                 cout << setw(5) << left << "|ID"
                      << setw(20) << left << "|Name" << "|"
                      << endl;
-                iterator = dischargedPatients.iterate();
-                while (iterator.getData() != nullptr)
+                ViewIterator<HMS::Patient> dischargedIterator = dischargedPatients.iterate(0, Util::Printer::PAGE_SIZE);
+                while (dischargedIterator.getData() != nullptr)
                 {
-                    HMS::Patient *patient = iterator.getData();
+                    HMS::Patient *patient = dischargedIterator.getData();
                     cout << "|" << setw(4) << patient->getId() << "|"
                          << setw(19) << patient->getName().substr(0, 19) << "|"
                          << endl;
-                    iterator.next();
+                    dischargedIterator.next();
                 }
+                this->printMorePatients(dischargedPatients.getSize());
             }
 
             // Wait for user to continue
@@ -140,13 +142,40 @@ void ReportManager::manageReport()
 
             using std::cout, std::endl;
 
-            // Get a patient from the user
+            // Get a patient from the user, paging through the list when it does not fit on one page
             ErrorCode err = this->client.inputHandler.noErrorCode();
             HMS::Patient *patient;
+            int page = 0;
             while (true)
             {
+                int pageCount = this->client.printer->getPageCount(this->client.patientManager->getPatientSize());
                 this->client.printer->printHeader();
-                this->client.patientManager->printPatientList();
+                this->client.patientManager->printPatientList(page);
+
+                if (pageCount > 1)
+                {
+                    cout << "1) Choose Patient" << endl
+                         << "2) Next Page" << endl
+                         << "3) Previous Page" << endl
+                         << "Selection: ";
+                    int selection;
+                    ErrorCode err = this->client.inputHandler.getInt(selection, 1, 3);
+                    if (err != this->client.inputHandler.noErrorCode())
+                    {
+                        this->client.errorHandler.addError(err);
+                        continue;
+                    }
+                    if (selection == OptionsChooseReportPatient::NextReportPage)
+                    {
+                        page = std::min(page + 1, pageCount - 1);
+                        continue;
+                    }
+                    if (selection == OptionsChooseReportPatient::PreviousReportPage)
+                    {
+                        page = std::max(page - 1, 0);
+                        continue;
+                    }
+                }
 
                 cout << "Choose patient by ID: ";
                 int id;
@@ -176,45 +205,27 @@ void ReportManager::manageReport()
                  << "Treatment Timelines: " << endl;
 
             // Gather events timelines from treatments, admissions, and discharges
-            LinkedList<Event> events;
+            ArrayList<Event> events;
 
-            Iterator<HMS::Treatment> treatmentsIterator = patient->getTreatmentIterator();
-            while (treatmentsIterator.getData() != nullptr)
-            {
-                HMS::Treatment *treatment = treatmentsIterator.getData();
-                Event newEvent = {treatment->getAppointment(), "Treatment: " + treatment->getFormattedTreatmentType()};
-                events.addNode(newEvent);
-                treatmentsIterator.next();
-            }
+            UnrolledIterator<HMS::Treatment, HMS::TreatmentChunkSize> treatments = patient->getTreatmentIterator();
+            Iterator<Handler::Date> admissions = patient->getAdmissionsIterator();
+            Iterator<Handler::Date> discharges = patient->getDischargesIterator();
 
-            Iterator<Handler::Date> admissionsIterator = patient->getAdmissionsIterator();
-            while (admissionsIterator.getData() != nullptr)
-            {
-                Handler::Date *admission = admissionsIterator.getData();
-                Event newEvent = {*admission, "Admitted"};
-                events.addNode(newEvent);
-                admissionsIterator.next();
-            }
-            Iterator<Handler::Date> dischargesIterator = patient->getDischargesIterator();
-            while (dischargesIterator.getData() != nullptr)
-            {
-                Handler::Date *discharge = dischargesIterator.getData();
-                Event newEvent = {*discharge, "Discharged"};
-                events.addNode(newEvent);
-                dischargesIterator.next();
-            }
+            std::for_each(treatments.begin(), treatments.end(), [&events](HMS::Treatment &treatment)
+                          { events.addNode({treatment.getAppointment(), "Treatment: " + treatment.getFormattedTreatmentType()}); });
+            std::for_each(admissions.begin(), admissions.end(), [&events](Handler::Date &admission)
+                          { events.addNode({admission, "Admitted"}); });
+            std::for_each(discharges.begin(), discharges.end(), [&events](Handler::Date &discharge)
+                          { events.addNode({discharge, "Discharged"}); });
 
             // Sort events by date
             events.sortNodes();
 
             // Print sorted events
-            Iterator<Event> eventIterator = events.iterate();
-            while (eventIterator.getData() != nullptr)
+            for (Event &event : events)
             {
-                Event *event = eventIterator.getData();
                 cout << endl
-                     << "(" << event->date.getFormattedDate() << ") " << eventIterator.getData()->description << endl;
-                eventIterator.next();
+                     << "(" << event.date.getFormattedDate() << ") " << event.description << endl;
             }
 
             // Wait for user to continue
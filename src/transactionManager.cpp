@@ -1,8 +1,10 @@
 #include <iostream>
+#include <algorithm>
 #include <iomanip>
 #include "managers/transactionManager.h"
 #include "cores/client.h"
 #include "utils/printer.h"
+#include "structs/arrayList.h"
 
 using namespace Manager;
 
@@ -15,7 +17,8 @@ const std::string Manager::TransactionManagerErrorMessage[] = {
 const int Manager::TransactionManagerErrorMessageSize = sizeof(Manager::TransactionManagerErrorMessage) / sizeof(Manager::TransactionManagerErrorMessage[0]);
 
 TransactionManager::TransactionManager(HMS::Client &client)
-    : client(client) {};
+    : client(client),
+      page(0) {};
 
 void TransactionManager::manageTransaction()
 {
@@ -31,14 +34,20 @@ void TransactionManager::manageTransaction()
         this->client.printer->printHeader();
         this->printTransactionList();
 
-        // Display menu options
+        // Display menu options, with paging when the list does not fit on one page
+        int pageCount = this->client.printer->getPageCount(this->dischargeQueue.getSize());
         cout << "1) Discharge Patient" << endl
              << "2) Sort Transaction" << endl
-             << "3) Exit Manage Transaction" << endl
-             << "Selection: ";
+             << "3) Exit Manage Transaction" << endl;
+        if (pageCount > 1)
+        {
+            cout << "4) Next Page" << endl
+                 << "5) Previous Page" << endl;
+        }
+        cout << "Selection: ";
         // Get user selection
         int selection;
-        ErrorCode err = this->client.inputHandler.getInt(selection, 1, 3);
+        ErrorCode err = this->client.inputHandler.getInt(selection, 1, pageCount > 1 ? 5 : 3);
         if (err != this->client.inputHandler.noErrorCode())
         {
             this->client.errorHandler.addError(err);
@@ -51,15 +60,14 @@ void TransactionManager::manageTransaction()
         case OptionsManageTransaction::DischargePatient:
         {
             // Check if there are admitted patients to discharge
-            if (this->client.patientManager->getPatientSize() == 0)
+            if (this->dischargeQueue.isEmpty())
             {
                 this->client.errorHandler.addError(getErrorCode(NO_ADMITTED_PATIENT));
                 continue;
             }
 
-            // Get patient to discharge from the transaction list
-            Iterator<HMS::Patient> iterator = this->transactionList.iterate();
-            HMS::Patient *patient = this->client.patientManager->getPatient(*(iterator.getData()));
+            // Get the next patient to discharge from the discharge queue
+            HMS::Patient *patient = this->dischargeQueue.peek()->patient;
 
             this->client.printer->printHeader();
 
@@ -81,9 +89,11 @@ void TransactionManager::manageTransaction()
                 latestTreatment->setCompleted();
             }
             patient->setStatus(HMS::PatientStatus::Discharged);
+            this->client.patientManager->refreshPatient(*patient);
 
             // Remove patient from transaction list
-            this->transactionList.dequeue();
+            this->dischargeQueue.dequeue();
+            this->transactionList.deleteNode(*patient);
             break;
         }
         case OptionsManageTransaction::SortTransaction:
@@ -98,6 +108,16 @@ void TransactionManager::manageTransaction()
             manageTransactionLoop = false;
             break;
         }
+        case OptionsManageTransaction::NextTransactionPage:
+        {
+            this->page = std::min(this->page + 1, pageCount - 1);
+            break;
+        }
+        case OptionsManageTransaction::PreviousTransactionPage:
+        {
+            this->page = std::max(this->page - 1, 0);
+            break;
+        }
         }
     }
 }
@@ -136,17 +156,17 @@ void TransactionManager::manageSortTransaction()
         {
         case OptionsSortTransaction::SortTransactionByAppointment:
         {
-            this->transactionList.sortQueue(HMS::Patient::compareTreatmentAppointment);
+            this->orderTransactionList(HMS::PatientOrder::OrderByAppointment);
             break;
         }
         case OptionsSortTransaction::SortTransactionByLengthOfStay:
         {
-            this->transactionList.sortQueue(HMS::Patient::compareTreatmentDayOfStay);
+            this->orderTransactionList(HMS::PatientOrder::OrderByDayOfStay);
             break;
         }
         case OptionsSortTransaction::SortTransactionByPriority:
         {
-            this->transactionList.sortQueue(HMS::Patient::compareTreatmentPriority);
+            this->orderTransactionList(HMS::PatientOrder::OrderByPriority);
             break;
         }
         }
@@ -173,14 +193,15 @@ void TransactionManager::printTransactionList()
              << setw(15) << left << "|Length Of Stay"
              << setw(9) << left << "|Priority|"
              << endl;
-        Iterator<HMS::Patient> iterator = this->transactionList.iterate();
-        while (iterator.getData() != nullptr)
+        // Print the page in order of discharge, selecting its rows from the queue without copying or draining it.
+        this->page = std::min(this->page, this->client.printer->getPageCount(this->dischargeQueue.getSize()) - 1);
+        auto printRow = [&](DischargeEntry &entry)
         {
-            HMS::Patient *patient = iterator.getData();
-            HMS::Treatment *latestTreatment = patient->getLatestTreatment();
-            cout << "|" << setw(4) << patient->getId() << "|"
-                 << setw(19) << patient->getName().substr(0, 19) << "|"
-                 << setw(11) << HMS::PatientStatusLookUp[patient->getStatus()] << "|";
+            HMS::Patient &patient = *entry.patient;
+            HMS::Treatment *latestTreatment = patient.getLatestTreatment();
+            cout << "|" << setw(4) << patient.getId() << "|"
+                 << setw(19) << patient.getName().substr(0, 19) << "|"
+                 << setw(11) << HMS::PatientStatusLookUp[patient.getStatus()] << "|";
 
             // Print None, if the patient had completed his treatment
             if (latestTreatment == nullptr || latestTreatment->isCompleted())
@@ -199,9 +220,9 @@ void TransactionManager::printTransactionList()
                      << setw(8) << latestTreatment->getPriority() << "|"
                      << endl;
             }
-
-            iterator.next();
-        }
+        };
+        this->dischargeQueue.visitInOrder(this->page * Util::Printer::PAGE_SIZE, Util::Printer::PAGE_SIZE, printRow);
+        this->client.printer->printPageFooter(this->page, this->dischargeQueue.getSize());
     }
     this->client.printer->printDivider();
 }
@@ -217,18 +238,49 @@ ErrorCode TransactionManager::noErrorCode()
 
 void TransactionManager::resetTransactionList()
 {
-    this->transactionList.resetQueue();
+    this->transactionList.reset();
 
-    // Iterate through patient list and enqueue admitted patients
-    Iterator<HMS::Patient> iterator = this->client.patientManager->getPatientListIterator();
-    while (iterator.getData() != nullptr)
+    // Iterate through patient list and link the admitted patients into the queue
+    for (HMS::Patient &patient : this->client.patientManager->getPatientListIterator())
     {
-        HMS::Patient *patient = iterator.getData();
-        if (patient->getStatus() == HMS::PatientStatus::Admitted)
+        if (patient.getStatus() == HMS::PatientStatus::Admitted)
         {
-            this->transactionList.enqueue(*(iterator.getData()));
+            this->transactionList.addNode(patient);
         }
+    }
 
+    this->orderTransactionList();
+}
+
+void TransactionManager::orderTransactionList()
+{
+    ArrayList<DischargeEntry> entries;
+    entries.reserve(this->transactionList.getSize());
+    for (HMS::Patient &patient : this->transactionList)
+    {
+        entries.addNode({0, entries.getSize(), &patient});
+    }
+
+    this->dischargeQueue.assign(entries.begin(), entries.end());
+    this->page = 0;
+}
+
+void TransactionManager::orderTransactionList(HMS::PatientOrder order)
+{
+    // The index is already in order, so each patient's rank is its key and heapifying moves nothing.
+    ArrayList<DischargeEntry> entries;
+    entries.reserve(this->transactionList.getSize());
+    BPlusTreeIterator<HMS::PatientOrderKey, HMS::Patient *> iterator = this->client.patientManager->getSortedPatientIterator(order);
+    while (iterator.getData() != nullptr)
+    {
+        HMS::Patient *patient = *iterator.getData();
+        if (patient->transactionHook.isLinked())
+        {
+            entries.addNode({(long long)entries.getSize(), entries.getSize(), patient});
+        }
         iterator.next();
     }
+
+    this->dischargeQueue.assign(entries.begin(), entries.end());
+    this->page = 0;
 }
\ No newline at end of file
@@ -1,10 +1,11 @@
+#include <utility>
 #include "cores/treatment.h"
 
 using namespace HMS;
 
 Treatment::Treatment()
     : type(TreatmentType::Symptomatic),
-      otherType(""),
+      otherType(List::StringPool::EMPTY),
       appointment({0, 0, 0}),
       dayOfStay(0),
       priority(0),
@@ -21,16 +22,24 @@ TreatmentType Treatment::getTreatmentType()
 
 void Treatment::setOtherTreatmentType(std::string treatment)
 {
-    this->otherType = treatment;
+    this->otherType = List::StringPool::global().intern(treatment);
+};
+const std::string &Treatment::getOtherTreatmentType()
+{
+    return List::StringPool::global().get(this->otherType);
 };
-std::string Treatment::getOtherTreatmentType()
+List::Symbol Treatment::getOtherTreatmentTypeSymbol()
 {
     return this->otherType;
 };
+void Treatment::setOtherTreatmentTypeSymbol(List::Symbol treatment)
+{
+    this->otherType = treatment;
+};
 
-std::string Treatment::getFormattedTreatmentType()
+const std::string &Treatment::getFormattedTreatmentType()
 {
-    return this->type == TreatmentType::Other ? this->otherType : TreatmentTypeLookUp[this->type];
+    return this->type == TreatmentType::Other ? this->getOtherTreatmentType() : TreatmentTypeLookUp[this->type];
 };
 
 void Treatment::setAppointment(Handler::Date appointment)
@@ -0,0 +1,78 @@
+#include <string>
+#include <thread>
+#include <vector>
+#include "cores/client.h"
+#include "managers/patientManager.h"
+#include "test.h"
+
+// Intake threads build patients, which takes admission dates from the pool shared by every patient, and submit
+// them while the menu thread drains the queue and adds dates to stored patients from the same pool.
+int main()
+{
+    const int producers = 4;
+    const int perProducer = 500;
+    HMS::Client client;
+    Manager::PatientManager *patientManager = client.patientManager;
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; producer++)
+    {
+        threads.emplace_back([patientManager, producer]()
+                             {
+                                 for (int i = 0; i < perProducer; i++)
+                                 {
+                                     HMS::Patient patient(patientManager->generatePatientId());
+                                     patient.setName("Intake " + std::to_string(producer));
+                                     patient.setStatus(HMS::PatientStatus::Admitted);
+                                     patient.addAdmissionDate(Handler::Date(1 + i % 28, 1 + producer, 2024));
+
+                                     HMS::Treatment treatment;
+                                     treatment.setTreatmentType(HMS::TreatmentType::Hemostasis);
+                                     treatment.setAppointment(Handler::Date(1 + i % 28, 2 + producer, 2024));
+                                     treatment.setPriority(1 + i % 3);
+                                     patient.addTreatment(std::move(treatment));
+
+                                     while (!patientManager->submitAdmission(std::move(patient)))
+                                     {
+                                         std::this_thread::yield();
+                                     }
+                                 } });
+    }
+
+    int added = 0;
+    while (added < producers * perProducer)
+    {
+        added += patientManager->drainAdmissions(50);
+        if (added > 0)
+        {
+            HMS::Patient *patient = patientManager->getPatient(Test::randomInt(0, added - 1));
+            patient->addDischargeDate(Handler::Date(1, 12, 2024));
+        }
+        std::this_thread::yield();
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(patientManager->getPatientSize() == producers * perProducer);
+    CHECK(patientManager->getIdIndex() == producers * perProducer);
+    for (int id = 1; id <= producers * perProducer; id++)
+    {
+        HMS::Patient *patient;
+        CHECK(patientManager->getPatientById(patient, id) == patientManager->noErrorCode());
+        CHECK(patient->getId() == id);
+        CHECK(patient->getLatestTreatment() != nullptr);
+        int admissions = 0;
+        for (Handler::Date &admission : patient->getAdmissionsIterator())
+        {
+            CHECK(admission.getYear() == 2024);
+            admissions++;
+        }
+        CHECK(admissions == 1);
+    }
+    CHECK(patientManager->getPatientCount(HMS::PatientStatus::Admitted) == producers * perProducer);
+
+    Test::pass("Concurrent admissions");
+    return 0;
+}
\ No newline at end of file
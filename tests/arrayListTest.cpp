@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "structs/arrayList.h"
+#include "structs/linkedList.h"
+#include "test.h"
+
+using namespace List;
+
+// Ordered and compared by key only. The text lives on the heap, so copies and moves on growth and erase are
+// checked too.
+struct Entry
+{
+    int key;
+    std::string text;
+
+    Entry(int key = 0, int tag = 0) : key(key), text(std::to_string(tag) + std::string(24, '.')) {}
+
+    bool operator<(const Entry &other) const { return this->key < other.key; }
+    bool operator==(const Entry &other) const { return this->key == other.key; }
+};
+
+// Orders entries by key, highest first.
+static bool byKeyDescending(Entry &entry, Entry &other)
+{
+    return entry.key > other.key;
+}
+
+namespace List
+{
+    // Sort key of byKeyDescending, so sortNodes<byKeyDescending>() sorts keys instead of calling it.
+    template <>
+    struct SortKey<&byKeyDescending>
+    {
+        static const bool enabled = true;
+
+        static int key(Entry &entry)
+        {
+            return -entry.key;
+        }
+    };
+}
+
+// Checks the list holds the same elements as the vector, in the same order, through every way of reading it.
+static void checkSame(ArrayList<Entry> &list, std::vector<Entry> &model)
+{
+    CHECK(list.getSize() == (int)model.size());
+    CHECK(list.isEmpty() == model.empty());
+    CHECK(list.end() - list.begin() == (long)model.size());
+    int index = 0;
+    ArrayIterator<Entry> iterator = list.iterate();
+    while (iterator.getData() != nullptr)
+    {
+        CHECK(iterator.getData() == list.getData(index));
+        CHECK(iterator.getData()->key == model[index].key && iterator.getData()->text == model[index].text);
+        iterator.next();
+        index++;
+    }
+    CHECK(index == (int)model.size());
+}
+
+// Checks a call throws std::out_of_range.
+template <class F>
+static void checkThrows(F call)
+{
+    bool threw = false;
+    try
+    {
+        call();
+    }
+    catch (std::out_of_range &)
+    {
+        threw = true;
+    }
+    CHECK(threw);
+}
+
+// Appends in every way, deletes by index and by value, and looks up at random, against std::vector, growing
+// from empty past many reallocations.
+static void testAgainstVector()
+{
+    ArrayList<Entry> list;
+    std::vector<Entry> model;
+    for (int i = 0; i < 20000; i++)
+    {
+        int operation = Test::randomInt(0, 9);
+        int key = Test::randomInt(0, 100);
+        if (operation < 2)
+        {
+            Entry entry(key, i);
+            list.addNode(entry);
+            model.push_back(entry);
+        }
+        else if (operation < 4)
+        {
+            list.addNode(Entry(key, i));
+            model.push_back(Entry(key, i));
+        }
+        else if (operation < 6)
+        {
+            list.emplaceNode(key, i);
+            model.emplace_back(key, i);
+        }
+        else if (operation < 7 && !model.empty())
+        {
+            int index = Test::randomInt(0, (int)model.size() - 1);
+            list.deleteNode(index);
+            model.erase(model.begin() + index);
+        }
+        else if (operation < 8 && !model.empty())
+        {
+            Entry entry(key);
+            std::vector<Entry>::iterator match = std::find(model.begin(), model.end(), entry);
+            if (match == model.end())
+            {
+                checkThrows([&]()
+                            { list.deleteNode(entry); });
+                checkThrows([&]()
+                            { list.getData(entry); });
+            }
+            else
+            {
+                CHECK(list.getData(entry) == list.getData((int)(match - model.begin())));
+                list.deleteNode(entry);
+                model.erase(match);
+            }
+        }
+        else if (!model.empty())
+        {
+            int index = Test::randomInt(0, (int)model.size() - 1);
+            CHECK(list.getData(index)->text == model[index].text);
+        }
+        if (i % 500 == 0)
+        {
+            checkSame(list, model);
+        }
+    }
+    checkSame(list, model);
+
+    checkThrows([&]()
+                { list.getData(-1); });
+    checkThrows([&]()
+                { list.getData(list.getSize()); });
+    checkThrows([&]()
+                { list.deleteNode(list.getSize()); });
+    list.reset();
+    model.clear();
+    checkSame(list, model);
+    checkThrows([&]()
+                { list.getData(0); });
+    checkThrows([&]()
+                { list.deleteNode(0); });
+    Entry entry(1);
+    checkThrows([&]()
+                { list.deleteNode(entry); });
+    CHECK(list.iterate().getData() == nullptr);
+}
+
+// Pointers to elements stay valid while appends fit in the reserved capacity, and an erase keeps the pointers to
+// the elements before it, while the ones after it shift down by one.
+static void testIteratorValidity()
+{
+    ArrayList<Entry> list;
+    list.reserve(1000);
+    list.addNode(Entry(0, 0));
+    Entry *first = list.getData(0);
+    ArrayList<Entry>::iterator begin = list.begin();
+    for (int i = 1; i < 1000; i++)
+    {
+        list.emplaceNode(i, i);
+        CHECK(list.getData(0) == first && list.begin() == begin);
+    }
+    CHECK(list.end() == begin + 1000);
+
+    Entry *before = list.getData(499);
+    Entry *at = list.getData(500);
+    std::string next = list.getData(501)->text;
+    list.deleteNode(500);
+    CHECK(list.getData(499) == before && before->key == 499);
+    CHECK(list.getData(500) == at && at->text == next);
+    CHECK(list.getSize() == 999);
+
+    // Deleting every element from the back keeps the front in place.
+    while (list.getSize() > 1)
+    {
+        list.deleteNode(list.getSize() - 1);
+        CHECK(list.getData(0) == first && first->key == 0);
+    }
+}
+
+// Searches and sorts agree with std::copy_if and std::stable_sort, and a list assigned from a linked list holds
+// its elements in order.
+static void testSearchSortAssign()
+{
+    LinkedList<Entry> source;
+    std::vector<Entry> model;
+    for (int i = 0; i < 3000; i++)
+    {
+        int key = Test::randomInt(0, 40);
+        source.addNode(Entry(key, i));
+        model.push_back(Entry(key, i));
+    }
+    ArrayList<Entry> list;
+    list.assign(source);
+    checkSame(list, model);
+
+    for (int key = 0; key <= 41; key++)
+    {
+        std::vector<Entry> expected;
+        std::copy_if(model.begin(), model.end(), std::back_inserter(expected), [key](Entry &entry)
+                     { return entry.key == key; });
+        ArrayList<Entry> found;
+        list.searchNodes(found, Entry(key));
+        checkSame(found, expected);
+        ArrayList<Entry> compared;
+        list.searchNodes(compared, [](Entry &entry, int value)
+                         { return entry.key == value; },
+                         key);
+        checkSame(compared, expected);
+    }
+
+    std::vector<Entry> expected = model;
+    std::stable_sort(expected.begin(), expected.end());
+    list.sortNodes();
+    checkSame(list, expected);
+
+    std::stable_sort(expected.begin(), expected.end(), [](const Entry &entry, const Entry &other)
+                     { return entry.key > other.key; });
+    ArrayList<Entry> compared;
+    compared.assign(list);
+    compared.sortNodes(byKeyDescending);
+    checkSame(compared, expected);
+    list.sortNodes<byKeyDescending>();
+    checkSame(list, expected);
+}
+
+int main()
+{
+    testAgainstVector();
+    testIteratorValidity();
+    testSearchSortAssign();
+    Test::pass("ArrayList");
+    return 0;
+}
\ No newline at end of file
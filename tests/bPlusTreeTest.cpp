@@ -0,0 +1,126 @@
+#include <map>
+#include <vector>
+#include "structs/bPlusTree.h"
+#include "test.h"
+
+using namespace List;
+
+// Checks the tree iterates the same entries as the map, in key order.
+static void checkSame(BPlusTree<int, long> &tree, std::map<int, long> &model)
+{
+    CHECK(tree.getSize() == (int)model.size());
+    CHECK(tree.isEmpty() == model.empty());
+    BPlusTreeIterator<int, long> iterator = tree.iterate();
+    for (auto &entry : model)
+    {
+        CHECK(iterator.getData() != nullptr);
+        CHECK(iterator.getKey() == entry.first && *iterator.getData() == entry.second);
+        iterator.next();
+    }
+    CHECK(iterator.getData() == nullptr);
+}
+
+// Checks a range iterates the keys of the map from first to last, both included.
+static void checkRange(BPlusTree<int, long> &tree, std::map<int, long> &model, int first, int last)
+{
+    BPlusTreeIterator<int, long> iterator = tree.iterate(first, last);
+    for (auto entry = model.lower_bound(first); entry != model.upper_bound(last); entry++)
+    {
+        CHECK(iterator.getData() != nullptr);
+        CHECK(iterator.getKey() == entry->first && *iterator.getData() == entry->second);
+        iterator.next();
+    }
+    CHECK(iterator.getData() == nullptr);
+}
+
+// Inserts, replaces, removes and looks up at random, against std::map, with keys dense enough to merge nodes.
+static void testAgainstMap(int keyRange)
+{
+    BPlusTree<int, long> tree;
+    std::map<int, long> model;
+    for (int i = 0; i < 100000; i++)
+    {
+        int key = Test::randomInt(0, keyRange - 1);
+        int operation = Test::randomInt(0, 9);
+        if (operation < 5)
+        {
+            tree.insert(key, i);
+            model[key] = i;
+        }
+        else if (operation < 8)
+        {
+            CHECK(tree.remove(key) == (model.erase(key) > 0));
+        }
+        else
+        {
+            long *value = tree.find(key);
+            auto entry = model.find(key);
+            CHECK((value != nullptr) == (entry != model.end()));
+            CHECK(value == nullptr || *value == entry->second);
+        }
+    }
+    checkSame(tree, model);
+    for (int i = 0; i < 100; i++)
+    {
+        int first = Test::randomInt(-1, keyRange);
+        checkRange(tree, model, first, first + Test::randomInt(-1, keyRange / 4));
+    }
+
+    // Removing every key empties the tree.
+    for (auto &entry : model)
+    {
+        CHECK(tree.remove(entry.first));
+    }
+    model.clear();
+    checkSame(tree, model);
+    CHECK(!tree.remove(0));
+}
+
+// A bulk loaded tree behaves like one built by inserting, under later inserts and removes.
+static void testBulkLoad(int count)
+{
+    std::vector<int> keys;
+    std::vector<long> values;
+    std::map<int, long> model;
+    for (int i = 0; i < count; i++)
+    {
+        keys.push_back(i * 3);
+        values.push_back(i);
+        model[i * 3] = i;
+    }
+
+    BPlusTree<int, long> tree;
+    tree.insert(-1, -1);
+    tree.bulkLoad(keys.data(), values.data(), count);
+    checkSame(tree, model);
+
+    for (int i = 0; i < count; i++)
+    {
+        int key = Test::randomInt(0, count * 3);
+        if (Test::randomInt(0, 1) == 0)
+        {
+            tree.insert(key, -i);
+            model[key] = -i;
+        }
+        else
+        {
+            CHECK(tree.remove(key) == (model.erase(key) > 0));
+        }
+    }
+    checkSame(tree, model);
+
+    tree.reset();
+    CHECK(tree.isEmpty() && tree.find(0) == nullptr);
+}
+
+int main()
+{
+    testAgainstMap(50);
+    testAgainstMap(3000);
+    testAgainstMap(100000);
+    testBulkLoad(0);
+    testBulkLoad(1);
+    testBulkLoad(10000);
+    Test::pass("BPlusTree");
+    return 0;
+}
\ No newline at end of file
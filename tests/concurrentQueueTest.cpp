@@ -0,0 +1,146 @@
+#include <atomic>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+#include "structs/concurrentQueue.h"
+#include "test.h"
+
+using namespace List;
+
+// On one thread the queue behaves like a bounded FIFO queue.
+static void testSingleThread()
+{
+    ConcurrentQueue<std::string> queue(100);
+    CHECK(queue.getCapacity() == 128);
+
+    std::deque<std::string> model;
+    for (int i = 0; i < 100000; i++)
+    {
+        int operation = Test::randomInt(0, 9);
+        if (operation < 5)
+        {
+            std::string value = "patient " + std::to_string(i);
+            bool queued = queue.tryEnqueue(value);
+            CHECK(queued == ((int)model.size() < queue.getCapacity()));
+            if (queued)
+            {
+                model.push_back(value);
+            }
+        }
+        else if (operation < 9)
+        {
+            std::string value;
+            bool dequeued = queue.tryDequeue(value);
+            CHECK(dequeued == !model.empty());
+            if (dequeued)
+            {
+                CHECK(value == model.front());
+                model.pop_front();
+            }
+        }
+        else
+        {
+            int maxCount = Test::randomInt(0, 20);
+            int expected = std::min(maxCount, (int)model.size());
+            int drained = queue.drain([&](std::string &&value)
+                                      {
+                                          CHECK(value == model.front());
+                                          model.pop_front(); },
+                                      maxCount);
+            CHECK(drained == expected);
+        }
+        CHECK(queue.getSize() == (int)model.size());
+        CHECK(queue.isEmpty() == model.empty());
+    }
+}
+
+// Several producers and consumers hand over every value exactly once, each producer's values in order.
+static void testProducersConsumers(int producers, int consumers)
+{
+    const int perProducer = 20000;
+    ConcurrentQueue<std::string> queue(64);
+    std::vector<std::vector<int>> received(consumers);
+    std::atomic<int> remaining(producers * perProducer);
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; producer++)
+    {
+        threads.emplace_back([&queue, producer]()
+                             {
+                                 for (int i = 0; i < perProducer; i++)
+                                 {
+                                     // Long strings live on the heap, so moving them through the cells is checked too.
+                                     std::string value = std::to_string(producer * perProducer + i) + std::string(32, '.');
+                                     while (!queue.tryEnqueue(std::move(value)))
+                                     {
+                                         std::this_thread::yield();
+                                     }
+                                 } });
+    }
+    for (int consumer = 0; consumer < consumers; consumer++)
+    {
+        threads.emplace_back([&queue, &received, &remaining, consumer]()
+                             {
+                                 auto take = [&](std::string &&value)
+                                 {
+                                     received[consumer].push_back(std::stoi(value));
+                                     remaining--;
+                                 };
+                                 while (remaining > 0)
+                                 {
+                                     std::string value;
+                                     if (consumer % 2 == 0 && queue.tryDequeue(value))
+                                     {
+                                         take(std::move(value));
+                                     }
+                                     else if (queue.drain(take, 7) == 0)
+                                     {
+                                         std::this_thread::yield();
+                                     }
+                                 } });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<int> seen(producers * perProducer, 0);
+    for (std::vector<int> &values : received)
+    {
+        std::vector<int> last(producers, -1);
+        for (int value : values)
+        {
+            seen[value]++;
+            CHECK(value > last[value / perProducer]);
+            last[value / perProducer] = value;
+        }
+    }
+    for (int count : seen)
+    {
+        CHECK(count == 1);
+    }
+    CHECK(queue.isEmpty());
+}
+
+// Values left in the queue are destroyed with it.
+static void testLeftovers()
+{
+    ConcurrentQueue<std::string> queue(5);
+    for (int i = 0; i < queue.getCapacity(); i++)
+    {
+        CHECK(queue.tryEnqueue(std::string(40, 'a')));
+    }
+    CHECK(!queue.tryEnqueue(std::string("full")));
+}
+
+int main()
+{
+    testSingleThread();
+    testProducersConsumers(1, 1);
+    testProducersConsumers(4, 1);
+    testProducersConsumers(4, 3);
+    testLeftovers();
+    Test::pass("ConcurrentQueue");
+    return 0;
+}
\ No newline at end of file
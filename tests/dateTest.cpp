@@ -0,0 +1,179 @@
+#include <vector>
+#include "handlers/inputHandler.h"
+#include "test.h"
+
+using Handler::Date;
+
+// A date as the separate day, month and year fields dates were stored as before they were packed.
+struct Fields
+{
+    int day;
+    int month;
+    int year;
+};
+
+// The field-wise order dates had before they were packed: later first, the empty date 00/00/0000 last.
+static bool fieldsBefore(const Fields &date, const Fields &other)
+{
+    if (date.year != other.year)
+    {
+        return date.year > other.year;
+    }
+    if (date.month != other.month)
+    {
+        return date.month > other.month;
+    }
+    return date.day > other.day;
+}
+
+// Draws a valid date, or now and then the empty date.
+static Fields randomFields()
+{
+    if (Test::randomInt(0, 49) == 0)
+    {
+        return {0, 0, 0};
+    }
+    int year = Test::randomInt(0, 3) == 0 ? Test::randomInt(1, 9999) : Test::randomInt(2020, 2025);
+    int month = Test::randomInt(1, 12);
+    return {Test::randomInt(1, Handler::DaysInMonth[Handler::isLeapYear(year)][month]), month, year};
+}
+
+// Moves a date to the next day, one field at a time.
+static void nextDay(Fields &date)
+{
+    date.day++;
+    if (date.day > Handler::DaysInMonth[Handler::isLeapYear(date.year)][date.month])
+    {
+        date.day = 1;
+        date.month++;
+    }
+    if (date.month > 12)
+    {
+        date.month = 1;
+        date.year++;
+    }
+}
+
+// Every day from 01/01/0001 to 31/12/2400 is one more than the day before, and gives back its fields.
+static void testEveryDay()
+{
+    Fields fields = {1, 1, 1};
+    Date previous;
+    for (int ordinal = 1; fields.year <= 2400; ordinal++)
+    {
+        Date date(fields.day, fields.month, fields.year);
+        CHECK(date.getOrdinal() == ordinal);
+        CHECK(date - previous == 1 && previous - date == -1);
+        CHECK(date.getDay() == fields.day && date.getMonth() == fields.month && date.getYear() == fields.year);
+        CHECK(Date::fromOrdinal(ordinal) == date);
+        previous = date;
+        nextDay(fields);
+    }
+    Date empty;
+    CHECK(empty.getOrdinal() == 0 && empty.getDay() == 0 && empty.getMonth() == 0 && empty.getYear() == 0);
+    CHECK(empty.getFormattedDate() == "00/00/0000");
+}
+
+// Comparing packed dates gives the same order as comparing their fields, and subtracting them counts the days
+// walked from one to the other.
+static void testAgainstFields()
+{
+    for (int i = 0; i < 100000; i++)
+    {
+        Fields fields = randomFields();
+        Fields otherFields = Test::randomInt(0, 9) == 0 ? fields : randomFields();
+        Date date(fields.day, fields.month, fields.year);
+        Date other(otherFields.day, otherFields.month, otherFields.year);
+
+        bool before = fieldsBefore(fields, otherFields);
+        bool after = fieldsBefore(otherFields, fields);
+        bool same = !before && !after;
+        CHECK((date < other) == before);
+        CHECK((date > other) == after);
+        CHECK((date <= other) == (before || same));
+        CHECK((date >= other) == (after || same));
+        CHECK((date == other) == same);
+        CHECK((date != other) == !same);
+    }
+
+    for (int i = 0; i < 2000; i++)
+    {
+        Fields fields = randomFields();
+        if (fields.year == 0 || fields.year > 9000)
+        {
+            continue;
+        }
+        Fields walked = fields;
+        int days = Test::randomInt(0, 1500);
+        for (int j = 0; j < days; j++)
+        {
+            nextDay(walked);
+        }
+        Date first(fields.day, fields.month, fields.year);
+        Date last(walked.day, walked.month, walked.year);
+        CHECK(last - first == days);
+        CHECK(first - last == -days);
+    }
+}
+
+// Counts the dates within a range one by one.
+static int naiveCount(std::vector<Date> &dates, int offset, int count, Date first, Date last)
+{
+    int matches = 0;
+    for (int i = offset; i < offset + count; i++)
+    {
+        if (dates[i].getOrdinal() >= first.getOrdinal() && dates[i].getOrdinal() <= last.getOrdinal())
+        {
+            matches++;
+        }
+    }
+    return matches;
+}
+
+// countInRange agrees with a naive count for every length, so both the four-wide loop and the scalar tail are
+// checked, from unaligned starts, and for ranges that are empty, reversed or reach the extreme ordinals.
+static void testCountInRange()
+{
+    std::vector<Date> dates;
+    for (int i = 0; i < 1000; i++)
+    {
+        int kind = Test::randomInt(0, 9);
+        if (kind == 0)
+        {
+            dates.push_back(Date());
+        }
+        else if (kind == 1)
+        {
+            dates.push_back(Date(31, 12, 9999));
+        }
+        else
+        {
+            dates.push_back(Date(Test::randomInt(1, 28), Test::randomInt(1, 12), Test::randomInt(2022, 2024)));
+        }
+    }
+
+    for (int i = 0; i < 5000; i++)
+    {
+        int count = i < 200 ? i % 20 : Test::randomInt(0, 990);
+        int offset = Test::randomInt(0, 3);
+        Date first = dates[Test::randomInt(0, 999)];
+        Date last = Test::randomInt(0, 9) == 0 ? first : dates[Test::randomInt(0, 999)];
+        CHECK(Date::countInRange(dates.data() + offset, count, first, last) == naiveCount(dates, offset, count, first, last));
+    }
+
+    // The widest range counts every date, a reversed one none.
+    Date earliest;
+    Date latest = Date::fromOrdinal(Handler::toOrdinal(31, 12, 9999));
+    CHECK(Date::countInRange(dates.data(), 1000, earliest, latest) == 1000);
+    CHECK(Date::countInRange(dates.data(), 1000, latest, earliest) == 0);
+    CHECK(Date::countInRange(dates.data(), 0, earliest, latest) == 0);
+}
+
+int main()
+{
+    testEveryDay();
+    testAgainstFields();
+    testCountInRange();
+    Test::pass("Date");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "structs/hashMap.h"
+#include "test.h"
+
+using namespace List;
+
+// Sends every key to one of a few hashes, so long probe sequences and deleted slots are exercised.
+struct CollidingHash
+{
+    size_t operator()(int key) const { return key % 3; }
+};
+
+// Checks the map holds exactly the keys and values of the model.
+template <class K, class V, class H>
+static void checkSame(HashMap<K, V, H> &map, std::unordered_map<K, V> &model)
+{
+    CHECK(map.getSize() == (int)model.size());
+    CHECK(map.isEmpty() == model.empty());
+    for (auto &entry : model)
+    {
+        V *value = map.find(entry.first);
+        CHECK(value != nullptr && *value == entry.second);
+    }
+}
+
+// Inserts, replaces, removes and looks up at random, against std::unordered_map.
+template <class H>
+static void testAgainstMap(int keyRange)
+{
+    HashMap<int, std::string, H> map;
+    std::unordered_map<int, std::string> model;
+    for (int i = 0; i < 50000; i++)
+    {
+        int key = Test::randomInt(0, keyRange - 1);
+        int operation = Test::randomInt(0, 99);
+        if (operation < 45)
+        {
+            // Long values live on the heap, so moving slots on a rehash is checked too.
+            std::string value = std::to_string(i) + std::string(24, '.');
+            map.insert(key, value);
+            model[key] = value;
+        }
+        else if (operation < 75)
+        {
+            CHECK(map.remove(key) == (model.erase(key) > 0));
+        }
+        else if (operation < 99)
+        {
+            std::string *value = map.find(key);
+            auto entry = model.find(key);
+            CHECK(map.contains(key) == (entry != model.end()));
+            CHECK((value != nullptr) == (entry != model.end()));
+            CHECK(value == nullptr || *value == entry->second);
+        }
+        else if (Test::randomInt(0, 9) == 0)
+        {
+            map.reset();
+            model.clear();
+        }
+        else
+        {
+            map.reserve(Test::randomInt(0, keyRange));
+        }
+        CHECK(map.getSize() == (int)model.size());
+    }
+    checkSame(map, model);
+}
+
+// String keys hash through std::hash and compare by content.
+static void testStringKeys()
+{
+    HashMap<std::string, int> map;
+    std::unordered_map<std::string, int> model;
+    for (int i = 0; i < 20000; i++)
+    {
+        std::string key = "patient " + std::to_string(Test::randomInt(0, 2000));
+        if (Test::randomInt(0, 2) != 0)
+        {
+            map.insert(key, i);
+            model[key] = i;
+        }
+        else
+        {
+            CHECK(map.remove(key) == (model.erase(key) > 0));
+        }
+    }
+    checkSame(map, model);
+    CHECK(map.find("patient") == nullptr);
+}
+
+// Inserting a batch matches inserting its keys one after the other, repeated keys keeping the last value.
+static void testBatchInsert(int count)
+{
+    HashMap<int, int> map;
+    std::unordered_map<int, int> model;
+    map.insert(-1, -1);
+    model[-1] = -1;
+    std::vector<int> keys;
+    std::vector<int> values;
+    for (int i = 0; i < count; i++)
+    {
+        keys.push_back(Test::randomInt(-1, count));
+        values.push_back(i);
+        model[keys.back()] = i;
+    }
+    map.insert(keys.data(), values.data(), count);
+    checkSame(map, model);
+}
+
+int main()
+{
+    testAgainstMap<std::hash<int>>(50);
+    testAgainstMap<std::hash<int>>(20000);
+    testAgainstMap<CollidingHash>(300);
+    testStringKeys();
+    testBatchInsert(0);
+    testBatchInsert(5);
+    testBatchInsert(20000);
+    Test::pass("HashMap");
+    return 0;
+}
\ No newline at end of file
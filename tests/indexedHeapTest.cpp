@@ -0,0 +1,136 @@
+#include <functional>
+#include <map>
+#include <vector>
+#include "structs/indexedHeap.h"
+#include "test.h"
+
+using namespace List;
+
+// Gets the handle the heap should put first: the best priority, the smallest handle among equal priorities.
+template <class C>
+static int expectedFront(std::map<int, int> &model, C compare)
+{
+    auto best = model.begin();
+    for (auto entry = model.begin(); entry != model.end(); entry++)
+    {
+        if (compare(entry->second, best->second))
+        {
+            best = entry;
+        }
+    }
+    return best->first;
+}
+
+// Updates, removes, peeks and dequeues at random, against a map from handle to priority.
+template <int D, class C>
+static void testAgainstMap()
+{
+    IndexedHeap<int, int, D, C> heap;
+    std::map<int, int> model;
+    C compare;
+    for (int i = 0; i < 50000; i++)
+    {
+        int handle = Test::randomInt(0, 200);
+        int operation = Test::randomInt(0, 9);
+        if (operation < 4)
+        {
+            int priority = Test::randomInt(0, 5);
+            heap.update(handle, priority);
+            model[handle] = priority;
+        }
+        else if (operation < 6)
+        {
+            CHECK(heap.remove(handle) == (model.erase(handle) > 0));
+        }
+        else if (operation < 8)
+        {
+            int *priority = heap.getPriority(handle);
+            auto entry = model.find(handle);
+            CHECK(heap.contains(handle) == (entry != model.end()));
+            CHECK((priority != nullptr) == (entry != model.end()));
+            CHECK(priority == nullptr || *priority == entry->second);
+        }
+        else if (!model.empty())
+        {
+            int front = expectedFront(model, compare);
+            CHECK(*heap.peek() == front);
+            if (operation == 9)
+            {
+                heap.dequeue();
+                model.erase(front);
+            }
+        }
+        CHECK(heap.getSize() == (int)model.size());
+        CHECK(heap.isEmpty() == model.empty());
+    }
+
+    // Dequeuing everything gives the handles in priority order.
+    while (!model.empty())
+    {
+        int front = expectedFront(model, compare);
+        CHECK(*heap.peek() == front);
+        heap.dequeue();
+        model.erase(front);
+    }
+    CHECK(heap.isEmpty());
+
+    heap.update(1, 1);
+    heap.reset();
+    CHECK(heap.isEmpty() && !heap.contains(1));
+}
+
+// A bulk loaded heap dequeues in priority order and takes updates like one built by updating.
+template <int D, class C>
+static void testBulkLoad(int count)
+{
+    IndexedHeap<int, int, D, C> heap;
+    std::map<int, int> model;
+    C compare;
+    std::vector<int> handles;
+    std::vector<int> priorities;
+    for (int i = 0; i < count; i++)
+    {
+        handles.push_back(i * 2);
+        priorities.push_back(Test::randomInt(0, 5));
+        model[i * 2] = priorities.back();
+    }
+    heap.update(-1, 0);
+    heap.bulkLoad(handles.data(), priorities.data(), count);
+    CHECK(heap.getSize() == count && !heap.contains(-1));
+
+    for (int i = 0; i < count; i++)
+    {
+        int handle = Test::randomInt(0, count * 2);
+        if (Test::randomInt(0, 1) == 0)
+        {
+            heap.update(handle, Test::randomInt(0, 5));
+            model[handle] = *heap.getPriority(handle);
+        }
+        else
+        {
+            CHECK(heap.remove(handle) == (model.erase(handle) > 0));
+        }
+    }
+    while (!model.empty())
+    {
+        int front = expectedFront(model, compare);
+        CHECK(*heap.peek() == front);
+        heap.dequeue();
+        model.erase(front);
+    }
+    CHECK(heap.isEmpty());
+}
+
+int main()
+{
+    testAgainstMap<2, std::less<int>>();
+    testAgainstMap<4, std::less<int>>();
+    testAgainstMap<4, std::greater<int>>();
+    testAgainstMap<7, std::greater<int>>();
+    testBulkLoad<4, std::less<int>>(0);
+    testBulkLoad<4, std::less<int>>(1);
+    testBulkLoad<4, std::less<int>>(3000);
+    testBulkLoad<7, std::greater<int>>(3000);
+    Test::pass("IndexedHeap");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "structs/intrusiveList.h"
+#include "test.h"
+
+using namespace List;
+
+// An object that can be in two lists at once, one per hook.
+struct Entry
+{
+    int key;
+    IntrusiveHook<Entry> first;
+    IntrusiveHook<Entry> second;
+
+    Entry(int key) : key(key) {}
+
+    static bool compareKey(Entry &a, Entry &b) { return a.key < b.key; }
+    static bool compareKeyed(Entry &a, Entry &b) { return a.key < b.key; }
+};
+
+namespace List
+{
+    // Sorting by compareKeyed takes the keyed path of sortNodes.
+    template <>
+    struct SortKey<Entry::compareKeyed>
+    {
+        static const bool enabled = true;
+        static int key(Entry &data) { return data.key; }
+    };
+}
+
+typedef IntrusiveList<Entry, &Entry::first> FirstList;
+typedef IntrusiveList<Entry, &Entry::second> SecondList;
+
+// Checks the list links the same objects as the vector, in the same order.
+template <class L>
+static void checkSame(L &list, std::vector<Entry *> &model)
+{
+    CHECK(list.getSize() == (int)model.size());
+    CHECK(list.isEmpty() == model.empty());
+    CHECK(model.empty() || list.getFirst() == model.front());
+    int index = 0;
+    for (Entry &entry : list)
+    {
+        CHECK(&entry == model[index]);
+        index++;
+    }
+    CHECK(index == (int)model.size());
+}
+
+// Removes an object from a model list if it is there.
+static void forget(std::vector<Entry *> &model, Entry *entry)
+{
+    model.erase(std::remove(model.begin(), model.end(), entry), model.end());
+}
+
+// Links, unlinks, moves, sorts, copies and destroys objects at random, against vectors of pointers.
+static void testAgainstVectors()
+{
+    std::vector<std::unique_ptr<Entry>> objects;
+    FirstList lists[2];
+    SecondList other;
+    std::vector<Entry *> models[2];
+    std::vector<Entry *> otherModel;
+    for (int i = 0; i < 20000; i++)
+    {
+        int list = Test::randomInt(0, 1);
+        int operation = Test::randomInt(0, 9);
+        Entry *entry = objects.empty() ? nullptr : objects[Test::randomInt(0, (int)objects.size() - 1)].get();
+        if (operation < 3 || entry == nullptr)
+        {
+            objects.emplace_back(new Entry(Test::randomInt(0, 50)));
+            lists[list].addNode(*objects.back());
+            models[list].push_back(objects.back().get());
+            if (Test::randomInt(0, 1) == 0)
+            {
+                other.addNode(*objects.back());
+                otherModel.push_back(objects.back().get());
+            }
+        }
+        else if (operation < 4)
+        {
+            // Adding an object linked through the same hook moves it, whichever list it was in.
+            forget(models[0], entry);
+            forget(models[1], entry);
+            lists[list].addNode(*entry);
+            models[list].push_back(entry);
+        }
+        else if (operation < 5)
+        {
+            CHECK(lists[list].contains(*entry) == (std::find(models[list].begin(), models[list].end(), entry) != models[list].end()));
+            if (lists[list].contains(*entry))
+            {
+                lists[list].deleteNode(*entry);
+                forget(models[list], entry);
+            }
+        }
+        else if (operation < 6)
+        {
+            // Destroying an object unlinks it from every list.
+            forget(models[0], entry);
+            forget(models[1], entry);
+            forget(otherModel, entry);
+            objects.erase(std::find_if(objects.begin(), objects.end(), [entry](std::unique_ptr<Entry> &object)
+                                       { return object.get() == entry; }));
+        }
+        else if (operation < 7)
+        {
+            // Copies are unlinked and leave the original's links alone.
+            Entry copy(*entry);
+            CHECK(!copy.first.isLinked() && !copy.second.isLinked());
+            Entry assigned(0);
+            other.addNode(assigned);
+            assigned = *entry;
+            CHECK(other.contains(assigned));
+            CHECK(assigned.key == entry->key);
+        }
+        else
+        {
+            // The three sorts are stable and agree with each other.
+            int sort = Test::randomInt(0, 2);
+            if (sort == 0)
+            {
+                lists[list].sortNodes([](Entry &a, Entry &b)
+                                      { return a.key < b.key; });
+            }
+            else if (sort == 1)
+            {
+                lists[list].sortNodes<Entry::compareKey>();
+            }
+            else
+            {
+                lists[list].sortNodes<Entry::compareKeyed>();
+            }
+            std::stable_sort(models[list].begin(), models[list].end(), [](Entry *a, Entry *b)
+                             { return a->key < b->key; });
+        }
+        checkSame(lists[0], models[0]);
+        checkSame(lists[1], models[1]);
+        checkSame(other, otherModel);
+    }
+
+    // Resetting unlinks the objects without destroying them.
+    lists[0].reset();
+    for (Entry *entry : models[0])
+    {
+        CHECK(!entry->first.isLinked());
+    }
+    models[0].clear();
+    checkSame(lists[0], models[0]);
+}
+
+int main()
+{
+    testAgainstVectors();
+    Test::pass("IntrusiveList");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "structs/linkedList.h"
+#include "test.h"
+
+using namespace List;
+
+// LinkedList::MIN_RUN, the length short runs are extended to, which is not public.
+static const int MIN_RUN = 16;
+
+// Ordered by key only. The tag records the position before sorting, so the order of ties can be checked.
+struct Entry
+{
+    int key;
+    int tag;
+
+    bool operator<(const Entry &other) const { return this->key < other.key; }
+};
+
+// The shapes of input the run detection of the merge sort treats differently.
+enum Shape
+{
+    Presorted,        // One non-descending run
+    Reverse,          // One strictly descending run
+    ReverseWithTies,  // Descending with equal neighbours, which must end each reversed run
+    Sawtooth,         // Ascending runs of random length
+    ReverseSawtooth,  // Descending runs of random length
+    ManyEqualKeys,    // Three keys only
+    AllEqual,         // A single key
+    NearlySorted,     // Sorted, then a few elements swapped
+    Random,           // No order
+    ShapeSize
+};
+
+// Makes the keys of an input of a shape.
+static std::vector<int> makeKeys(Shape shape, int size)
+{
+    std::vector<int> keys(size);
+    int period = Test::randomInt(2, 64);
+    for (int i = 0; i < size; i++)
+    {
+        switch (shape)
+        {
+        case Presorted:
+            keys[i] = i / 3;
+            break;
+        case Reverse:
+            keys[i] = size - i;
+            break;
+        case ReverseWithTies:
+            keys[i] = (size - i) / 2;
+            break;
+        case Sawtooth:
+            keys[i] = i % period;
+            break;
+        case ReverseSawtooth:
+            keys[i] = period - i % period;
+            break;
+        case ManyEqualKeys:
+            keys[i] = Test::randomInt(0, 2);
+            break;
+        case AllEqual:
+            keys[i] = 7;
+            break;
+        case NearlySorted:
+            keys[i] = i;
+            break;
+        default:
+            keys[i] = Test::randomInt(0, size);
+            break;
+        }
+    }
+    if (shape == NearlySorted && size > 1)
+    {
+        for (int i = 0; i < 1 + size / 100; i++)
+        {
+            std::swap(keys[Test::randomInt(0, size - 1)], keys[Test::randomInt(0, size - 1)]);
+        }
+    }
+    return keys;
+}
+
+// Sorts an input of a shape on the serial path and checks the keys and the order of ties against std::stable_sort.
+// Inputs that are one run are sorted in a single pass, with at most one comparison per element.
+static void checkSort(Shape shape, int size)
+{
+    std::vector<int> keys = makeKeys(shape, size);
+    LinkedList<Entry> list;
+    std::vector<Entry> expected;
+    for (int i = 0; i < size; i++)
+    {
+        list.addNode(Entry{keys[i], i});
+        expected.push_back(Entry{keys[i], i});
+    }
+
+    int comparisons = 0;
+    list.sortNodes([&comparisons](Entry &a, Entry &b)
+                   {
+                       comparisons++;
+                       return a < b; });
+    std::stable_sort(expected.begin(), expected.end());
+
+    CHECK(list.getSize() == size);
+    int index = 0;
+    for (Entry &entry : list)
+    {
+        CHECK(index < size);
+        CHECK(entry.key == expected[index].key && entry.tag == expected[index].tag);
+        index++;
+    }
+    CHECK(index == size);
+    if (shape == Presorted || shape == Reverse || shape == AllEqual)
+    {
+        CHECK(comparisons <= size);
+    }
+
+    // The sorted list is still whole: it takes more nodes at its end and sorts again.
+    list.addNode(Entry{-1, size});
+    list.sortNodes();
+    CHECK(list.getSize() == size + 1);
+    CHECK(list.getData(0)->key == -1);
+}
+
+// Every shape at every size up to a few runs, so short runs, run extension and the run stack are all reached,
+// then at larger random sizes.
+static void testShapes()
+{
+    for (int shape = 0; shape < ShapeSize; shape++)
+    {
+        for (int size = 0; size <= 4 * MIN_RUN + 3; size++)
+        {
+            checkSort((Shape)shape, size);
+        }
+        for (int i = 0; i < 8; i++)
+        {
+            checkSort((Shape)shape, Test::randomInt(100, 5000));
+        }
+    }
+}
+
+int main()
+{
+    // Inputs stay below MIN_SEGMENT anyway; the cap makes sure only the serial merge sort runs.
+    ParallelSort::setMaxThreads(1);
+    testShapes();
+    Test::pass("LinkedList");
+    return 0;
+}
\ No newline at end of file
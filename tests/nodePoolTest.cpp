@@ -0,0 +1,123 @@
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "structs/nodePool.h"
+#include "structs/linkedList.h"
+#include "test.h"
+
+using namespace List;
+
+// Acquires and releases nodes at random, checking every live node keeps its data and no two share storage.
+static void testAcquireRelease()
+{
+    NodePool<std::string> pool;
+    std::vector<std::pair<Node<std::string> *, std::string>> live;
+    int acquired = 0;
+    int released = 0;
+    for (int i = 0; i < 50000; i++)
+    {
+        if (live.empty() || Test::randomInt(0, 2) != 0)
+        {
+            std::string value = "node " + std::to_string(i);
+            live.push_back({pool.acquire(value), value});
+            acquired++;
+        }
+        else
+        {
+            int index = Test::randomInt(0, (int)live.size() - 1);
+            pool.release(live[index].first);
+            live[index] = live.back();
+            live.pop_back();
+            released++;
+        }
+    }
+
+    std::set<Node<std::string> *> addresses;
+    for (auto &entry : live)
+    {
+        CHECK(entry.first->data == entry.second);
+        CHECK(addresses.insert(entry.first).second);
+    }
+
+    // Every release is reused by a later acquire unless the run ended first, and slabs grow geometrically.
+    CHECK(pool.getAllocations() == acquired);
+    CHECK(pool.getReuses() <= released);
+    CHECK(pool.getSlabAllocations() < 40);
+    CHECK(pool.getAllocationsAvoided() == acquired - pool.getSlabAllocations());
+
+    for (auto &entry : live)
+    {
+        pool.release(entry.first);
+    }
+}
+
+// Clearing rewinds to the first slab, so refilling the pool to the same size allocates no slab.
+static void testClear()
+{
+    NodePool<int> pool;
+    for (int i = 0; i < 10000; i++)
+    {
+        pool.acquire(i);
+    }
+    int slabs = pool.getSlabAllocations();
+
+    pool.clear();
+    for (int i = 0; i < 10000; i++)
+    {
+        CHECK(pool.acquire(i)->data == i);
+    }
+    CHECK(pool.getSlabAllocations() == slabs);
+
+    pool.releaseAll();
+    pool.acquire(1);
+    CHECK(pool.getSlabAllocations() == slabs + 1);
+}
+
+// Lists sharing one pool behave like lists with their own nodes.
+static void testSharedPool()
+{
+    NodePool<long> pool;
+    std::vector<LinkedList<long>> lists;
+    std::vector<std::vector<long>> models(4);
+    for (int i = 0; i < 4; i++)
+    {
+        lists.emplace_back(&pool);
+    }
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int list = Test::randomInt(0, 3);
+        if (models[list].empty() || Test::randomInt(0, 2) != 0)
+        {
+            long value = Test::randomInt(0, 1000);
+            lists[list].addNode(value);
+            models[list].push_back(value);
+        }
+        else
+        {
+            int index = Test::randomInt(0, (int)models[list].size() - 1);
+            lists[list].deleteNode(index);
+            models[list].erase(models[list].begin() + index);
+        }
+    }
+
+    for (int list = 0; list < 4; list++)
+    {
+        CHECK(lists[list].getSize() == (int)models[list].size());
+        int index = 0;
+        for (long value : lists[list])
+        {
+            CHECK(value == models[list][index++]);
+        }
+    }
+}
+
+int main()
+{
+    testAcquireRelease();
+    testClear();
+    testSharedPool();
+    Test::pass("NodePool");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <vector>
+#include "structs/linkedList.h"
+#include "structs/parallelSort.h"
+#include "test.h"
+
+using namespace List;
+
+// The most threads a sort is capped at.
+static const int MAX_THREADS = 8;
+
+// Ordered by key only. The tag records the position before sorting, so the order of ties can be checked.
+struct Entry
+{
+    int key;
+    int tag;
+
+    bool operator<(const Entry &other) const { return this->key < other.key; }
+};
+
+// A linked list that can be filled in linear time, since addNode walks to the end of the list on every call.
+class EntryList : public LinkedList<Entry>
+{
+public:
+    // Replaces the nodes with the entries, in order.
+    void assign(std::vector<Entry> &entries)
+    {
+        this->reset();
+        for (int i = (int)entries.size() - 1; i >= 0; i--)
+        {
+            Node<Entry> *node = this->createNode(entries[i]);
+            node->next = this->first;
+            this->first = node;
+            this->size++;
+        }
+    }
+};
+
+// Sizes around the points where one more thread gets a segment of MIN_SEGMENT, including uneven splits.
+static std::vector<int> sizesFor(int threads)
+{
+    const int segment = ParallelSort::MIN_SEGMENT;
+    std::vector<int> sizes = {0, 1, segment - 1, segment, 2 * segment - 1, 2 * segment + 1};
+    if (threads > 2)
+    {
+        sizes.push_back(threads * segment - 1);
+        sizes.push_back(threads * segment + threads - 1);
+    }
+    return sizes;
+}
+
+// Draws entries with few distinct keys, so most of them tie.
+static std::vector<Entry> randomEntries(int size)
+{
+    std::vector<Entry> entries(size);
+    int keys = Test::randomInt(0, 1) == 0 ? 3 : 1000;
+    for (int i = 0; i < size; i++)
+    {
+        entries[i] = Entry{Test::randomInt(0, keys - 1), i};
+    }
+    return entries;
+}
+
+// Checks sorted entries have the keys and the order of ties of std::stable_sort.
+static void checkSorted(std::vector<Entry> &entries, std::vector<Entry> &expected)
+{
+    CHECK(entries.size() == expected.size());
+    for (int i = 0; i < (int)entries.size(); i++)
+    {
+        CHECK(entries[i].key == expected[i].key && entries[i].tag == expected[i].tag);
+    }
+}
+
+// Under every thread cap, stableSort splits a range only as far as each thread gets MIN_SEGMENT elements,
+// and the segments sorted and merged concurrently give the result of std::stable_sort.
+static void testStableSort()
+{
+    for (int threads = 1; threads <= MAX_THREADS; threads++)
+    {
+        ParallelSort::setMaxThreads(threads);
+        CHECK(ParallelSort::getMaxThreads() == threads);
+        for (int size : sizesFor(threads))
+        {
+            int expectedThreads = std::max(1, std::min(threads, size / ParallelSort::MIN_SEGMENT));
+            CHECK(ParallelSort::threadsFor(size) == expectedThreads);
+
+            std::vector<Entry> entries = randomEntries(size);
+            std::vector<Entry> expected = entries;
+            ParallelSort::stableSort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b)
+                                     { return a < b; });
+            std::stable_sort(expected.begin(), expected.end());
+            checkSorted(entries, expected);
+        }
+    }
+}
+
+// Under every thread cap, a linked list sort, which switches to parallelSortList past MIN_SEGMENT nodes per
+// thread, gives the result of std::stable_sort.
+static void testParallelSortList()
+{
+    EntryList list;
+    for (int threads = 1; threads <= MAX_THREADS; threads++)
+    {
+        ParallelSort::setMaxThreads(threads);
+        for (int size : sizesFor(threads))
+        {
+            std::vector<Entry> expected = randomEntries(size);
+            list.assign(expected);
+            list.sortNodes([](Entry &a, Entry &b)
+                           { return a < b; });
+            std::stable_sort(expected.begin(), expected.end());
+
+            std::vector<Entry> entries(list.begin(), list.end());
+            CHECK(list.getSize() == size);
+            checkSorted(entries, expected);
+        }
+    }
+}
+
+int main()
+{
+    testStableSort();
+    testParallelSortList();
+    ParallelSort::setMaxThreads(0);
+    CHECK(ParallelSort::getMaxThreads() == 0);
+    Test::pass("ParallelSort");
+    return 0;
+}
\ No newline at end of file
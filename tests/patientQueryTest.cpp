@@ -0,0 +1,325 @@
+#include <cctype>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+#include "cores/client.h"
+#include "cores/patientQuery.h"
+#include "managers/patientManager.h"
+#include "test.h"
+
+using Predicate = std::function<bool(HMS::Patient &)>;
+
+// Names the patients are given; "Nobody" is only ever searched for.
+static const char *NAMES[] = {"", "Ann", "ann", "Annabel", "Bob", "Zed", "Nobody"};
+static const int NAME_COUNT = 7;
+
+// Other treatment types the treatments are given; "Unknown" is only ever searched for.
+static const char *OTHER_TYPES[] = {"Checkup", "X ray", "Unknown"};
+
+// A random query, as text, as the brute-force predicate it should agree with, and as built with the operators.
+struct RandomQuery
+{
+    std::string text;
+    Predicate predicate;
+    HMS::PatientQuery query;
+};
+
+// Builds patients with random names, statuses and treatments, some without any treatment.
+static std::vector<HMS::Patient> randomPatients(int count)
+{
+    std::vector<HMS::Patient> patients;
+    for (int i = 0; i < count; i++)
+    {
+        HMS::Patient patient(i + 1);
+        patient.setName(NAMES[Test::randomInt(0, NAME_COUNT - 2)]);
+        patient.setStatus((HMS::PatientStatus)Test::randomInt(0, HMS::PatientStatusSize - 1));
+        for (int j = Test::randomInt(0, 2); j > 0; j--)
+        {
+            HMS::Treatment treatment;
+            treatment.setTreatmentType((HMS::TreatmentType)Test::randomInt(0, HMS::TreatmentTypeSize - 1));
+            if (treatment.getTreatmentType() == HMS::TreatmentType::Other)
+            {
+                treatment.setOtherTreatmentType(OTHER_TYPES[Test::randomInt(0, 1)]);
+            }
+            treatment.setAppointment(Handler::Date(Test::randomInt(1, 28), Test::randomInt(1, 2), 2024));
+            treatment.setDayOfStay(Test::randomInt(0, 9));
+            treatment.setPriority(Test::randomInt(1, 5));
+            patient.addTreatment(std::move(treatment));
+        }
+        patients.push_back(std::move(patient));
+    }
+    return patients;
+}
+
+// Randomizes the case of the ASCII letters of a text.
+static std::string randomCase(std::string text)
+{
+    for (char &c : text)
+    {
+        c = Test::randomInt(0, 1) == 0 ? std::tolower((unsigned char)c) : std::toupper((unsigned char)c);
+    }
+    return text;
+}
+
+// Writes a date as DD/MM/YYYY.
+static std::string formatDate(int day, int month, int year)
+{
+    char text[11];
+    std::snprintf(text, sizeof(text), "%02d/%02d/%04d", day, month, year);
+    return text;
+}
+
+// Checks a name criterion the slow way.
+static bool nameMatches(const std::string &name, const std::string &text, bool prefix, bool ignoreCase)
+{
+    if (name.size() < text.size() || (!prefix && name.size() != text.size()))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < text.size(); i++)
+    {
+        bool same = ignoreCase ? std::tolower((unsigned char)name[i]) == std::tolower((unsigned char)text[i]) : name[i] == text[i];
+        if (!same)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Draws a single criterion.
+static RandomQuery randomCriterion()
+{
+    switch (Test::randomInt(0, 5))
+    {
+    case 0:
+    {
+        std::string name = NAMES[Test::randomInt(1, NAME_COUNT - 1)];
+        bool ignoreCase = Test::randomInt(0, 1) == 0;
+        bool prefix = Test::randomInt(0, 1) == 0;
+        if (prefix)
+        {
+            name = name.substr(0, Test::randomInt(1, (int)name.size()));
+        }
+        std::string text = std::string("name") + (ignoreCase ? "~" : "=") + name + (prefix ? "*" : "");
+        return {text, [=](HMS::Patient &patient)
+                { return nameMatches(patient.getName(), name, prefix, ignoreCase); },
+                HMS::PatientQuery::name(name, prefix, ignoreCase)};
+    }
+    case 1:
+    {
+        HMS::PatientStatus status = (HMS::PatientStatus)Test::randomInt(0, HMS::PatientStatusSize - 1);
+        return {"status=" + randomCase(HMS::PatientStatusLookUp[status]), [=](HMS::Patient &patient)
+                { return patient.getStatus() == status; },
+                HMS::PatientQuery::status(status)};
+    }
+    case 2:
+    {
+        // A preset type, or an other treatment type, quoted when it has a space.
+        if (Test::randomInt(0, 1) == 0)
+        {
+            HMS::TreatmentType type = (HMS::TreatmentType)Test::randomInt(0, HMS::TreatmentTypeSize - 1);
+            return {"type=" + randomCase(HMS::TreatmentTypeLookUp[type]), [=](HMS::Patient &patient)
+                    { HMS::Treatment *latest = patient.getLatestTreatment();
+                      return latest != nullptr && latest->getTreatmentType() == type; },
+                    HMS::PatientQuery::treatmentType(type)};
+        }
+        std::string otherType = OTHER_TYPES[Test::randomInt(0, 2)];
+        return {"type=\"" + otherType + "\"", [=](HMS::Patient &patient)
+                { HMS::Treatment *latest = patient.getLatestTreatment();
+                  return latest != nullptr && latest->getTreatmentType() == HMS::TreatmentType::Other &&
+                         latest->getOtherTreatmentType() == otherType; },
+                HMS::PatientQuery::treatmentType(HMS::TreatmentType::Other, otherType)};
+    }
+    case 3:
+    {
+        int min = Test::randomInt(0, 6);
+        int max = Test::randomInt(0, 6);
+        return {"priority=" + std::to_string(min) + ".." + std::to_string(max), [=](HMS::Patient &patient)
+                { HMS::Treatment *latest = patient.getLatestTreatment();
+                  return latest != nullptr && latest->getPriority() >= min && latest->getPriority() <= max; },
+                HMS::PatientQuery::priority(min, max)};
+    }
+    case 4:
+    {
+        int firstDay = Test::randomInt(1, 28);
+        int lastDay = Test::randomInt(1, 28);
+        int firstMonth = Test::randomInt(1, 2);
+        int lastMonth = Test::randomInt(1, 2);
+        Handler::Date first(firstDay, firstMonth, 2024);
+        Handler::Date last(lastDay, lastMonth, 2024);
+        int firstOrdinal = first.getOrdinal();
+        int lastOrdinal = last.getOrdinal();
+        return {"appointment=" + formatDate(firstDay, firstMonth, 2024) + ".." + formatDate(lastDay, lastMonth, 2024),
+                [=](HMS::Patient &patient)
+                { HMS::Treatment *latest = patient.getLatestTreatment();
+                  return latest != nullptr && latest->getAppointment().getOrdinal() >= firstOrdinal &&
+                         latest->getAppointment().getOrdinal() <= lastOrdinal; },
+                HMS::PatientQuery::appointment(first, last)};
+    }
+    default:
+    {
+        // A single value is a range of one.
+        int min = Test::randomInt(0, 9);
+        int max = Test::randomInt(0, 1) == 0 ? min : Test::randomInt(0, 9);
+        std::string range = min == max ? std::to_string(min) : std::to_string(min) + ".." + std::to_string(max);
+        return {"stay=" + range, [=](HMS::Patient &patient)
+                { HMS::Treatment *latest = patient.getLatestTreatment();
+                  return latest != nullptr && latest->getDayOfStay() >= min && latest->getDayOfStay() <= max; },
+                HMS::PatientQuery::dayOfStay(min, max)};
+    }
+    }
+}
+
+// Draws a query of criteria combined with and, or and not, up to a depth.
+static RandomQuery randomQuery(int depth)
+{
+    int kind = depth == 0 ? 3 : Test::randomInt(0, 3);
+    if (kind == 3)
+    {
+        return randomCriterion();
+    }
+    if (kind == 2)
+    {
+        RandomQuery inner = randomQuery(depth - 1);
+        Predicate predicate = inner.predicate;
+        return {randomCase("not") + " " + inner.text, [=](HMS::Patient &patient)
+                { return !predicate(patient); },
+                !inner.query};
+    }
+
+    RandomQuery left = randomQuery(depth - 1);
+    RandomQuery right = randomQuery(depth - 1);
+    Predicate leftPredicate = left.predicate;
+    Predicate rightPredicate = right.predicate;
+    if (kind == 0)
+    {
+        return {"(" + left.text + " " + randomCase("and") + " " + right.text + ")", [=](HMS::Patient &patient)
+                { return leftPredicate(patient) && rightPredicate(patient); },
+                left.query && right.query};
+    }
+    return {"(" + left.text + " or " + right.text + ")", [=](HMS::Patient &patient)
+            { return leftPredicate(patient) || rightPredicate(patient); },
+            left.query || right.query};
+}
+
+// Random queries, parsed and built with the operators, match the same patients as a brute-force check.
+static void testAgainstPredicate()
+{
+    std::vector<HMS::Patient> patients = randomPatients(200);
+    for (int i = 0; i < 2000; i++)
+    {
+        RandomQuery random = randomQuery(Test::randomInt(0, 4));
+        HMS::PatientQuery parsed;
+        CHECK(HMS::PatientQuery::parse(random.text, parsed));
+        for (HMS::Patient &patient : patients)
+        {
+            bool expected = random.predicate(patient);
+            CHECK(parsed.matches(patient) == expected);
+            CHECK(random.query.matches(patient) == expected);
+        }
+    }
+
+    // The default query matches every patient.
+    HMS::PatientQuery all;
+    CHECK(all.matches(patients[0]));
+    CHECK(!(!all).matches(patients[0]));
+}
+
+// Malformed text is rejected and leaves the query as it was; a type that is not a preset is an other treatment type.
+static void testMalformed()
+{
+    const char *malformed[] = {
+        "", "   ", "status", "status=", "status=unknown", "status~admitted", "name=", "name~", "name=\"\"",
+        "name=\"Ann", "priority=a", "priority=1..", "priority=..2", "priority=1234567890", "priority=-1",
+        "stay~3", "appointment=31/02/2024", "appointment=1/1/2024", "appointment=01/01/1899",
+        "appointment=01/13/2024", "foo=1", "(status=admitted", "status=admitted)", "()",
+        "status=admitted and", "and status=admitted", "not", "status=admitted or or status=discharged",
+        "status=admitted andstatus=discharged", "status=admitted status=discharged"};
+    HMS::Patient patient(1);
+    patient.setStatus(HMS::PatientStatus::Discharged);
+    for (const char *text : malformed)
+    {
+        HMS::PatientQuery query = HMS::PatientQuery::status(HMS::PatientStatus::Discharged);
+        CHECK(!HMS::PatientQuery::parse(text, query));
+        CHECK(query.matches(patient));
+    }
+
+    // An unknown type parses as an other treatment type, which no treatment has yet.
+    HMS::PatientQuery unknown;
+    CHECK(HMS::PatientQuery::parse("type=Acupuncture", unknown));
+    HMS::Treatment treatment;
+    treatment.setTreatmentType(HMS::TreatmentType::Other);
+    treatment.setOtherTreatmentType("Checkup");
+    patient.addTreatment(treatment);
+    CHECK(!unknown.matches(patient));
+
+    HMS::PatientQuery other;
+    CHECK(HMS::PatientQuery::parse("TYPE=other", other));
+    CHECK(other.matches(patient));
+}
+
+// A name missing from the string pool compiles to a failing test, and the query compiles again once the pool grows.
+static void testRecompileOnPoolGrowth()
+{
+    HMS::PatientQuery byName = HMS::PatientQuery::name("Quentin Query");
+    HMS::PatientQuery byType = HMS::PatientQuery::treatmentType(HMS::TreatmentType::Other, "Query therapy");
+    HMS::Patient before(1);
+    before.setName("Ann");
+    CHECK(!byName.matches(before));
+    CHECK(!byType.matches(before));
+
+    // Interning the texts grows the pool, so the failing tests are resolved on the next match.
+    HMS::Patient after(2);
+    after.setName("Quentin Query");
+    HMS::Treatment treatment;
+    treatment.setTreatmentType(HMS::TreatmentType::Other);
+    treatment.setOtherTreatmentType("Query therapy");
+    after.addTreatment(treatment);
+    byName.compile();
+    byType.compile();
+    CHECK(byName.matches(after));
+    CHECK(byType.matches(after));
+    CHECK(!byName.matches(before));
+}
+
+// Queries are cached by text: a repeated text reuses the compiled query, until the cache fills and is emptied.
+static void testCache()
+{
+    HMS::Client client;
+    Manager::PatientManager *patientManager = client.patientManager;
+    HMS::Patient patient(1);
+    patient.setStatus(HMS::PatientStatus::Admitted);
+
+    // The cached query is swapped for one matching nothing, so a hit can be told from a new parse.
+    HMS::PatientQuery *query;
+    CHECK(patientManager->getQuery("status=admitted", query) == patientManager->noErrorCode());
+    CHECK(query->matches(patient));
+    *query = !HMS::PatientQuery();
+    CHECK(patientManager->getQuery("status=admitted", query) == patientManager->noErrorCode());
+    CHECK(!query->matches(patient));
+
+    // Invalid text is not cached, and the cache holds its capacity before it is emptied.
+    CHECK(patientManager->getQuery("status=", query) != patientManager->noErrorCode());
+    for (int i = 1; i < Manager::QueryCacheCapacity; i++)
+    {
+        CHECK(patientManager->getQuery("priority=" + std::to_string(i), query) == patientManager->noErrorCode());
+    }
+    CHECK(patientManager->getQuery("status=admitted", query) == patientManager->noErrorCode());
+    CHECK(!query->matches(patient));
+
+    CHECK(patientManager->getQuery("priority=0", query) == patientManager->noErrorCode());
+    CHECK(patientManager->getQuery("status=admitted", query) == patientManager->noErrorCode());
+    CHECK(query->matches(patient));
+}
+
+int main()
+{
+    testAgainstPredicate();
+    testMalformed();
+    testRecompileOnPoolGrowth();
+    testCache();
+    Test::pass("PatientQuery");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,319 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "cores/client.h"
+#include "cores/patientSnapshot.h"
+#include "managers/patientManager.h"
+#include "test.h"
+
+// Paths of the snapshots the test writes, under the build directory.
+static const char *SNAPSHOT_PATH = "build/tests/patientSnapshotTest.snapshot";
+static const char *CORRUPT_PATH = "build/tests/patientSnapshotTest.corrupt";
+
+// Adds patients with random names, statuses, treatments and dates. Some generated IDs are left unused, so the
+// ID counter ends past the last patient.
+static void addRandomPatients(Manager::PatientManager *patientManager, int count)
+{
+    const char *names[] = {"", "Ann", "ann", "Annabel", "Bob", "Zed"};
+    const char *otherTypes[] = {"Checkup", "X ray"};
+    for (int i = 0; i < count; i++)
+    {
+        int id = patientManager->generatePatientId();
+        if (Test::randomInt(0, 3) == 0)
+        {
+            continue;
+        }
+
+        HMS::Patient patient(id);
+        patient.setName(names[Test::randomInt(0, 5)]);
+        patient.setStatus((HMS::PatientStatus)Test::randomInt(0, 1));
+        for (int j = Test::randomInt(0, 4); j > 0; j--)
+        {
+            HMS::Treatment treatment;
+            treatment.setTreatmentType((HMS::TreatmentType)Test::randomInt(0, 4));
+            if (Test::randomInt(0, 2) == 0)
+            {
+                treatment.setOtherTreatmentType(otherTypes[Test::randomInt(0, 1)]);
+            }
+            treatment.setAppointment(Handler::Date(Test::randomInt(1, 3), 1, 2024));
+            treatment.setDayOfStay(Test::randomInt(0, 3));
+            treatment.setPriority(Test::randomInt(1, 3));
+            if (Test::randomInt(0, 1) == 0)
+            {
+                treatment.setCompleted();
+            }
+            patient.addTreatment(std::move(treatment));
+        }
+        for (int j = Test::randomInt(0, 2); j > 0; j--)
+        {
+            patient.addAdmissionDate(Handler::Date(Test::randomInt(1, 3), 2, 2024));
+        }
+        for (int j = Test::randomInt(0, 2); j > 0; j--)
+        {
+            patient.addDischargeDate(Handler::Date(Test::randomInt(1, 3), 3, 2024));
+        }
+        patientManager->addPatient(std::move(patient));
+    }
+}
+
+// Checks two dates lists hold the same dates in the same order.
+static void checkSameDates(Iterator<Handler::Date> dates, Iterator<Handler::Date> expected)
+{
+    std::vector<int> ordinals;
+    for (Handler::Date &date : dates)
+    {
+        ordinals.push_back(date.getOrdinal());
+    }
+    std::vector<int> expectedOrdinals;
+    for (Handler::Date &date : expected)
+    {
+        expectedOrdinals.push_back(date.getOrdinal());
+    }
+    CHECK(ordinals == expectedOrdinals);
+}
+
+// Checks two patients agree on every field, treatments and dates in the same order.
+static void checkSamePatient(HMS::Patient &patient, HMS::Patient &expected)
+{
+    CHECK(patient.getId() == expected.getId());
+    CHECK(patient.getName() == expected.getName());
+    CHECK(patient.getStatus() == expected.getStatus());
+
+    UnrolledIterator<HMS::Treatment, HMS::TreatmentChunkSize> treatments = patient.getTreatmentIterator();
+    for (HMS::Treatment &treatment : expected.getTreatmentIterator())
+    {
+        CHECK(treatments.getData() != nullptr);
+        HMS::Treatment &loaded = *treatments.getData();
+        CHECK(loaded.getTreatmentType() == treatment.getTreatmentType());
+        CHECK(loaded.getOtherTreatmentType() == treatment.getOtherTreatmentType());
+        CHECK(loaded.getAppointment().getOrdinal() == treatment.getAppointment().getOrdinal());
+        CHECK(loaded.getDayOfStay() == treatment.getDayOfStay());
+        CHECK(loaded.getPriority() == treatment.getPriority());
+        CHECK(loaded.isCompleted() == treatment.isCompleted());
+        treatments.next();
+    }
+    CHECK(treatments.getData() == nullptr);
+
+    checkSameDates(patient.getAdmissionsIterator(), expected.getAdmissionsIterator());
+    checkSameDates(patient.getDischargesIterator(), expected.getDischargesIterator());
+}
+
+// Checks two managers hold the same patients, and that the indexes built on load answer like the expected ones.
+static void checkSame(Manager::PatientManager *patientManager, Manager::PatientManager *expected)
+{
+    CHECK(patientManager->getPatientSize() == expected->getPatientSize());
+    Iterator<HMS::Patient> patients = patientManager->getPatientListIterator();
+    for (HMS::Patient &patient : expected->getPatientListIterator())
+    {
+        CHECK(patients.getData() != nullptr);
+        checkSamePatient(*patients.getData(), patient);
+
+        HMS::Patient *found;
+        CHECK(patientManager->getPatientById(found, patient.getId()) == patientManager->noErrorCode());
+        CHECK(found == patients.getData());
+        patients.next();
+    }
+    CHECK(patients.getData() == nullptr);
+
+    for (int status = 0; status < HMS::PatientStatusSize; status++)
+    {
+        CHECK(patientManager->getPatientCount((HMS::PatientStatus)status) == expected->getPatientCount((HMS::PatientStatus)status));
+    }
+    for (int type = 0; type < HMS::TreatmentTypeSize; type++)
+    {
+        CHECK(patientManager->getPatientCount((HMS::TreatmentType)type) == expected->getPatientCount((HMS::TreatmentType)type));
+    }
+    for (int order = 0; order < HMS::PatientOrderSize; order++)
+    {
+        BPlusTreeIterator<HMS::PatientOrderKey, HMS::Patient *> sorted = patientManager->getSortedPatientIterator((HMS::PatientOrder)order);
+        BPlusTreeIterator<HMS::PatientOrderKey, HMS::Patient *> expectedSorted = expected->getSortedPatientIterator((HMS::PatientOrder)order);
+        while (expectedSorted.getData() != nullptr)
+        {
+            CHECK(sorted.getData() != nullptr && (*sorted.getData())->getId() == (*expectedSorted.getData())->getId());
+            sorted.next();
+            expectedSorted.next();
+        }
+        CHECK(sorted.getData() == nullptr);
+    }
+
+    HMS::Patient *next = patientManager->getNextTriagePatient();
+    HMS::Patient *expectedNext = expected->getNextTriagePatient();
+    CHECK((next == nullptr) == (expectedNext == nullptr));
+    CHECK(next == nullptr || next->getId() == expectedNext->getId());
+    for (const char *name : {"ann", "Ann", "Bob", "Zed", ""})
+    {
+        View<HMS::Patient> found;
+        View<HMS::Patient> expectedFound;
+        CHECK(patientManager->searchPatientsByName(found, name, true, true) == expected->searchPatientsByName(expectedFound, name, true, true));
+    }
+}
+
+// Reads a whole file.
+static std::string readFile(const char *path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// Writes a whole file.
+static void writeFile(const char *path, const std::string &data)
+{
+    std::ofstream(path, std::ios::binary) << data;
+}
+
+// A snapshot loads back every field of every patient, into a new client and over a manager already holding patients.
+static void testRoundTrip()
+{
+    for (int round = 0; round < 20; round++)
+    {
+        HMS::Client client;
+        addRandomPatients(client.patientManager, Test::randomInt(0, 300));
+        CHECK(client.patientManager->saveSnapshot(SNAPSHOT_PATH) == client.patientManager->noErrorCode());
+
+        HMS::Client loaded(SNAPSHOT_PATH);
+        CHECK(loaded.errorHandler.getErrorSize() == 0);
+        CHECK(loaded.patientManager->getIdIndex() == client.patientManager->getIdIndex());
+        checkSame(loaded.patientManager, client.patientManager);
+
+        HMS::Client reloaded;
+        addRandomPatients(reloaded.patientManager, Test::randomInt(0, 50));
+        int idIndex = std::max(reloaded.patientManager->getIdIndex(), client.patientManager->getIdIndex());
+        CHECK(reloaded.patientManager->loadSnapshot(SNAPSHOT_PATH) == reloaded.patientManager->noErrorCode());
+        CHECK(reloaded.patientManager->getIdIndex() == idIndex);
+        checkSame(reloaded.patientManager, client.patientManager);
+    }
+}
+
+// Truncated and corrupted snapshots are rejected, and the manager keeps the patients it held.
+static void testCorruptRejected()
+{
+    HMS::Client source;
+    addRandomPatients(source.patientManager, 40);
+    source.patientManager->saveSnapshot(SNAPSHOT_PATH);
+    std::string data = readFile(SNAPSHOT_PATH);
+
+    HMS::Client client;
+    addRandomPatients(client.patientManager, 20);
+    client.patientManager->saveSnapshot(CORRUPT_PATH);
+    HMS::Client expected(CORRUPT_PATH);
+    Manager::PatientManager *patientManager = client.patientManager;
+
+    auto checkRejected = [&](const std::string &corrupt)
+    {
+        writeFile(CORRUPT_PATH, corrupt);
+        CHECK(patientManager->loadSnapshot(CORRUPT_PATH) != patientManager->noErrorCode());
+        CHECK(patientManager->getIdIndex() == expected.patientManager->getIdIndex());
+        checkSame(patientManager, expected.patientManager);
+    };
+
+    for (size_t size = 0; size < data.size(); size += 1 + size / 50)
+    {
+        checkRejected(data.substr(0, size));
+    }
+    checkRejected(data + '\0');
+
+    // Each field a reader trusts, made inconsistent with the rest of the file.
+    const HMS::SnapshotHeader &header = *(const HMS::SnapshotHeader *)data.data();
+    auto corrupt = [&](size_t offset, const void *value, size_t size)
+    {
+        std::string changed = data;
+        changed.replace(offset, size, (const char *)value, size);
+        checkRejected(changed);
+    };
+    uint32_t version = header.version + 1;
+    corrupt(offsetof(HMS::SnapshotHeader, version), &version, sizeof(version));
+    corrupt(offsetof(HMS::SnapshotHeader, magic), "XMSSNAP", 8);
+    uint64_t offset = header.fileSize;
+    corrupt(offsetof(HMS::SnapshotHeader, patientsOffset), &offset, sizeof(offset));
+    uint32_t count = header.patientCount + 1;
+    corrupt(offsetof(HMS::SnapshotHeader, patientCount), &count, sizeof(count));
+    int32_t idIndex = 0;
+    corrupt(offsetof(HMS::SnapshotHeader, idIndex), &idIndex, sizeof(idIndex));
+
+    CHECK(header.patientCount >= 2);
+    size_t patient = header.patientsOffset + sizeof(HMS::SnapshotPatient);
+    int32_t id = 0;
+    corrupt(patient + offsetof(HMS::SnapshotPatient, id), &id, sizeof(id));
+    uint32_t name = header.stringCount;
+    corrupt(patient + offsetof(HMS::SnapshotPatient, name), &name, sizeof(name));
+    uint32_t treatmentCount = header.treatmentCount + 1;
+    corrupt(patient + offsetof(HMS::SnapshotPatient, treatmentCount), &treatmentCount, sizeof(treatmentCount));
+    uint8_t status = HMS::PatientStatusSize;
+    corrupt(patient + offsetof(HMS::SnapshotPatient, status), &status, sizeof(status));
+
+    CHECK(header.treatmentCount > 0 && header.dateCount > 0);
+    size_t treatment = header.treatmentsOffset;
+    uint32_t otherType = header.stringCount;
+    corrupt(treatment + offsetof(HMS::SnapshotTreatment, otherType), &otherType, sizeof(otherType));
+    int32_t appointment = -1;
+    corrupt(treatment + offsetof(HMS::SnapshotTreatment, appointment), &appointment, sizeof(appointment));
+    corrupt(header.datesOffset, &appointment, sizeof(appointment));
+    uint64_t stringOffset = header.stringBytes + 1;
+    corrupt(header.stringsOffset + sizeof(HMS::SnapshotString), &stringOffset, sizeof(stringOffset));
+
+    CHECK(patientManager->loadSnapshot("build/tests/missing.snapshot") != patientManager->noErrorCode());
+    checkSame(patientManager, expected.patientManager);
+    std::remove(CORRUPT_PATH);
+}
+
+// An admission still queued when a snapshot loads is drained and replaced, not added on top of the snapshot.
+static void testQueuedAdmissionDrained()
+{
+    HMS::Client source;
+    addRandomPatients(source.patientManager, 30);
+    source.patientManager->saveSnapshot(SNAPSHOT_PATH);
+
+    HMS::Client client;
+    Manager::PatientManager *patientManager = client.patientManager;
+    HMS::Patient queued(patientManager->generatePatientId());
+    queued.setName("Queued");
+    CHECK(patientManager->submitAdmission(std::move(queued)));
+
+    CHECK(patientManager->loadSnapshot(SNAPSHOT_PATH) == patientManager->noErrorCode());
+    CHECK(patientManager->drainAdmissions() == 0);
+    checkSame(patientManager, source.patientManager);
+    View<HMS::Patient> found;
+    CHECK(patientManager->searchPatientsByName(found, "Queued", false, false) == 0);
+}
+
+// Loading raises the ID counter to the snapshot's, and never lowers a counter already past it.
+static void testIdCounterRaised()
+{
+    HMS::Client source;
+    addRandomPatients(source.patientManager, 30);
+    source.patientManager->saveSnapshot(SNAPSHOT_PATH);
+    int snapshotIdIndex = source.patientManager->getIdIndex();
+
+    HMS::Client lower;
+    for (int i = 0; i < snapshotIdIndex / 2; i++)
+    {
+        lower.patientManager->generatePatientId();
+    }
+    CHECK(lower.patientManager->loadSnapshot(SNAPSHOT_PATH) == lower.patientManager->noErrorCode());
+    CHECK(lower.patientManager->getIdIndex() == snapshotIdIndex);
+    CHECK(lower.patientManager->generatePatientId() == snapshotIdIndex + 1);
+
+    HMS::Client higher;
+    for (int i = 0; i < snapshotIdIndex + 100; i++)
+    {
+        higher.patientManager->generatePatientId();
+    }
+    CHECK(higher.patientManager->loadSnapshot(SNAPSHOT_PATH) == higher.patientManager->noErrorCode());
+    CHECK(higher.patientManager->getIdIndex() == snapshotIdIndex + 100);
+    CHECK(higher.patientManager->generatePatientId() == snapshotIdIndex + 101);
+    std::remove(SNAPSHOT_PATH);
+}
+
+int main()
+{
+    testRoundTrip();
+    testCorruptRejected();
+    testQueuedAdmissionDrained();
+    testIdCounterRaised();
+    Test::pass("PatientSnapshot");
+    return 0;
+}
\ No newline at end of file
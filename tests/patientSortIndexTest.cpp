@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <vector>
+#include "cores/patientSortIndex.h"
+#include "structs/view.h"
+#include "test.h"
+
+// Draws a treatment from a few appointments, stays and priorities, so many patients share each key.
+static HMS::Treatment randomTreatment()
+{
+    HMS::Treatment treatment;
+    treatment.setTreatmentType((HMS::TreatmentType)Test::randomInt(0, 4));
+    treatment.setAppointment(Test::randomInt(0, 9) == 0 ? Handler::Date() : Handler::Date(Test::randomInt(1, 4), 1, 2024));
+    treatment.setDayOfStay(Test::randomInt(0, 4));
+    treatment.setPriority(Test::randomInt(1, 5));
+    if (Test::randomInt(0, 3) == 0)
+    {
+        treatment.setCompleted();
+    }
+    return treatment;
+}
+
+// Makes one random change to a patient's treatments: adds one, edits, completes or deletes the latest one, or
+// edits an earlier one, which must not move the patient.
+static void changeTreatments(HMS::Patient &patient)
+{
+    HMS::Treatment *latest = patient.getLatestTreatment();
+    int change = latest == nullptr ? 0 : Test::randomInt(0, 5);
+    switch (change)
+    {
+    case 0:
+        patient.addTreatment(randomTreatment());
+        break;
+    case 1:
+        latest->setAppointment(Handler::Date(Test::randomInt(1, 4), 1, 2024));
+        break;
+    case 2:
+        latest->setDayOfStay(Test::randomInt(0, 4));
+        latest->setPriority(Test::randomInt(1, 5));
+        break;
+    case 3:
+        latest->setCompleted();
+        break;
+    case 4:
+        patient.deleteTreatment(*latest);
+        break;
+    default:
+        patient.getTreatment(Test::randomInt(0, patient.getTreatmentsSize() - 1))->setPriority(Test::randomInt(1, 5));
+        break;
+    }
+}
+
+// Checks an order of the index lists the patients as a stable sort of the ID ordered list with Compare does,
+// both through its sort key and through the comparison itself.
+template <auto Compare>
+static void checkOrder(HMS::PatientSortIndex &index, std::list<HMS::Patient> &patients, HMS::PatientOrder order)
+{
+    View<HMS::Patient> sorted;
+    std::vector<HMS::Patient *> compared;
+    for (HMS::Patient &patient : patients)
+    {
+        sorted.addNode(patient);
+        compared.push_back(&patient);
+    }
+    sorted.sortNodes<Compare>();
+    std::stable_sort(compared.begin(), compared.end(), [](HMS::Patient *patient, HMS::Patient *other)
+                     { return Compare(*patient, *other); });
+
+    std::vector<HMS::Patient *> indexed;
+    BPlusTreeIterator<HMS::PatientOrderKey, HMS::Patient *> iterator = index.iterate(order);
+    while (iterator.getData() != nullptr)
+    {
+        indexed.push_back(*iterator.getData());
+        iterator.next();
+    }
+
+    CHECK((int)indexed.size() == sorted.getSize());
+    CHECK(indexed == compared);
+    for (int i = 0; i < sorted.getSize() && i < (int)indexed.size(); i++)
+    {
+        CHECK(indexed[i] == sorted.getData(i));
+    }
+}
+
+// Checks every order of the index.
+static void checkOrders(HMS::PatientSortIndex &index, std::list<HMS::Patient> &patients)
+{
+    CHECK(index.getSize() == (int)patients.size());
+    checkOrder<HMS::Patient::compareTreatmentAppointment>(index, patients, HMS::OrderByAppointment);
+    checkOrder<HMS::Patient::compareTreatmentDayOfStay>(index, patients, HMS::OrderByDayOfStay);
+    checkOrder<HMS::Patient::compareTreatmentPriority>(index, patients, HMS::OrderByPriority);
+}
+
+// Gets a random patient of a non-empty list.
+static HMS::Patient &randomPatient(std::list<HMS::Patient> &patients)
+{
+    return *std::next(patients.begin(), Test::randomInt(0, (int)patients.size() - 1));
+}
+
+// Applies random admissions, treatment changes, status changes and deletions, updating the index as the patient
+// manager does, and checks every order against a sort of the list after each one. Now and then the index is
+// rebuilt with bulkLoad and the changes go on from there.
+static void testRandomChanges(int steps)
+{
+    HMS::PatientSortIndex index;
+    std::list<HMS::Patient> patients;
+    int nextId = 1;
+    for (int step = 0; step < steps; step++)
+    {
+        int change = patients.empty() ? 0 : Test::randomInt(0, 9);
+        if (change <= 2)
+        {
+            HMS::Patient patient(nextId++);
+            for (int i = Test::randomInt(0, 2); i > 0; i--)
+            {
+                patient.addTreatment(randomTreatment());
+            }
+            patients.push_back(std::move(patient));
+            index.update(patients.back());
+        }
+        else if (change <= 6)
+        {
+            HMS::Patient &patient = randomPatient(patients);
+            changeTreatments(patient);
+            index.update(patient);
+        }
+        else if (change == 7)
+        {
+            HMS::Patient &patient = randomPatient(patients);
+            patient.setStatus(patient.getStatus() == HMS::Admitted ? HMS::Discharged : HMS::Admitted);
+            index.update(patient);
+        }
+        else if (change == 8)
+        {
+            std::list<HMS::Patient>::iterator patient = std::next(patients.begin(), Test::randomInt(0, (int)patients.size() - 1));
+            CHECK(index.remove(patient->getId()));
+            CHECK(!index.remove(patient->getId()));
+            patients.erase(patient);
+        }
+        else
+        {
+            std::vector<HMS::Patient *> stored;
+            for (HMS::Patient &patient : patients)
+            {
+                stored.push_back(&patient);
+            }
+            index.bulkLoad(stored.data(), (int)stored.size());
+        }
+        checkOrders(index, patients);
+    }
+
+    index.reset();
+    CHECK(index.getSize() == 0);
+    CHECK(index.iterate(HMS::OrderByPriority).getData() == nullptr);
+}
+
+int main()
+{
+    testRandomChanges(3000);
+    Test::pass("PatientSortIndex");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "structs/priorityQueue.h"
+#include "test.h"
+
+using namespace List;
+
+// Ordered by key only. The text lives on the heap, so moving elements through the heap is checked too.
+struct Entry
+{
+    int key;
+    std::string text;
+
+    bool operator<(const Entry &other) const { return this->key < other.key; }
+};
+
+// Checks the keys visited from offset to offset + limit are those of the sorted model.
+static void checkVisit(PriorityQueue<Entry> &queue, std::vector<int> model, int offset, int limit)
+{
+    std::sort(model.begin(), model.end());
+    std::vector<int> visited;
+    int count = queue.visitInOrder(offset, limit, [&visited](Entry &entry)
+                                   { visited.push_back(entry.key); });
+    int expected = std::max(0, std::min(limit, (int)model.size() - offset));
+    CHECK(count == expected && (int)visited.size() == expected);
+    for (int i = 0; i < expected; i++)
+    {
+        CHECK(visited[i] == model[offset + i]);
+    }
+    CHECK(queue.getSize() == (int)model.size());
+}
+
+// Enqueues, dequeues and visits at random, against a vector of the keys queued.
+static void testAgainstVector()
+{
+    PriorityQueue<Entry> queue;
+    std::vector<int> model;
+    std::vector<Entry> initial;
+    for (int i = 0; i < 1000; i++)
+    {
+        initial.push_back({Test::randomInt(0, 300), std::to_string(i) + std::string(24, '.')});
+        model.push_back(initial.back().key);
+    }
+    queue.assign(initial.begin(), initial.end());
+
+    for (int i = 0; i < 50000; i++)
+    {
+        int key = Test::randomInt(0, 300);
+        int operation = Test::randomInt(0, 19);
+        if (operation < 4)
+        {
+            Entry entry{key, std::string(24, '.')};
+            queue.enqueue(entry);
+            model.push_back(key);
+        }
+        else if (operation < 8)
+        {
+            queue.emplace(Entry{key, std::string(24, ',')});
+            model.push_back(key);
+        }
+        else if (operation < 17 && !model.empty())
+        {
+            auto smallest = std::min_element(model.begin(), model.end());
+            CHECK(queue.peek()->key == *smallest);
+            queue.dequeue();
+            model.erase(smallest);
+        }
+        else
+        {
+            checkVisit(queue, model, Test::randomInt(0, (int)model.size() + 1), Test::randomInt(0, 50));
+        }
+        CHECK(queue.getSize() == (int)model.size());
+        CHECK(queue.isEmpty() == model.empty());
+    }
+
+    // Copies drain in the same order as the model.
+    PriorityQueue<Entry> copy = queue;
+    checkVisit(copy, model, 0, (int)model.size());
+    std::sort(model.begin(), model.end());
+    for (int key : model)
+    {
+        CHECK(copy.peek()->key == key);
+        copy.dequeue();
+    }
+    CHECK(copy.isEmpty());
+    CHECK(queue.getSize() == (int)model.size());
+
+    queue.reset();
+    CHECK(queue.isEmpty());
+}
+
+// A custom comparison decides which element goes first.
+static void testComparison()
+{
+    auto later = [](const Entry &a, const Entry &b)
+    { return a.key > b.key; };
+    PriorityQueue<Entry, decltype(later)> queue(later);
+    queue.reserve(100);
+    for (int i = 0; i < 100; i++)
+    {
+        queue.enqueue(Entry{Test::randomInt(0, 1000), ""});
+    }
+    int last = 1000;
+    while (!queue.isEmpty())
+    {
+        CHECK(queue.peek()->key <= last);
+        last = queue.peek()->key;
+        queue.dequeue();
+    }
+}
+
+int main()
+{
+    testAgainstVector();
+    testComparison();
+    Test::pass("PriorityQueue");
+    return 0;
+}
\ No newline at end of file
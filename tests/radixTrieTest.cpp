@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include "structs/radixTrie.h"
+#include "test.h"
+
+using namespace List;
+
+// Builds a short key from a small alphabet, so keys share prefixes and split nodes. Some keys end in a byte
+// above 127, which must sort after the letters.
+static std::string randomKey(int alphabet)
+{
+    std::string key;
+    int length = Test::randomInt(0, 6);
+    for (int i = 0; i < length; i++)
+    {
+        key += (char)('a' + Test::randomInt(0, alphabet - 1));
+    }
+    if (Test::randomInt(0, 9) == 0)
+    {
+        key += (char)0xC3;
+    }
+    return key;
+}
+
+// Checks the trie visits the values of the model under a key, in insertion order, and under a prefix, in key order.
+static void checkLookups(RadixTrie<int> &trie, std::map<std::string, std::vector<int>> &model, std::string &key)
+{
+    std::vector<int> visited;
+    int count = trie.find(key, [&visited](int &value)
+                          { visited.push_back(value); });
+    auto entry = model.find(key);
+    std::vector<int> expected = entry == model.end() ? std::vector<int>() : entry->second;
+    CHECK(visited == expected && count == (int)expected.size());
+
+    visited.clear();
+    count = trie.findPrefix(key, [&visited](int &value)
+                            { visited.push_back(value); });
+    expected.clear();
+    for (entry = model.lower_bound(key); entry != model.end() && entry->first.compare(0, key.size(), key) == 0; entry++)
+    {
+        expected.insert(expected.end(), entry->second.begin(), entry->second.end());
+    }
+    CHECK(visited == expected && count == (int)expected.size());
+}
+
+// Inserts, removes and looks up at random, against a map from key to the values in insertion order.
+static void testAgainstMap(int alphabet)
+{
+    RadixTrie<int> trie;
+    std::map<std::string, std::vector<int>> model;
+    int size = 0;
+    for (int i = 0; i < 20000; i++)
+    {
+        std::string key = randomKey(alphabet);
+        int operation = Test::randomInt(0, 9);
+        if (operation < 4)
+        {
+            trie.insert(key, i);
+            model[key].push_back(i);
+            size++;
+        }
+        else if (operation < 7)
+        {
+            // Remove a value under the key if there is one, or a value that was never inserted.
+            std::vector<int> &values = model[key];
+            int value = values.empty() ? -1 : values[Test::randomInt(0, (int)values.size() - 1)];
+            CHECK(trie.remove(key, value) == !values.empty());
+            if (!values.empty())
+            {
+                values.erase(std::find(values.begin(), values.end(), value));
+                size--;
+            }
+            if (values.empty())
+            {
+                model.erase(key);
+            }
+        }
+        else
+        {
+            checkLookups(trie, model, key);
+        }
+        CHECK(trie.getSize() == size);
+        CHECK(trie.isEmpty() == (size == 0));
+    }
+
+    // An empty prefix visits every value.
+    std::string empty;
+    checkLookups(trie, model, empty);
+
+    trie.reset();
+    model.clear();
+    CHECK(trie.isEmpty());
+    checkLookups(trie, model, empty);
+}
+
+// Inserting several values under a key appends them in order, as inserting each of them would.
+static void testBatchInsert(int alphabet)
+{
+    RadixTrie<int> trie;
+    std::map<std::string, std::vector<int>> model;
+    int size = 0;
+    for (int i = 0; i < 2000; i++)
+    {
+        std::string key = randomKey(alphabet);
+        std::vector<int> values(Test::randomInt(0, 4));
+        for (int &value : values)
+        {
+            value = Test::randomInt(0, 100000);
+        }
+        if (Test::randomInt(0, 1) == 0)
+        {
+            trie.insert(key, values.data(), (int)values.size());
+        }
+        else
+        {
+            for (int value : values)
+            {
+                trie.insert(key, value);
+            }
+        }
+        if (!values.empty())
+        {
+            model[key].insert(model[key].end(), values.begin(), values.end());
+        }
+        size += (int)values.size();
+        CHECK(trie.getSize() == size);
+        checkLookups(trie, model, key);
+    }
+    std::string empty;
+    checkLookups(trie, model, empty);
+}
+
+int main()
+{
+    testAgainstMap(2);
+    testAgainstMap(5);
+    testBatchInsert(2);
+    testBatchInsert(5);
+    Test::pass("RadixTrie");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <set>
+#include <vector>
+#include "structs/roaringBitmap.h"
+#include "test.h"
+
+using namespace List;
+
+// Checks the bitmap holds exactly the values of the set, visited in ascending order.
+static void checkSame(RoaringBitmap &bitmap, std::set<uint32_t> &model)
+{
+    CHECK(bitmap.getSize() == (int)model.size());
+    CHECK(bitmap.isEmpty() == model.empty());
+    std::vector<uint32_t> visited;
+    bitmap.forEach([&visited](uint32_t value)
+                   { visited.push_back(value); });
+    CHECK(visited == std::vector<uint32_t>(model.begin(), model.end()));
+}
+
+// Adds, removes and looks up at random in two bitmaps, against std::set, then intersects them.
+// A small range fills containers past the array limit so they turn into bitsets, and removing half the values
+// turns them back; the full range leaves one value per container.
+static void testAgainstSet(uint32_t range, int operations)
+{
+    RoaringBitmap bitmaps[2];
+    std::set<uint32_t> models[2];
+    for (int i = 0; i < operations; i++)
+    {
+        int side = Test::randomInt(0, 1);
+        uint32_t value = (uint32_t)(Test::random()() % range);
+        int operation = Test::randomInt(0, 9);
+        if (operation < 6)
+        {
+            CHECK(bitmaps[side].add(value) == models[side].insert(value).second);
+        }
+        else if (operation < 8)
+        {
+            CHECK(bitmaps[side].remove(value) == (models[side].erase(value) > 0));
+        }
+        else
+        {
+            CHECK(bitmaps[side].contains(value) == (models[side].count(value) > 0));
+        }
+    }
+    checkSame(bitmaps[0], models[0]);
+    checkSame(bitmaps[1], models[1]);
+
+    std::set<uint32_t> both;
+    std::set_intersection(models[0].begin(), models[0].end(), models[1].begin(), models[1].end(),
+                          std::inserter(both, both.end()));
+    RoaringBitmap intersection = bitmaps[0].intersect(bitmaps[1]);
+    checkSame(intersection, both);
+    CHECK(bitmaps[0].intersectionSize(bitmaps[1]) == (int)both.size());
+    CHECK(bitmaps[1].intersectionSize(bitmaps[0]) == (int)both.size());
+
+    std::vector<uint32_t> values(models[0].begin(), models[0].end());
+    for (uint32_t value : values)
+    {
+        if (Test::randomInt(0, 1) == 0)
+        {
+            CHECK(bitmaps[0].remove(value));
+            models[0].erase(value);
+        }
+    }
+    checkSame(bitmaps[0], models[0]);
+
+    bitmaps[0].reset();
+    models[0].clear();
+    checkSame(bitmaps[0], models[0]);
+    CHECK(bitmaps[0].intersect(bitmaps[1]).isEmpty());
+}
+
+int main()
+{
+    testAgainstSet(20000, 100000);
+    testAgainstSet(300000, 100000);
+    testAgainstSet(UINT32_MAX, 20000);
+    Test::pass("RoaringBitmap");
+    return 0;
+}
\ No newline at end of file
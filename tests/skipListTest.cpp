@@ -0,0 +1,174 @@
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "structs/skipList.h"
+#include "structs/orderedLinkedList.h"
+#include "structs/arrayList.h"
+#include "test.h"
+
+using namespace List;
+
+// Ordered by key only, so equal keys show where ties are placed.
+struct Entry
+{
+    int key;
+    int tag;
+
+    bool operator<(const Entry &other) const { return this->key < other.key; }
+    bool operator>(const Entry &other) const { return this->key > other.key; }
+    bool operator<=(const Entry &other) const { return this->key <= other.key; }
+    bool operator>=(const Entry &other) const { return this->key >= other.key; }
+    bool operator==(const Entry &other) const { return this->key == other.key; }
+};
+
+// Checks the skip list holds the same entries as the sorted linked list, in the same order, ties included.
+static void checkSame(SkipList<Entry> &skipList, OrderedLinkedList<Entry> &linkedList)
+{
+    CHECK(skipList.getSize() == linkedList.getSize());
+    CHECK(skipList.isEmpty() == linkedList.isEmpty());
+    Iterator<Entry> expected = linkedList.iterate();
+    for (Entry &entry : skipList)
+    {
+        CHECK(entry.key == expected.getData()->key && entry.tag == expected.getData()->tag);
+        expected.next();
+    }
+    CHECK(expected.getData() == nullptr);
+}
+
+// Inserts, deletes and looks up at random, against the sorted linked list the skip list replaces.
+static void testAgainstLinkedList()
+{
+    SkipList<Entry> skipList;
+    OrderedLinkedList<Entry> linkedList;
+    for (int i = 0; i < 20000; i++)
+    {
+        Entry entry{Test::randomInt(0, 500), i};
+        int operation = Test::randomInt(0, 9);
+        if (operation < 5)
+        {
+            skipList.addNode(entry);
+            linkedList.addNode(entry);
+        }
+        else if (operation < 8)
+        {
+            bool skipFound = true;
+            bool linkedFound = true;
+            try
+            {
+                skipList.deleteNode(entry);
+            }
+            catch (const std::out_of_range &)
+            {
+                skipFound = false;
+            }
+            try
+            {
+                linkedList.deleteNode(entry);
+            }
+            catch (const std::out_of_range &)
+            {
+                linkedFound = false;
+            }
+            CHECK(skipFound == linkedFound);
+        }
+        else if (!linkedList.isEmpty())
+        {
+            Entry *skipData = skipList.getData(entry);
+            Entry *linkedData = nullptr;
+            try
+            {
+                linkedData = linkedList.getData(entry);
+            }
+            catch (const std::out_of_range &)
+            {
+                // The sorted linked list's binary search throws on some misses rather than returning nullptr.
+            }
+            CHECK((skipData == nullptr) == (linkedData == nullptr));
+            CHECK(skipData == nullptr || skipData->key == entry.key);
+
+            int index = Test::randomInt(0, linkedList.getSize() - 1);
+            CHECK(skipList.getData(index)->tag == linkedList.getData(index)->tag);
+        }
+    }
+    checkSame(skipList, linkedList);
+
+    // Copies and moves keep the order.
+    SkipList<Entry> copy(skipList);
+    checkSame(copy, linkedList);
+    SkipList<Entry> moved(std::move(copy));
+    checkSame(moved, linkedList);
+    CHECK(copy.isEmpty());
+    copy = moved;
+    checkSame(copy, linkedList);
+
+    // Searching into another container visits the matches in order.
+    ArrayList<Entry> matches;
+    skipList.searchNodes(matches, [](Entry &entry, int key)
+                         { return entry.key < key; },
+                         250);
+    int count = 0;
+    for (Entry &entry : linkedList)
+    {
+        if (entry.key < 250)
+        {
+            CHECK(matches.getData(count)->tag == entry.tag);
+            count++;
+        }
+    }
+    CHECK(matches.getSize() == count);
+
+    // Deleting every entry empties the list.
+    while (!linkedList.isEmpty())
+    {
+        Entry entry = *linkedList.getData(0);
+        skipList.deleteNode(entry);
+        linkedList.deleteNode(entry);
+    }
+    checkSame(skipList, linkedList);
+}
+
+// Appending data already in order builds the same list as adding it one by one.
+static void testAppendNodes()
+{
+    std::vector<Entry> entries;
+    for (int i = 0; i < 5000; i++)
+    {
+        entries.push_back({i / 3, i});
+    }
+
+    SkipList<Entry> appended;
+    appended.addNode(Entry{-1, -1});
+    std::vector<int> visited;
+    appended.appendNodes((int)entries.size(), [&](int index)
+                         { return entries[index]; },
+                         [&](Entry &stored, int index)
+                         {
+                             CHECK(stored.tag == entries[index].tag);
+                             visited.push_back(index);
+                         });
+    CHECK((int)visited.size() == (int)entries.size());
+
+    OrderedLinkedList<Entry> expected;
+    expected.addNode(Entry{-1, -1});
+    for (int i = (int)entries.size() - 1; i >= 0; i--)
+    {
+        // Ties go before the entries they equal, so adding back to front keeps the tags in order.
+        expected.addNode(entries[i]);
+    }
+    checkSame(appended, expected);
+
+    // Lookups find appended entries through the upper levels.
+    for (int key = 0; key < 5000 / 3; key++)
+    {
+        Entry entry{key, 0};
+        CHECK(appended.getData(entry) != nullptr);
+    }
+}
+
+int main()
+{
+    testAgainstLinkedList();
+    testAppendNodes();
+    Test::pass("SkipList");
+    return 0;
+}
\ No newline at end of file
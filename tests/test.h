@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+/**
+ * @brief Checks a condition of a test. A failed check prints the condition and where it is, and ends the test.
+ */
+#define CHECK(condition)                                                                            \
+    do                                                                                              \
+    {                                                                                               \
+        if (!(condition))                                                                           \
+        {                                                                                           \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl; \
+            std::exit(EXIT_FAILURE);                                                                \
+        }                                                                                           \
+    } while (false)
+
+namespace Test
+{
+    /**
+     * @brief Gets the random generator of a test, seeded the same on every run so a failure can be replayed.
+     * @return Reference to the generator.
+     */
+    inline std::mt19937 &random()
+    {
+        static std::mt19937 generator(20240101);
+        return generator;
+    }
+
+    /**
+     * @brief Draws a random number in a range.
+     * @param min The lowest number, included.
+     * @param max The highest number, included.
+     * @return The number.
+     */
+    inline int randomInt(int min, int max)
+    {
+        return std::uniform_int_distribution<int>(min, max)(random());
+    }
+
+    /**
+     * @brief Reports that a test passed.
+     * @param name The name of the test.
+     */
+    inline void pass(const char *name)
+    {
+        std::cout << name << ": passed" << std::endl;
+    }
+}
\ No newline at end of file
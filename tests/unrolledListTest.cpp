@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "structs/unrolledList.h"
+#include "structs/orderedUnrolledList.h"
+#include "test.h"
+
+using namespace List;
+
+// Ordered by key only. The text lives on the heap, so moving elements between chunks is checked too.
+struct Entry
+{
+    int key;
+    std::string text;
+
+    Entry(int key = 0, int tag = 0) : key(key), text(std::to_string(tag) + std::string(24, '.')) {}
+
+    bool operator<(const Entry &other) const { return this->key < other.key; }
+    bool operator>(const Entry &other) const { return this->key > other.key; }
+    bool operator<=(const Entry &other) const { return this->key <= other.key; }
+    bool operator>=(const Entry &other) const { return this->key >= other.key; }
+    bool operator==(const Entry &other) const { return this->key == other.key; }
+};
+
+// Checks the list holds the same elements as the vector, in the same order.
+template <int B>
+static void checkSame(UnrolledList<Entry, B> &list, std::vector<Entry> &model)
+{
+    CHECK(list.getSize() == (int)model.size());
+    CHECK(list.isEmpty() == model.empty());
+    int index = 0;
+    for (Entry &entry : list)
+    {
+        CHECK(entry.key == model[index].key && entry.text == model[index].text);
+        index++;
+    }
+    CHECK(index == (int)model.size());
+}
+
+// Appends, inserts, deletes and indexes at random, against std::vector.
+template <int B>
+static void testAgainstVector()
+{
+    UnrolledList<Entry, B> list;
+    std::vector<Entry> model;
+    for (int i = 0; i < 20000; i++)
+    {
+        Entry entry(Test::randomInt(0, 100), i);
+        int operation = Test::randomInt(0, 9);
+        if (operation < 3)
+        {
+            list.addNode(entry);
+            model.push_back(entry);
+        }
+        else if (operation < 5)
+        {
+            int index = Test::randomInt(0, (int)model.size());
+            list.insertNode(index, Entry(entry));
+            model.insert(model.begin() + index, entry);
+        }
+        else if (operation < 7 && !model.empty())
+        {
+            int index = Test::randomInt(0, (int)model.size() - 1);
+            list.deleteNode(index);
+            model.erase(model.begin() + index);
+        }
+        else if (operation < 8)
+        {
+            // Deleting by data removes the first match.
+            auto match = std::find(model.begin(), model.end(), entry);
+            try
+            {
+                list.deleteNode(entry);
+                CHECK(match != model.end());
+                model.erase(match);
+            }
+            catch (const std::out_of_range &)
+            {
+                CHECK(match == model.end());
+            }
+        }
+        else if (!model.empty())
+        {
+            int index = Test::randomInt(0, (int)model.size() - 1);
+            CHECK(list.getData(index)->text == model[index].text);
+        }
+        CHECK(list.getSize() == (int)model.size());
+    }
+    checkSame(list, model);
+
+    // Copies and moves keep the order.
+    UnrolledList<Entry, B> copy(list);
+    checkSame(copy, model);
+    UnrolledList<Entry, B> moved(std::move(copy));
+    checkSame(moved, model);
+    CHECK(copy.isEmpty());
+    copy = moved;
+    checkSame(copy, model);
+
+    list.reset();
+    model.clear();
+    checkSame(list, model);
+}
+
+// Adds and deletes at random, against a vector kept sorted with ties placed before the elements they equal.
+template <int B>
+static void testOrdered()
+{
+    OrderedUnrolledList<Entry, B> list;
+    std::vector<Entry> model;
+    for (int i = 0; i < 20000; i++)
+    {
+        Entry entry(Test::randomInt(0, 500), i);
+        auto lower = std::lower_bound(model.begin(), model.end(), entry);
+        bool found = lower != model.end() && *lower == entry;
+        int operation = Test::randomInt(0, 9);
+        if (operation < 5)
+        {
+            list.addNode(entry);
+            model.insert(lower, entry);
+        }
+        else if (operation < 8)
+        {
+            try
+            {
+                list.deleteNode(entry);
+                CHECK(found);
+                model.erase(lower);
+            }
+            catch (const std::out_of_range &)
+            {
+                CHECK(!found);
+            }
+        }
+        else
+        {
+            try
+            {
+                Entry *data = list.getData(entry);
+                CHECK(found && data->text == lower->text);
+            }
+            catch (const std::out_of_range &)
+            {
+                CHECK(!found);
+            }
+        }
+    }
+    UnrolledList<Entry, B> &base = list;
+    checkSame(base, model);
+}
+
+int main()
+{
+    testAgainstVector<4>();
+    testAgainstVector<unrolledCapacity<Entry>()>();
+    testOrdered<4>();
+    testOrdered<unrolledCapacity<Entry>()>();
+    Test::pass("UnrolledList");
+    return 0;
+}
\ No newline at end of file
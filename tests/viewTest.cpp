@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include "structs/linkedList.h"
+#include "structs/view.h"
+#include "test.h"
+
+using namespace List;
+
+// Ordered by key only. The tag tells apart entries with the same key.
+struct Entry
+{
+    int key;
+    int tag;
+
+    bool operator<(const Entry &other) const { return this->key < other.key; }
+};
+
+// Orders entries by key, highest first.
+static bool byKeyDescending(Entry &entry, Entry &other)
+{
+    return entry.key > other.key;
+}
+
+// Matches entries with a key.
+static bool hasKey(Entry &entry, int key)
+{
+    return entry.key == key;
+}
+
+namespace List
+{
+    // Sort key of byKeyDescending, so sortNodes<byKeyDescending>() sorts keys instead of calling it.
+    template <>
+    struct SortKey<&byKeyDescending>
+    {
+        static const bool enabled = true;
+
+        static int key(Entry &entry)
+        {
+            return -entry.key;
+        }
+    };
+}
+
+// Gets the elements a view references, in view order.
+static std::vector<Entry *> referenced(View<Entry> &view)
+{
+    std::vector<Entry *> elements;
+    ViewIterator<Entry> iterator = view.iterate();
+    while (iterator.getData() != nullptr)
+    {
+        elements.push_back(iterator.getData());
+        iterator.next();
+    }
+    CHECK((int)elements.size() == view.getSize());
+    return elements;
+}
+
+// Gets the elements of a list, in list order.
+static std::vector<Entry *> listed(LinkedList<Entry> &list)
+{
+    std::vector<Entry *> elements;
+    for (Entry &entry : list)
+    {
+        elements.push_back(&entry);
+    }
+    return elements;
+}
+
+// Filters and orders a view of a list against the same done on a vector of pointers, and checks the list itself
+// never moves.
+static void testFilterAndOrder()
+{
+    LinkedList<Entry> list;
+    for (int i = 0; i < 2000; i++)
+    {
+        list.addNode(Entry{Test::randomInt(0, 50), i});
+    }
+    std::vector<Entry *> source = listed(list);
+
+    View<Entry> view;
+    view.assign(list);
+    CHECK(referenced(view) == source);
+
+    for (int key = 0; key <= 51; key++)
+    {
+        std::vector<Entry *> expected;
+        std::copy_if(source.begin(), source.end(), std::back_inserter(expected), [key](Entry *entry)
+                     { return entry->key == key; });
+
+        View<Entry> filtered;
+        view.searchNodes(filtered, hasKey, key);
+        CHECK(referenced(filtered) == expected);
+
+        // A list narrows into a view the same way.
+        View<Entry> searched;
+        list.searchNodes(searched, hasKey, key);
+        CHECK(referenced(searched) == expected);
+    }
+
+    std::vector<Entry *> expected = source;
+    std::stable_sort(expected.begin(), expected.end(), [](Entry *entry, Entry *other)
+                     { return *entry < *other; });
+    view.sortNodes();
+    CHECK(referenced(view) == expected);
+
+    expected = source;
+    std::stable_sort(expected.begin(), expected.end(), [](Entry *entry, Entry *other)
+                     { return byKeyDescending(*entry, *other); });
+    view.assign(list);
+    view.sortNodes(byKeyDescending);
+    CHECK(referenced(view) == expected);
+    view.assign(list);
+    view.sortNodes<byKeyDescending>();
+    CHECK(referenced(view) == expected);
+
+    CHECK(listed(list) == source);
+
+    // Pages put back together give the whole view; a page past the end is empty.
+    std::vector<Entry *> pages;
+    for (int offset = 0; offset < view.getSize(); offset += 300)
+    {
+        ViewIterator<Entry> iterator = view.iterate(offset, 300);
+        while (iterator.getData() != nullptr)
+        {
+            pages.push_back(iterator.getData());
+            iterator.next();
+        }
+    }
+    CHECK(pages == expected);
+    CHECK(view.iterate(view.getSize(), 10).getData() == nullptr);
+    CHECK(view.iterate(view.getSize() + 5, 10).getData() == nullptr);
+    CHECK(view.iterate(0, 0).getData() == nullptr);
+}
+
+// A view keeps referencing the same elements as the list changes: it sees their new values, sorts by them, and
+// takes the list's new elements when assigned again. Dropping references leaves the list alone.
+static void testReuse()
+{
+    LinkedList<Entry> list;
+    for (int i = 0; i < 500; i++)
+    {
+        list.addNode(Entry{Test::randomInt(0, 20), i});
+    }
+    View<Entry> view;
+    view.assign(list);
+    view.sortNodes();
+
+    for (Entry &entry : list)
+    {
+        entry.key = Test::randomInt(0, 20);
+    }
+    std::vector<Entry *> before = referenced(view);
+    for (int i = 0; i < view.getSize(); i++)
+    {
+        CHECK(view.getData(i) == before[i]);
+    }
+    std::vector<Entry *> expected = before;
+    std::stable_sort(expected.begin(), expected.end(), [](Entry *entry, Entry *other)
+                     { return *entry < *other; });
+    view.sortNodes();
+    CHECK(referenced(view) == expected);
+
+    for (int i = 0; i < 100; i++)
+    {
+        list.addNode(Entry{Test::randomInt(0, 20), 500 + i});
+    }
+    CHECK(view.getSize() == 500);
+    view.assign(list);
+    CHECK(referenced(view) == listed(list));
+
+    while (!view.isEmpty())
+    {
+        view.deleteNode(Test::randomInt(0, view.getSize() - 1));
+    }
+    CHECK(list.getSize() == 600);
+    bool threw = false;
+    try
+    {
+        view.getData(0);
+    }
+    catch (std::out_of_range &)
+    {
+        threw = true;
+    }
+    CHECK(threw);
+
+    view.assign(list);
+    threw = false;
+    try
+    {
+        view.deleteNode(600);
+    }
+    catch (std::out_of_range &)
+    {
+        threw = true;
+    }
+    CHECK(threw);
+    view.reset();
+    CHECK(view.isEmpty() && view.getSize() == 0);
+    CHECK(view.iterate().getData() == nullptr);
+    CHECK(list.getSize() == 600);
+}
+
+int main()
+{
+    testFilterAndOrder();
+    testReuse();
+    Test::pass("View");
+    return 0;
+}
\ No newline at end of file